@@ -5,6 +5,8 @@
 #include "hero.hpp"
 #include "monster.hpp"
 #include "taskboard.hpp"
+#include "gameevents.hpp"
+#include "terminalframe.hpp"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
@@ -12,14 +14,35 @@
 
 using namespace std;
 
-TUI::TUI() {}
+TUI::TUI() : out(&std::cout) {}
 
 void TUI::clearScreen() {
-#ifdef _WIN32
-    system("cls");
-#else
-    system("clear");
-#endif
+    if (batchMode) return;
+    TerminalFrame::clearScreen();
+    frame.invalidate();
+}
+
+void TUI::showBoard(int terror, int maxTerror, int turn, const Hero* hero1, const Hero* hero2, const Map& map,
+                    const ItemBag& itembag, const std::vector<Monster*>& monsters, const TaskBoard& taskBoard) {
+    if (batchMode) return;
+    out = &frame.begin();
+    showTerrorLevelAndTurn(terror, maxTerror, turn);
+    showMapWithHeroInfo(hero1, hero2);
+    showActionMenuWithVillagers(map);
+    showItemsOnBoard(itembag, map);
+    showMonsterStatus(monsters, map, taskBoard);
+    out = &std::cout;
+    frame.present();
+}
+
+void TUI::setBatchMode(bool enabled) {
+    batchMode = enabled;
+}
+
+void TUI::pause(const string& prompt) {
+    if (batchMode) return;
+    cout << prompt;
+    cin.get();
 }
 
 void TUI::showWelcomeScreen() {
@@ -84,9 +107,9 @@ void TUI::showHelpMenu() {
 }
 
 void TUI::showTerrorLevelAndTurn(int terror, int maxTerror, int turn) {
-    cout << "|" << std::string(60, '=') << " HORRIFIED " << std::string(67, '=') << "|" << std::endl;;
-    cout << "| Terror Level: [" << terror << "/" << maxTerror << "]" << std::string(44, ' ') << "| Turn: " << turn << std::string(65, ' ') << "|" << std::endl;
-    std::cout << "|" << std::string(64, ' ') << "|" << std::string(73, ' ') << "|" << std::endl;
+    (*out) << "|" << std::string(60, '=') << " HORRIFIED " << std::string(67, '=') << "|" << std::endl;;
+    (*out) << "| Terror Level: [" << terror << "/" << maxTerror << "]" << std::string(44, ' ') << "| Turn: " << turn << std::string(65, ' ') << "|" << std::endl;
+    (*out) << "|" << std::string(64, ' ') << "|" << std::string(73, ' ') << "|" << std::endl;
 }void TUI::showMapWithHeroInfo(const Hero* hero1, const Hero* hero2) {
     std::vector<std::string> mapLines = {
         "|============================= MAP ===============================",
@@ -178,31 +201,31 @@ std::vector<std::string> hero2Lines;
     if (mapLines.size() >= hero1Lines.size() && mapLines.size() >= hero2Lines.size()) maxLines = 12;
     for (size_t i = 0; i < maxLines; ++i) {
         if (i < mapLines.size()) {
-            std::cout << mapLines[i];
-            if (mapLines[i].size() < 63) std::cout << std::string(63 - mapLines[i].size(), ' ');
+            (*out) << mapLines[i];
+            if (mapLines[i].size() < 63) (*out) << std::string(63 - mapLines[i].size(), ' ');
         } else {
-            std::cout << std::string(63, ' ');
+            (*out) << std::string(63, ' ');
         }
 
         if (i < hero1Lines.size()) {
-            std::cout << std::left << std::setw(35) << hero1Lines[i];
+            (*out) << std::left << std::setw(35) << hero1Lines[i];
         } else {
-            std::cout << std::string(35, ' ');
+            (*out) << std::string(35, ' ');
         }
 
         if (i < hero2Lines.size()) {
             if (i == 0) {
-                std::cout << hero2Lines[i] << std::endl;
+                (*out) << hero2Lines[i] << std::endl;
                 continue;
             }
-            std::cout << "   " << hero2Lines[i];
-            if (hero2Lines[i].size() < 35) std::cout << std::string(35 - hero2Lines[i].size(), ' ') << "|";
+            (*out) << "   " << hero2Lines[i];
+            if (hero2Lines[i].size() < 35) (*out) << std::string(35 - hero2Lines[i].size(), ' ') << "|";
         } else {
-            std::cout << std::string(38, ' ') << "|";
+            (*out) << std::string(38, ' ') << "|";
         }
-        std::cout << std::endl;
+        (*out) << std::endl;
     }
-    std::cout << "|" << std::string(64, ' ') << "|" << std::string(73, ' ') << "|" << std::endl;
+    (*out) << "|" << std::string(64, ' ') << "|" << std::string(73, ' ') << "|" << std::endl;
 }
 
 void TUI::showActionMenuWithVillagers(const Map& map) {
@@ -232,27 +255,27 @@ void TUI::showActionMenuWithVillagers(const Map& map) {
     if (actionMenu.size() >= villagerLines.size()) maxLines = 5;
     for (size_t i = 0; i < maxLines; ++i) {
         if (i < actionMenu.size()) {
-            std::cout << actionMenu[i];
-            if (actionMenu[i].size() < 63)std::cout << std::string(63 - actionMenu[i].size(), ' ');
+            (*out) << actionMenu[i];
+            if (actionMenu[i].size() < 63)(*out) << std::string(63 - actionMenu[i].size(), ' ');
         } else {
-            std::cout << std::string(63, ' ');
+            (*out) << std::string(63, ' ');
         }
         if (i < villagerLines.size()) {
             if (i == 0) {
-                std::cout << villagerLines[i] << std::endl;
+                (*out) << villagerLines[i] << std::endl;
                 continue;
             }
-            std::cout << " " << villagerLines[i];
-            if (villagerLines[i].size() < 72) std::cout << std::string(72 - villagerLines[i].size(), ' ') << "|";
+            (*out) << " " << villagerLines[i];
+            if (villagerLines[i].size() < 72) (*out) << std::string(72 - villagerLines[i].size(), ' ') << "|";
         } else {
-            std::cout << std::string(73, ' ') << "|";
+            (*out) << std::string(73, ' ') << "|";
         }
-        std::cout << std::endl;
+        (*out) << std::endl;
     }
-    std::cout << "|" << std::string(64, ' ') << "|" << std::string(73, ' ') << "|" << std::endl;
+    (*out) << "|" << std::string(64, ' ') << "|" << std::string(73, ' ') << "|" << std::endl;
 }
 void TUI::showItemsOnBoard(const ItemBag& itembag, const Map& map) {
-    std::cout << "|" << std::string(62, '=') << " Items " << std::string(69, '=') << "|" << std::endl;
+    (*out) << "|" << std::string(62, '=') << " Items " << std::string(69, '=') << "|" << std::endl;
     for (const auto& pair : map.locations) {
         auto loc = pair.second;
         const auto& items = loc->getItems();
@@ -266,7 +289,7 @@ void TUI::showItemsOnBoard(const ItemBag& itembag, const Map& map) {
                 std::string itemStr = items[i].getItemName() + "(" + std::to_string(items[i].getPower()) + ", " + Item::colorToString(items[i].getColor()) + ")";
                 if (!first) itemStr = ", " + itemStr;
                 if (currentLen + itemStr.size() > 139) {
-                    std::cout << line.str() << std::string(139 - currentLen, ' ') << "|" << std::endl;
+                    (*out) << line.str() << std::string(139 - currentLen, ' ') << "|" << std::endl;
                     line.str("");
                     line.clear();
                     line << "| " << std::setw(12) << "" << ": ";
@@ -277,10 +300,10 @@ void TUI::showItemsOnBoard(const ItemBag& itembag, const Map& map) {
                 currentLen += itemStr.size();
                 first = false;
             }
-            std::cout << line.str() << std::string(139 - currentLen, ' ') << "|" << std::endl;
+            (*out) << line.str() << std::string(139 - currentLen, ' ') << "|" << std::endl;
         }
     }
-    std::cout << "|" << std::string(138, ' ') << "|" << std::endl;
+    (*out) << "|" << std::string(138, ' ') << "|" << std::endl;
 }
 
 void TUI::showMonsterStatus(const std::vector<Monster*>& monsters, const Map& map, const TaskBoard& taskBoard) {
@@ -313,14 +336,14 @@ void TUI::showMonsterStatus(const std::vector<Monster*>& monsters, const Map& ma
         }
     }
     size_t maxLines = std::max(draculaLines.size(), invisibleManLines.size());
-    std::cout << "|============================ DRACULA ====================================================== INVISIBLE MAN ================================|" << std::endl;
+    (*out) << "|============================ DRACULA ====================================================== INVISIBLE MAN ================================|" << std::endl;
     for (size_t i = 0; i < maxLines; ++i) {
         std::string left = (i < draculaLines.size()) ? draculaLines[i] : "";
         std::string right = (i < invisibleManLines.size()) ? invisibleManLines[i] : "";
-        std::cout << "| " << std::left << std::setw(63) << left << "| " << std::left << std::setw(72) << right << "|" << std::endl;
+        (*out) << "| " << std::left << std::setw(63) << left << "| " << std::left << std::setw(72) << right << "|" << std::endl;
     }
-    std::cout << "|" << std::string(64, ' ') << "|" << std::string(73, ' ') << "|" << std::endl;
-    std::cout << "|" << std::string(138, '=') << "|" << std::endl;
+    (*out) << "|" << std::string(64, ' ') << "|" << std::string(73, ' ') << "|" << std::endl;
+    (*out) << "|" << std::string(138, '=') << "|" << std::endl;
 }void TUI::showDiceRoll(const std::vector<std::string>& diceResults) {
     if (diceResults.empty()) {
         std::cout << "|" << std::string(58, '=') << " DICE ROLLED " << std::string(67, '=') << "|" << std::endl;
@@ -339,3 +362,27 @@ void TUI::showMonsterStatus(const std::vector<Monster*>& monsters, const Map& ma
     std::cout << "| [!] = Power, [*] = Strike, [ ] = Empty" << std::string(99, ' ') << "|" << std::endl;
     std::cout << "|" << std::string(138, '=') << "|" << std::endl;
 }
+
+void TUI::showEventSummary(const std::vector<GameEvent>& events) {
+    std::vector<std::string> lines;
+    for (const auto& event : events) {
+        switch (event.type) {
+            case GameEventType::HeroDefended:
+            case GameEventType::HeroHospitalized:
+            case GameEventType::VillagerKilled:
+            case GameEventType::VillagerRescued:
+            case GameEventType::ItemsStolen:
+                lines.push_back(event.describe());
+                break;
+            default:
+                break;
+        }
+    }
+    if (lines.empty()) return;
+
+    std::cout << "|" << std::string(58, '=') << " MONSTER PHASE EVENTS " << std::string(58, '=') << "|" << std::endl;
+    for (const auto& line : lines) {
+        std::cout << "| [!] " << std::left << std::setw(133) << line.substr(0, 133) << "|" << std::endl;
+    }
+    std::cout << "|" << std::string(138, '=') << "|" << std::endl;
+}
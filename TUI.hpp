@@ -5,6 +5,8 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <ostream>
+#include "terminalframe.hpp"
 
 class Location;
 class Hero;
@@ -14,11 +16,18 @@ class Monster;
 class ItemBag;
 class Map;
 class TaskBoard;
+struct GameEvent;
 
 class TUI {
 public:
     TUI();
     void clearScreen();
+    // Batch runs skip screen clears, board drawing and pauses
+    void setBatchMode(bool enabled);
+    void pause(const std::string& prompt);
+    // Draws every board panel as one frame, replacing clearScreen() plus the show* calls below
+    void showBoard(int terror, int maxTerror, int turn, const Hero* hero1, const Hero* hero2, const Map& map,
+                   const ItemBag& itembag, const std::vector<Monster*>& monsters, const TaskBoard& taskBoard);
     void showMessage(const std::string& message);
     void showWelcomeScreen();
     void showHelpMenu();
@@ -28,6 +37,14 @@ public:
     void showItemsOnBoard(const ItemBag& itembag, const Map& map);
     void showMonsterStatus(const std::vector<Monster*>& monsters, const Map& map, const TaskBoard& taskBoard);
     void showDiceRoll(const std::vector<std::string>& diceResults);
+    // Deaths, rescues, thefts and hospital trips published during the monster phase
+    void showEventSummary(const std::vector<GameEvent>& events);
+
+private:
+    TerminalFrame frame;
+    // The board panels write here: the frame while showBoard runs, otherwise cout
+    std::ostream* out;
+    bool batchMode = false;
 };
 
 #endif
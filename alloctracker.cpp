@@ -0,0 +1,195 @@
+#include "alloctracker.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+using namespace std;
+
+namespace {
+    constexpr size_t phaseCount = static_cast<size_t>(AllocPhase::Count);
+
+    struct PhaseCounters {
+        atomic<size_t> allocations{0};
+        atomic<size_t> frees{0};
+        atomic<size_t> bytes{0};
+    };
+
+    PhaseCounters counters[phaseCount];
+    atomic<bool> trackingEnabled{false};
+    thread_local AllocPhase activePhase = AllocPhase::Other;
+}
+
+bool AllocTracker::isCompiledIn() {
+#ifdef ALLOC_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocTracker::setEnabled(bool enabled) {
+    trackingEnabled.store(enabled, memory_order_relaxed);
+}
+
+bool AllocTracker::isEnabled() {
+    return trackingEnabled.load(memory_order_relaxed);
+}
+
+void AllocTracker::reset() {
+    for (auto& c : counters) {
+        c.allocations.store(0, memory_order_relaxed);
+        c.frees.store(0, memory_order_relaxed);
+        c.bytes.store(0, memory_order_relaxed);
+    }
+}
+
+AllocStats AllocTracker::getStats(AllocPhase phase) {
+    AllocStats stats;
+    size_t index = static_cast<size_t>(phase);
+    if (index >= phaseCount) return stats;
+    stats.allocations = counters[index].allocations.load(memory_order_relaxed);
+    stats.frees = counters[index].frees.load(memory_order_relaxed);
+    stats.bytes = counters[index].bytes.load(memory_order_relaxed);
+    return stats;
+}
+
+AllocStats AllocTracker::getTotal() {
+    AllocStats total;
+    for (size_t i = 0; i < phaseCount; ++i) {
+        AllocStats stats = getStats(static_cast<AllocPhase>(i));
+        total.allocations += stats.allocations;
+        total.frees += stats.frees;
+        total.bytes += stats.bytes;
+    }
+    return total;
+}
+
+string AllocTracker::phaseName(AllocPhase phase) {
+    switch (phase) {
+        case AllocPhase::Other: return "Other";
+        case AllocPhase::HeroAction: return "Hero action";
+        case AllocPhase::MonsterPhase: return "Monster phase";
+        case AllocPhase::Draw: return "Draw";
+        case AllocPhase::Save: return "Save";
+        default: return "Unknown";
+    }
+}
+
+string AllocTracker::report() {
+    string out;
+    char line[128];
+    for (size_t i = 0; i < phaseCount; ++i) {
+        AllocPhase phase = static_cast<AllocPhase>(i);
+        AllocStats stats = getStats(phase);
+        snprintf(line, sizeof(line), "%-14s %9zu allocs %9zu frees %11zu bytes\n",
+                 phaseName(phase).c_str(), stats.allocations, stats.frees, stats.bytes);
+        out += line;
+    }
+    return out;
+}
+
+AllocPhase AllocTracker::currentPhase() {
+    return activePhase;
+}
+
+void AllocTracker::setCurrentPhase(AllocPhase phase) {
+    activePhase = phase;
+}
+
+void AllocTracker::recordAllocation(size_t size) {
+    if (!trackingEnabled.load(memory_order_relaxed)) return;
+    PhaseCounters& c = counters[static_cast<size_t>(activePhase)];
+    c.allocations.fetch_add(1, memory_order_relaxed);
+    c.bytes.fetch_add(size, memory_order_relaxed);
+}
+
+void AllocTracker::recordFree() {
+    if (!trackingEnabled.load(memory_order_relaxed)) return;
+    counters[static_cast<size_t>(activePhase)].frees.fetch_add(1, memory_order_relaxed);
+}
+
+AllocPhaseScope::AllocPhaseScope(AllocPhase phase) : previousPhase(AllocTracker::currentPhase()) {
+    AllocTracker::setCurrentPhase(phase);
+}
+
+AllocPhaseScope::~AllocPhaseScope() {
+    AllocTracker::setCurrentPhase(previousPhase);
+}
+
+#ifdef ALLOC_TRACKING
+void* operator new(size_t size) {
+    AllocTracker::recordAllocation(size);
+    if (size == 0) size = 1;
+    if (void* p = malloc(size)) return p;
+    throw bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    AllocTracker::recordFree();
+    free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    operator delete(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    operator delete(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    operator delete(p);
+}
+
+// Over-aligned requests, e.g. the upstream chunks of a pmr memory resource.
+// MSVC has no aligned_alloc and its aligned blocks need _aligned_free, so
+// both directions go through the platform's own pair.
+void* operator new(size_t size, align_val_t alignment) {
+    AllocTracker::recordAllocation(size);
+    size_t align = static_cast<size_t>(alignment);
+    if (size == 0) size = 1;
+#ifdef _WIN32
+    if (void* p = _aligned_malloc(size, align)) return p;
+#else
+    void* p = nullptr;
+    if (posix_memalign(&p, align, size) == 0) return p;
+#endif
+    throw bad_alloc();
+}
+
+void* operator new[](size_t size, align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void operator delete(void* p, align_val_t) noexcept {
+    if (!p) return;
+    AllocTracker::recordFree();
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+void operator delete[](void* p, align_val_t alignment) noexcept {
+    operator delete(p, alignment);
+}
+
+void operator delete(void* p, size_t, align_val_t alignment) noexcept {
+    operator delete(p, alignment);
+}
+
+void operator delete[](void* p, size_t, align_val_t alignment) noexcept {
+    operator delete(p, alignment);
+}
+#endif
@@ -0,0 +1,57 @@
+#ifndef ALLOCTRACKER_HPP
+#define ALLOCTRACKER_HPP
+
+#include <cstddef>
+#include <string>
+
+// Heap allocations are only counted when the build defines ALLOC_TRACKING,
+// which replaces the global operator new/delete in alloctracker.cpp.
+
+enum class AllocPhase {
+    Other,
+    HeroAction,
+    MonsterPhase,
+    Draw,
+    Save,
+    Count
+};
+
+struct AllocStats {
+    std::size_t allocations = 0;
+    std::size_t frees = 0;
+    std::size_t bytes = 0;
+};
+
+class AllocTracker {
+public:
+    static bool isCompiledIn();
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    static void reset();
+    static AllocStats getStats(AllocPhase phase);
+    static AllocStats getTotal();
+    static std::string phaseName(AllocPhase phase);
+    static std::string report();
+
+    static AllocPhase currentPhase();
+    static void setCurrentPhase(AllocPhase phase);
+
+    static void recordAllocation(std::size_t size);
+    static void recordFree();
+};
+
+// Attributes allocations to a phase until the scope ends; nested scopes win
+class AllocPhaseScope {
+private:
+    AllocPhase previousPhase;
+
+public:
+    explicit AllocPhaseScope(AllocPhase phase);
+    ~AllocPhaseScope();
+
+    AllocPhaseScope(const AllocPhaseScope&) = delete;
+    AllocPhaseScope& operator=(const AllocPhaseScope&) = delete;
+};
+
+#endif
@@ -1,114 +1,33 @@
 #include "archeologist.hpp"
+#include "rules.hpp"
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
 
 using namespace std;
 
-Archeologist::Archeologist(const string& playerName, shared_ptr<Location> startingLocation) : Hero(playerName, "Archeologist", 4, startingLocation) {}
+Archeologist::Archeologist(const string& playerName, shared_ptr<Location> startingLocation) : Hero(playerName, HeroKind::Archeologist, Rules::ARCHEOLOGIST_ACTIONS, startingLocation) {}
 
-void Archeologist::specialAction() {
+void Archeologist::specialAction(shared_ptr<Location> location, const vector<Item>& chosenItems) {
     if (remainingActions <= 0) {
         throw invalid_argument("No remaining actions.");
     }
 
     const auto& neighbors = currentLocation->getNeighbors();
-    if (neighbors.empty()) {
-        throw invalid_argument("There are no neighboring locations.");
+    if (!location || find(neighbors.begin(), neighbors.end(), location) == neighbors.end()) {
+        throw invalid_argument(playerName + " (Archeologist) can only take items from a neighboring location.");
     }
-
-    vector<shared_ptr<Location>> neighborsWithItems;
-    for (const auto& neighbor : neighbors) {
-        if (!neighbor->getItems().empty()) {
-            neighborsWithItems.push_back(neighbor);
-        }
-    }
-
-    if (neighborsWithItems.empty()) {
-        throw invalid_argument(playerName + " (Archeologist) found no items in neighboring locations.");
-    }
-
-    cout << "Neighboring locations with items:\n";
-    for (size_t i = 0; i < neighborsWithItems.size(); ++i) {
-        cout << i + 1 << ". " << neighborsWithItems[i]->getName() << "\n";
-    }
-
-    int locationChoice;
-    while (true) {
-        cout << "Choose a location to pick items from (1-" << neighborsWithItems.size() << "): ";
-        cin >> locationChoice;
-        if (cin.fail()) {
-            cout << "Invalid input. Please enter a number.\n";
-                cin.clear(); 
-                cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-                continue;
-        }
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        break;
-    }
-    if (locationChoice < 1 || locationChoice > static_cast<int>(neighborsWithItems.size())) {
-        cout << "Invalid location choice.\n";
-        return;
-    }
-
-    auto chosenLocation = neighborsWithItems[locationChoice - 1];
-    const auto& itemsAtLocation = chosenLocation->getItems();
-
-    if (itemsAtLocation.empty()) {
-        cout << "No items found at " << chosenLocation->getName() << ".\n";
-        return;
+    if (chosenItems.empty()) {
+        throw invalid_argument("Choose at least one item to pick up.");
     }
 
-    bool itemWasPickedUp = false;
-    int exitChoice = static_cast<int>(itemsAtLocation.size()) + 1;
-
-    while (true) {
-        cout << "\nItems in " << chosenLocation->getName() << ":\n";
-        for (size_t i = 0; i < itemsAtLocation.size(); ++i) {
-            const auto& it = itemsAtLocation[i];
-            cout << i + 1 << ". " << it.getItemName() << " (" 
-                 << Item::colorToString(it.getColor()) << ", Power: " 
-                 << it.getPower() << ")\n";
-        }
-        cout << exitChoice << ". Exit\n";
-
-        int itemChoice;
-        while (true) {
-            cout << "Enter the number of the item to pick up (" << exitChoice << " to finish): ";
-            cin >> itemChoice;
-            if (cin.fail()) {
-                cout << "Invalid input. Please enter a number.\n";
-                cin.clear(); 
-                cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-                continue;
-            }
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            break;
-        }
-
-        if (itemChoice == exitChoice) break;
-
-        if (itemChoice < 1 || itemChoice > static_cast<int>(itemsAtLocation.size())) {
-            cout << "Invalid choice. Try again.\n";
-            continue;
-        }
-
-        const Item& selectedItem = itemsAtLocation[itemChoice - 1];
-        items.push_back(selectedItem);
-        chosenLocation->removeItem(selectedItem);
+    for (const auto& item : chosenItems) {
+        location->removeItem(item);
+        items.push_back(item);
         cout << playerName << " (" << heroName << ") picked up " 
-             << selectedItem.getItemName() << " from " << chosenLocation->getName() << ".\n";
-
-        itemWasPickedUp = true;
-
-        if (chosenLocation->getItems().empty()) {
-            cout << "No more items in " << chosenLocation->getName() << ".\n";
-            break;
-        }
-    }
-
-    if (itemWasPickedUp) {
-        remainingActions--;
+             << item.getItemName() << " from " << location->getName() << ".\n";
     }
+    remainingActions--;
 }
 
 void Archeologist::ability(size_t index) {
@@ -9,8 +9,9 @@ class Archeologist : public Hero {
 public:
     Archeologist(const std::string& playerName, std::shared_ptr<Location> startingLocation);
 
-    void specialAction() override;
-    void ability(size_t index) override;
+    // Takes the chosen items from a neighboring location for one action
+    void specialAction(std::shared_ptr<Location> location, const std::vector<Item>& chosenItems);
+    void ability(size_t index);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "assetarchive.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+static_assert(sizeof(AssetArchive::Header) == 16, "archive header layout changed");
+static_assert(sizeof(AssetArchive::Entry) == 128, "archive entry layout changed");
+
+// True if an image entry's blob holds all of its pixels in its format
+static bool imageFitsEntry(const AssetArchive::Entry& entry) {
+    if (entry.width <= 0 || entry.height <= 0) return false;
+    // Eight pixels fill whole bytes even at 4 bits per pixel; zero means an unknown format
+    uint64_t bytesPerEightPixels = (uint64_t)GetPixelDataSize(8, 1, entry.format);
+    uint64_t pixels = (uint64_t)entry.width * (uint64_t)entry.height;
+    if (bytesPerEightPixels == 0 || pixels / 8 > entry.size) return false;
+    return pixels * bytesPerEightPixels / 8 <= entry.size;
+}
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+bool AssetArchive::open(const string& path) {
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        void* mapping = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            data = static_cast<const unsigned char*>(mapping);
+            dataSize = (size_t)info.st_size;
+            mapped = true;
+        }
+    }
+    ::close(fd);  // the mapping stays valid after the descriptor is closed
+#else
+    // windows.h clashes with raylib's names, so read the file in one go instead
+    ifstream file(path, ios::binary | ios::ate);
+    if (file) {
+        fileBuffer.resize((size_t)file.tellg());
+        file.seekg(0);
+        if (file.read(reinterpret_cast<char*>(fileBuffer.data()), fileBuffer.size()) && !fileBuffer.empty()) {
+            data = fileBuffer.data();
+            dataSize = fileBuffer.size();
+        }
+    }
+#endif
+    if (data == nullptr) return false;
+
+    const Header* header = reinterpret_cast<const Header*>(data);
+    if (dataSize < sizeof(Header) || memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION
+        || dataSize < sizeof(Header) + (size_t)header->entryCount * sizeof(Entry)) {
+        cout << "Ignoring invalid asset archive: " << path << endl;
+        close();
+        return false;
+    }
+
+    const Entry* entryTable = reinterpret_cast<const Entry*>(data + sizeof(Header));
+    entries.reserve(header->entryCount);
+    for (uint32_t i = 0; i < header->entryCount; ++i) {
+        const Entry& entry = entryTable[i];
+        size_t nameLength = strnlen(entry.name, NAME_SIZE);
+        if (nameLength == NAME_SIZE || entry.offset > dataSize || entry.size > dataSize - entry.offset
+            || (entry.kind == IMAGE_ENTRY && !imageFitsEntry(entry))) {
+            cout << "Ignoring invalid asset archive entry " << i << " in " << path << endl;
+            continue;
+        }
+        entries[string_view(entry.name, nameLength)] = &entry;
+    }
+    cout << "Asset archive opened: " << path << " (" << entries.size() << " entries)" << endl;
+    return true;
+}
+
+void AssetArchive::close() {
+    entries.clear();
+#ifndef _WIN32
+    if (mapped) {
+        munmap(const_cast<unsigned char*>(data), dataSize);
+    }
+#endif
+    fileBuffer.clear();
+    fileBuffer.shrink_to_fit();
+    data = nullptr;
+    dataSize = 0;
+    mapped = false;
+}
+
+const AssetArchive::Entry* AssetArchive::find(string_view name, uint32_t kind) const {
+    auto it = entries.find(name);
+    if (it == entries.end() || it->second->kind != kind) return nullptr;
+    return it->second;
+}
+
+bool AssetArchive::findImage(string_view name, Image& image) const {
+    const Entry* entry = find(name, IMAGE_ENTRY);
+    if (entry == nullptr) return false;
+
+    image.data = const_cast<unsigned char*>(data + entry->offset);
+    image.width = entry->width;
+    image.height = entry->height;
+    image.mipmaps = 1;
+    image.format = entry->format;
+    return true;
+}
+
+const unsigned char* AssetArchive::findFile(string_view name, size_t& fileSize) const {
+    const Entry* entry = find(name, FILE_ENTRY);
+    if (entry == nullptr) return nullptr;
+
+    fileSize = (size_t)entry->size;
+    return data + entry->offset;
+}
@@ -0,0 +1,76 @@
+#ifndef ASSETARCHIVE_HPP
+#define ASSETARCHIVE_HPP
+
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Read-only view of a packed asset file built by packassets.
+//
+// Layout (little endian):
+//   Header | Entry[entryCount] | data blobs (each aligned to DATA_ALIGNMENT)
+// Images are stored already decoded (PixelFormat given per entry), so a
+// found image can go straight to LoadTextureFromImage. Other files such as
+// fonts are stored as their raw bytes.
+class AssetArchive {
+public:
+    static constexpr char MAGIC[4] = {'H', 'P', 'A', 'K'};
+    static const uint32_t VERSION = 1;
+    static const size_t NAME_SIZE = 96;
+    static const size_t DATA_ALIGNMENT = 16;
+    static constexpr const char* DEFAULT_FILE = "Horrified_Assets.pak";
+
+    enum EntryKind : uint32_t {
+        IMAGE_ENTRY = 0,
+        FILE_ENTRY = 1
+    };
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t reserved;
+    };
+
+    struct Entry {
+        char name[NAME_SIZE];    // relative path, e.g. "Horrified_Assets/map2.jpg"
+        uint32_t kind;
+        int32_t width;
+        int32_t height;
+        int32_t format;          // raylib PixelFormat for images
+        uint64_t offset;         // from the start of the file
+        uint64_t size;
+    };
+
+    AssetArchive() = default;
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    // Maps the whole file; returns false (and stays closed) if it is missing or malformed
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return data != nullptr; }
+    size_t size() const { return entries.size(); }
+
+    // The image's pixels point into the mapping: never UnloadImage() it,
+    // and copy it (ImageCopy) before resizing or reformatting.
+    bool findImage(std::string_view name, Image& image) const;
+    const unsigned char* findFile(std::string_view name, size_t& fileSize) const;
+
+private:
+    const unsigned char* data = nullptr;
+    size_t dataSize = 0;
+    bool mapped = false;
+    std::vector<unsigned char> fileBuffer;   // used where mmap is unavailable
+    std::unordered_map<std::string_view, const Entry*> entries;
+
+    const Entry* find(std::string_view name, uint32_t kind) const;
+};
+
+#endif
@@ -0,0 +1,116 @@
+#include "assetloader.hpp"
+#include <algorithm>
+#include <unordered_map>
+
+using namespace std;
+
+AssetLoader::AssetLoader(const AssetArchive* archive, size_t threadCount)
+    : archive(archive), stopping(false), requestedCount(0), takenCount(0) {
+    if (threadCount == 0) {
+        unsigned int cores = thread::hardware_concurrency();
+        threadCount = cores > 1 ? min<size_t>(cores - 1, 4) : 1;
+    }
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+    }
+}
+
+AssetLoader::~AssetLoader() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        stopping = true;
+        pendingJobs.clear();
+    }
+    jobAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (auto& loaded : decodedImages) {
+        if (loaded.ok && !loaded.borrowed) UnloadImage(loaded.image);
+    }
+}
+
+string AssetLoader::resolvePath(const string& relativePath) {
+    static std::mutex rootMutex;
+    static unordered_map<string, string> rootByFolder;
+
+    // Asset folders (fonts/, images/, Horrified_Assets/) are resolved independently
+    string folder = relativePath.substr(0, relativePath.find('/'));
+    lock_guard<std::mutex> lock(rootMutex);
+    auto it = rootByFolder.find(folder);
+    if (it != rootByFolder.end()) {
+        return it->second + relativePath;
+    }
+
+    for (const string prefix : {"", "../", "../../", "./"}) {
+        if (FileExists((prefix + relativePath).c_str())) {
+            rootByFolder[folder] = prefix;
+            return prefix + relativePath;
+        }
+    }
+    return relativePath; // Return original if none found
+}
+
+void AssetLoader::request(const string& key, const string& relativePath) {
+    Image packed{};
+    if (archive != nullptr && archive->findImage(relativePath, packed)) {
+        lock_guard<mutex> lock(queueMutex);
+        decodedImages.push_back({key, relativePath, packed, true, true});
+        requestedCount++;
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(queueMutex);
+        pendingJobs.push_back({key, resolvePath(relativePath), Image{}, false, false});
+        requestedCount++;
+    }
+    jobAvailable.notify_one();
+}
+
+vector<LoadedImage> AssetLoader::takeDecoded(size_t maxCount) {
+    vector<LoadedImage> taken;
+    lock_guard<mutex> lock(queueMutex);
+    while (!decodedImages.empty() && taken.size() < maxCount) {
+        taken.push_back(decodedImages.front());
+        decodedImages.pop_front();
+    }
+    takenCount += taken.size();
+    return taken;
+}
+
+size_t AssetLoader::getRequestedCount() const {
+    lock_guard<mutex> lock(queueMutex);
+    return requestedCount;
+}
+
+size_t AssetLoader::getTakenCount() const {
+    lock_guard<mutex> lock(queueMutex);
+    return takenCount;
+}
+
+bool AssetLoader::isDone() const {
+    lock_guard<mutex> lock(queueMutex);
+    return takenCount == requestedCount;
+}
+
+void AssetLoader::workerLoop() {
+    while (true) {
+        LoadedImage job;
+        {
+            unique_lock<mutex> lock(queueMutex);
+            jobAvailable.wait(lock, [this] { return stopping || !pendingJobs.empty(); });
+            if (stopping) return;
+            job = pendingJobs.front();
+            pendingJobs.pop_front();
+        }
+
+        if (FileExists(job.path.c_str())) {
+            job.image = LoadImage(job.path.c_str());
+            job.ok = job.image.data != nullptr;
+        }
+
+        lock_guard<mutex> lock(queueMutex);
+        decodedImages.push_back(job);
+    }
+}
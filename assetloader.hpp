@@ -0,0 +1,58 @@
+#ifndef ASSETLOADER_HPP
+#define ASSETLOADER_HPP
+
+#include <raylib.h>
+#include "assetarchive.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct LoadedImage {
+    std::string key;
+    std::string path;
+    Image image;
+    bool ok;
+    bool borrowed;   // pixels live in the AssetArchive mapping: copy, never unload
+};
+
+// Decodes images on worker threads (LoadImage is CPU only). The main thread
+// collects them with takeDecoded() and does the GPU uploads itself.
+// Images found in the archive are already decoded and skip the workers.
+class AssetLoader {
+public:
+    explicit AssetLoader(const AssetArchive* archive = nullptr, std::size_t threadCount = 0);
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // Finds which of ./, ../ or ../../ holds the asset folder once, then reuses it
+    static std::string resolvePath(const std::string& relativePath);
+
+    void request(const std::string& key, const std::string& relativePath);
+    // At most maxCount decoded images; the caller owns (and must unload) them
+    std::vector<LoadedImage> takeDecoded(std::size_t maxCount);
+
+    std::size_t getRequestedCount() const;
+    std::size_t getTakenCount() const;
+    bool isDone() const;
+
+private:
+    const AssetArchive* archive;
+    std::vector<std::thread> workers;
+    std::deque<LoadedImage> pendingJobs;
+    std::deque<LoadedImage> decodedImages;
+    mutable std::mutex queueMutex;
+    std::condition_variable jobAvailable;
+    bool stopping;
+    std::size_t requestedCount;
+    std::size_t takenCount;
+
+    void workerLoop();
+};
+
+#endif
@@ -0,0 +1,140 @@
+#include "batchmode.hpp"
+#include "rules.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+bool BatchOptions::parse(int argc, char** argv, BatchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--batch") {
+            options.enabled = true;
+        } else if (arg == "--jsonl") {
+            options.enabled = options.jsonl = true;
+        } else if (arg.rfind("--script=", 0) == 0) {
+            options.enabled = true;
+            options.scriptFile = arg.substr(string("--script=").size());
+        } else {
+            cerr << "Unknown option: " << arg << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+BatchSession::BatchSession(const BatchOptions& options)
+    : options(options), originalInput(cin.rdbuf()), originalOutput(cout.rdbuf()), report(cout.rdbuf()) {
+    streambuf* source = originalInput;
+    if (!options.scriptFile.empty()) {
+        scriptFile.open(options.scriptFile);
+        if (!scriptFile) {
+            throw runtime_error("Cannot open script " + options.scriptFile);
+        }
+        source = scriptFile.rdbuf();
+    }
+    input = make_unique<ScriptInput>(source, *this);
+    cin.rdbuf(input.get());
+    // A stream without a buffer drops everything written to it
+    cout.rdbuf(nullptr);
+}
+
+BatchSession::~BatchSession() {
+    writeTotals();
+    cin.rdbuf(originalInput);
+    cout.rdbuf(originalOutput);
+}
+
+BatchSession::ScriptInput::int_type BatchSession::ScriptInput::underflow() {
+    streamsize count = source->sgetn(chunk, CHUNK_SIZE);
+    if (count <= 0) {
+        session.scriptEnded();
+    }
+    setg(chunk, chunk, chunk + count);
+    return traits_type::to_int_type(chunk[0]);
+}
+
+void BatchSession::startGame() {
+    ++gamesStarted;
+    gameInProgress = true;
+    lastTurn = BatchTurn();
+}
+
+void BatchSession::recordTurn(const BatchTurn& turn) {
+    lastTurn = turn;
+    if (!options.jsonl) return;
+
+    report << "{\"game\":" << gamesStarted << ",\"turn\":" << turn.turn << ",\"hero\":" << quoted(turn.hero)
+           << ",\"terror\":" << turn.terror
+           << ",\"dracula_defeated\":" << (turn.draculaDefeated ? "true" : "false")
+           << ",\"invisible_man_defeated\":" << (turn.invisibleManDefeated ? "true" : "false")
+           << ",\"villagers_rescued\":" << turn.villagersRescued << ",\"events\":[";
+    for (size_t i = 0; i < turn.events.size(); ++i) {
+        if (i > 0) report << ",";
+        report << quoted(turn.events[i]);
+    }
+    report << "]}\n";
+}
+
+void BatchSession::finishGame(const string& outcome, const BatchTurn& last) {
+    if (!gameInProgress) return;
+    gameInProgress = false;
+    lastTurn = last;
+
+    if (outcome == "heroes-win") ++heroWins;
+    else if (outcome == "terror" || outcome == "deck-empty") ++monsterWins;
+    else ++otherEndings;
+
+    if (options.jsonl) {
+        report << "{\"game\":" << gamesStarted << ",\"outcome\":" << quoted(outcome) << ",\"turns\":" << last.turn
+               << ",\"terror\":" << last.terror << ",\"villagers_rescued\":" << last.villagersRescued << "}\n";
+    } else {
+        report << "Game " << gamesStarted << ": " << outcome << " after " << last.turn << " turns, terror "
+               << last.terror << "/" << Rules::TERROR_LIMIT << ", " << last.villagersRescued << " villagers rescued\n";
+    }
+    report.flush();
+}
+
+void BatchSession::scriptEnded() {
+    bool unfinished = gameInProgress;
+    finishGame("incomplete", lastTurn);
+    writeTotals();
+    exit(unfinished ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+void BatchSession::writeTotals() {
+    if (totalsWritten) return;
+    totalsWritten = true;
+
+    if (options.jsonl) {
+        report << "{\"games\":" << gamesStarted << ",\"hero_wins\":" << heroWins << ",\"monster_wins\":" << monsterWins
+               << ",\"other\":" << otherEndings << "}\n";
+    } else {
+        report << "Played " << gamesStarted << " games: " << heroWins << " hero wins, " << monsterWins
+               << " monster wins, " << otherEndings << " other\n";
+    }
+    report.flush();
+}
+
+string BatchSession::quoted(const string& text) {
+    string result = "\"";
+    for (char c : text) {
+        switch (c) {
+            case '"': result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    result += escaped;
+                } else {
+                    result += c;
+                }
+        }
+    }
+    return result + "\"";
+}
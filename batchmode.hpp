@@ -0,0 +1,89 @@
+#ifndef BATCHMODE_HPP
+#define BATCHMODE_HPP
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Command line switches for running the terminal game from a script:
+//   --batch          read commands from stdin, no pauses or screen clears
+//   --script=FILE    read commands from FILE (implies --batch)
+//   --jsonl          also write one JSON line per turn (implies --batch)
+struct BatchOptions {
+    bool enabled = false;
+    bool jsonl = false;
+    std::string scriptFile;
+
+    // Returns false on an unknown switch
+    static bool parse(int argc, char** argv, BatchOptions& options);
+};
+
+// Where a game stands at the end of a round, as reported by batch mode
+struct BatchTurn {
+    int turn = 0;
+    std::string hero;
+    int terror = 0;
+    bool draculaDefeated = false;
+    bool invisibleManDefeated = false;
+    std::size_t villagersRescued = 0;
+    std::vector<std::string> events;
+};
+
+// Lets the real terminal game run unattended. Commands are the same lines a
+// player would type, so one script can drive the main menu and several games.
+// Normal game output is discarded; only the per-game results (and per-turn
+// JSON lines when asked) reach stdout. The process exits when the script ends.
+class BatchSession {
+public:
+    explicit BatchSession(const BatchOptions& options);
+    ~BatchSession();
+    BatchSession(const BatchSession&) = delete;
+    BatchSession& operator=(const BatchSession&) = delete;
+
+    void startGame();
+    void recordTurn(const BatchTurn& turn);
+    // outcome is one of "heroes-win", "terror", "deck-empty", "quit", "incomplete"
+    void finishGame(const std::string& outcome, const BatchTurn& last);
+
+private:
+    // Feeds cin from the script and ends the run at end of input, so prompts
+    // that retry on bad input can never spin on an exhausted script
+    class ScriptInput : public std::streambuf {
+    public:
+        ScriptInput(std::streambuf* source, BatchSession& session) : source(source), session(session) {}
+
+    protected:
+        int_type underflow() override;
+
+    private:
+        static const std::size_t CHUNK_SIZE = 4096;
+        std::streambuf* source;
+        BatchSession& session;
+        char chunk[CHUNK_SIZE];
+    };
+
+    [[noreturn]] void scriptEnded();
+    void writeTotals();
+    static std::string quoted(const std::string& text);
+
+    BatchOptions options;
+    std::ifstream scriptFile;
+    std::unique_ptr<ScriptInput> input;
+    std::streambuf* originalInput;
+    std::streambuf* originalOutput;
+    std::ostream report;
+
+    int gamesStarted = 0;
+    int heroWins = 0;
+    int monsterWins = 0;
+    int otherEndings = 0;
+    bool gameInProgress = false;
+    bool totalsWritten = false;
+    BatchTurn lastTurn;
+};
+
+#endif
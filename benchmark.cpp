@@ -0,0 +1,526 @@
+// Fixed-seed microbenchmarks for the engine hot paths.
+//
+// Build (engine only, no raylib needed):
+//   g++ -std=c++20 -O2 -DTERMINAL -DALLOC_TRACKING benchmark.cpp alloctracker.cpp gamearena.cpp
+//       archeologist.cpp courier.cpp dice.cpp dracula.cpp
+//       frenzymarker.cpp gameevents.cpp gamestate.cpp hero.cpp invisibleman.cpp item.cpp
+//       itemcountindex.cpp location.cpp map.cpp mayor.cpp monster.cpp monstercard.cpp
+//       monstermanager.cpp perkcard.cpp perkdeck.cpp rules.cpp scientist.cpp taskboard.cpp
+//       terrortracker.cpp villager.cpp villagermanager.cpp -o benchmark
+//
+// Each rule variant is its own build: add -DRULESET=HardRules to the same command
+// with -o benchmark-hard and compare the two reports.
+//
+// Usage:
+//   ./benchmark [--iterations=N] [--seed=N] [--format=table|json|csv] [--out=FILE] [--filter=NAME] [--phases]
+//
+// allocs/op and bytes/op come from AllocTracker and read zero unless built with ALLOC_TRACKING.
+
+#include "map.hpp"
+#include "item.hpp"
+#include "dice.hpp"
+#include "hero.hpp"
+#include "archeologist.hpp"
+#include "mayor.hpp"
+#include "courier.hpp"
+#include "scientist.hpp"
+#include "dracula.hpp"
+#include "invisibleman.hpp"
+#include "villagermanager.hpp"
+#include "monstermanager.hpp"
+#include "frenzymarker.hpp"
+#include "terrorteracker.hpp"
+#include "taskboard.hpp"
+#include "perkdeck.hpp"
+#include "gamestate.hpp"
+#include "alloctracker.hpp"
+#include "gamearena.hpp"
+#include "rules.hpp"
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+constexpr size_t phaseCount = static_cast<size_t>(AllocPhase::Count);
+
+struct BenchResult {
+    string name;
+    size_t iterations;
+    double nsPerOp;
+    double allocsPerOp;
+    double bytesPerOp;
+    array<double, phaseCount> phaseAllocsPerOp;
+};
+
+// Accumulates measured regions for one benchmark; setup outside measure() is not counted
+class BenchTimer {
+public:
+    template <typename F>
+    void measure(F&& body) {
+        AllocTracker::reset();
+        AllocTracker::setEnabled(true);
+        auto start = chrono::steady_clock::now();
+        body();
+        auto end = chrono::steady_clock::now();
+        AllocTracker::setEnabled(false);
+        totalNs += chrono::duration<double, nano>(end - start).count();
+        AllocStats total = AllocTracker::getTotal();
+        totalAllocs += total.allocations;
+        totalBytes += total.bytes;
+        for (size_t i = 0; i < phaseCount; ++i) {
+            phaseAllocs[i] += AllocTracker::getStats(static_cast<AllocPhase>(i)).allocations;
+        }
+        ++ops;
+    }
+
+    BenchResult result(const string& name) const {
+        double n = ops ? static_cast<double>(ops) : 1.0;
+        BenchResult r{name, ops, totalNs / n, totalAllocs / n, totalBytes / n, {}};
+        for (size_t i = 0; i < phaseCount; ++i) {
+            r.phaseAllocsPerOp[i] = phaseAllocs[i] / n;
+        }
+        return r;
+    }
+
+private:
+    double totalNs = 0;
+    double totalAllocs = 0;
+    double totalBytes = 0;
+    array<double, phaseCount> phaseAllocs{};
+    size_t ops = 0;
+};
+
+// A complete board in the same starting position as a new TUI game
+struct GameFixture {
+    Map map;
+    VillagerManager villagerManager;
+    TerrorTracker terrorTracker;
+    TaskBoard taskBoard;
+    PerkDeck perkDeck;
+    MonsterManager monsterManager;
+    unique_ptr<ItemBag> itemBag;
+    unique_ptr<Archeologist> archeologist;
+    unique_ptr<Mayor> mayor;
+    unique_ptr<Dracula> dracula;
+    unique_ptr<InvisibleMan> invisibleMan;
+    unique_ptr<FrenzyMarker> frenzyMarker;
+
+    explicit GameFixture(unsigned int seed) {
+        srand(seed);
+        Dice::setFixedSeed(seed);
+        monsterManager.seed(seed);
+        perkDeck.seed(seed);
+
+        itemBag = make_unique<ItemBag>(map);
+        for (const auto& [name, location] : map.locations) {
+            location->clearItems();
+        }
+        itemBag->seed(seed);
+        itemBag->refillItems(map);
+        for (int i = 0; i < 12; ++i) {
+            itemBag->drawRandomItem(map);
+        }
+
+        archeologist = make_unique<Archeologist>("Player1", map.getLocation("Docks"));
+        mayor = make_unique<Mayor>("Player2", map.getLocation("Theatre"));
+        dracula = make_unique<Dracula>(map.getLocation("Crypt"));
+        invisibleMan = make_unique<InvisibleMan>(map.getLocation("Inn"));
+        frenzyMarker = make_unique<FrenzyMarker>(dracula.get(), invisibleMan.get());
+    }
+
+    // Villagers are normally placed by monster cards, so only the save benchmark does this
+    void placeVillagers() {
+        placeVillager("Dr.Cranley", "Laboratory");
+        placeVillager("Maleva", "Camp");
+        placeVillager("Fritz", "Tower");
+        placeVillager("Maria", "Barn");
+    }
+
+    void clearVillagers() {
+        for (const auto& villager : villagerManager.getAllVillagers()) {
+            if (villager && villager->getCurrentLocation()) {
+                villager->getCurrentLocation()->removeCharacter(villager->getVillagerName());
+            }
+        }
+    }
+
+    void placeVillager(const string& name, const string& locationName) {
+        auto location = map.getLocation(locationName);
+        location->addCharacter(name);
+        villagerManager.addVillager(name, location);
+    }
+};
+
+struct BenchOptions {
+    size_t iterations = 2000;
+    unsigned int seed = 12345;
+    string format = "table";
+    string outFile;
+    string filter;
+    bool phases = false;
+};
+
+// Engine code logs every move to cout; discard it while benchmarks run
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return traits_type::not_eof(c); }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+class SilenceCout {
+public:
+    SilenceCout() : saved(cout.rdbuf(&sink)) {}
+    ~SilenceCout() { cout.rdbuf(saved); }
+private:
+    NullBuffer sink;
+    streambuf* saved;
+};
+
+static BenchResult benchCalculateDistance(const BenchOptions& options) {
+    Map map;
+    auto from = map.getLocation("Docks");
+    auto to = map.getLocation("Tower");
+    BenchTimer timer;
+    volatile int sink = 0;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        timer.measure([&] { sink = map.calculateDistance(from, to); });
+    }
+    return timer.result("Map::calculateDistance");
+}
+
+static BenchResult benchFindCloserLocation(const BenchOptions& options) {
+    Map map;
+    auto from = map.getLocation("Docks");
+    auto to = map.getLocation("Tower");
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        timer.measure([&] { auto next = map.findCloserLocation(from, to); });
+    }
+    return timer.result("Map::findCloserLocation");
+}
+
+static BenchResult benchMoveToNearestCharacter(const BenchOptions& options) {
+    Map map;
+    auto crypt = map.getLocation("Crypt");
+    auto docks = map.getLocation("Docks");
+    docks->addCharacter("Maria");
+    Dracula dracula(crypt);
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        timer.measure([&] { dracula.moveToNearestCharacter("*", 1); });
+        dracula.getCurrentLocation()->removeCharacter("Dracula");
+        crypt->addCharacter("Dracula");
+        dracula.setCurrentLocation(crypt);
+    }
+    return timer.result("Monster::moveToNearestCharacter");
+}
+
+static BenchResult benchMoveTowardsVillager(const BenchOptions& options) {
+    Map map;
+    auto inn = map.getLocation("Inn");
+    auto tower = map.getLocation("Tower");
+    tower->addCharacter("Fritz");
+    InvisibleMan invisibleMan(inn);
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        timer.measure([&] { invisibleMan.moveTowardsVillager(2); });
+        invisibleMan.getCurrentLocation()->removeCharacter("Invisible man");
+        inn->addCharacter("Invisible man");
+        invisibleMan.setCurrentLocation(inn);
+    }
+    return timer.result("InvisibleMan::moveTowardsVillager");
+}
+
+static BenchResult benchRefillItems(const BenchOptions& options) {
+    Map map;
+    ItemBag itemBag(map);
+    itemBag.seed(options.seed);
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        timer.measure([&] { itemBag.refillItems(map); });
+    }
+    return timer.result("ItemBag::refillItems");
+}
+
+static BenchResult benchLocationWithMostItems(const BenchOptions& options) {
+    Map map;
+    ItemBag itemBag(map);
+    itemBag.seed(options.seed);
+    itemBag.refillItems(map);
+    itemBag.refillItems(map);
+    shared_ptr<Location> sink;
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        timer.measure([&] { sink = map.getLocationWithMostItems(); });
+    }
+    return timer.result("Map::getLocationWithMostItems");
+}
+
+static BenchResult benchDrawCard(const BenchOptions& options) {
+    MonsterManager monsterManager;
+    monsterManager.seed(options.seed);
+    const vector<MonsterCard> fullDeck = monsterManager.getCards();
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        if (monsterManager.isEmpty()) {
+            monsterManager.setCards(fullDeck);
+        }
+        timer.measure([&] { MonsterCard card = monsterManager.drawCard(); });
+    }
+    return timer.result("MonsterManager::drawCard");
+}
+
+static BenchResult benchMonsterPhase(const BenchOptions& options) {
+    BenchTimer timer;
+    vector<string> diceResults;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        GameFixture game(options.seed + static_cast<unsigned int>(i));
+        timer.measure([&] {
+            AllocPhaseScope allocScope(AllocPhase::MonsterPhase);
+            auto phase = game.monsterManager.MonsterPhase(game.map, *game.itemBag, game.dracula.get(), game.invisibleMan.get(),
+                *game.frenzyMarker, game.archeologist.get(), game.terrorTracker,
+                HeroRoster(game.archeologist.get(), game.mayor.get()), game.villagerManager, diceResults,
+                &game.perkDeck, game.archeologist.get(), game.mayor.get());
+            // Attacked heroes always defend with their first item
+            phase.start();
+            while (!phase.done()) {
+                phase.resume(0);
+            }
+            phase.result();
+        });
+    }
+    return timer.result("MonsterManager::MonsterPhase");
+}
+
+static BenchResult benchOnTheMove(const BenchOptions& options) {
+    GameFixture game(options.seed);
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        game.clearVillagers();
+        game.placeVillagers();
+        timer.measure([&] {
+            game.monsterManager.moveVillagersCloserToSafePlaces(game.map, game.villagerManager);
+        });
+    }
+    return timer.result("MonsterManager::OnTheMove");
+}
+
+static BenchResult benchGameStateRoundTrip(const BenchOptions& options) {
+    GameFixture game(options.seed);
+    game.placeVillagers();
+    string path = (filesystem::temp_directory_path() / "horrified_bench.sav").string();
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        timer.measure([&] {
+            GameState state;
+            state.setPlayerInfo("Player1", "Player2", "Player1", "Player2", "Archeologist", "Mayor", 1, 2);
+            state.setGameState(1, game.terrorTracker.getLevel(), true);
+            state.setCurrentHeroIndex(0);
+            state.setHeroState(game.archeologist.get(), true);
+            state.setHeroState(game.mayor.get(), false);
+            state.setMonsterState(game.dracula.get(), true);
+            state.setMonsterState(game.invisibleMan.get(), false);
+            state.setVillagerStates(game.villagerManager);
+            state.setItemStates(*game.itemBag, game.map);
+            state.setMapState(game.map);
+            state.setTaskBoardState(game.taskBoard);
+            state.setMonsterManagerState(game.monsterManager);
+            state.setPerkDeckState(game.perkDeck);
+            state.setFrenzyMarkerState(*game.frenzyMarker);
+            state.saveToFile(path);
+
+            GameState loaded;
+            loaded.loadFromFile(path);
+        });
+    }
+    filesystem::remove(path);
+    return timer.result("GameState::saveToFile+loadFromFile");
+}
+
+static string phaseKey(AllocPhase phase) {
+    string key = AllocTracker::phaseName(phase);
+    for (auto& c : key) {
+        c = (c == ' ') ? '_' : static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    }
+    return key;
+}
+
+// Board setup and teardown, either on the global heap or carved from a per-game arena
+static void setUpBoard(Map& map, VillagerManager& villagerManager) {
+    auto camp = map.getLocation("Camp");
+    camp->addCharacter("Maleva");
+    villagerManager.addVillager("Maleva", camp);
+    auto barn = map.getLocation("Barn");
+    barn->addCharacter("Maria");
+    villagerManager.addVillager("Maria", barn);
+}
+
+static BenchResult benchGameSetup(const BenchOptions& options) {
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        timer.measure([&] {
+            Map map;
+            VillagerManager villagerManager;
+            setUpBoard(map, villagerManager);
+            auto archeologist = make_unique<Archeologist>("Player1", map.getLocation("Docks"));
+            auto dracula = make_unique<Dracula>(map.getLocation("Crypt"));
+        });
+    }
+    return timer.result("GameSetup (heap)");
+}
+
+static BenchResult benchGameSetupArena(const BenchOptions& options) {
+    BenchTimer timer;
+    for (size_t i = 0; i < options.iterations; ++i) {
+        timer.measure([&] {
+            GameArena gameArena;
+            Map map(gameArena.resource());
+            VillagerManager villagerManager(gameArena.resource());
+            setUpBoard(map, villagerManager);
+            auto archeologist = gameArena.makeUnique<Archeologist>("Player1", map.getLocation("Docks"));
+            auto dracula = gameArena.makeUnique<Dracula>(map.getLocation("Crypt"));
+        });
+    }
+    return timer.result("GameSetup (arena)");
+}
+
+static void printTable(ostream& out, const vector<BenchResult>& results, const BenchOptions& options) {
+    out << "rules: " << RULESET_NAME << "\n";
+    out << "benchmark                               iterations        ns/op   allocs/op    bytes/op\n";
+    for (const auto& r : results) {
+        char line[256];
+        snprintf(line, sizeof(line), "%-38s %11zu %12.1f %11.1f %11.1f\n",
+                 r.name.c_str(), r.iterations, r.nsPerOp, r.allocsPerOp, r.bytesPerOp);
+        out << line;
+        if (!options.phases) continue;
+        for (size_t i = 0; i < phaseCount; ++i) {
+            if (r.phaseAllocsPerOp[i] == 0) continue;
+            snprintf(line, sizeof(line), "    %-34s %36.1f\n",
+                     AllocTracker::phaseName(static_cast<AllocPhase>(i)).c_str(), r.phaseAllocsPerOp[i]);
+            out << line;
+        }
+    }
+    if (!AllocTracker::isCompiledIn()) {
+        out << "(built without ALLOC_TRACKING: allocation columns are zero)\n";
+    }
+}
+
+static void printCsv(ostream& out, const vector<BenchResult>& results) {
+    out << "name,iterations,ns_per_op,allocs_per_op,bytes_per_op";
+    for (size_t i = 0; i < phaseCount; ++i) {
+        out << ",allocs_" << phaseKey(static_cast<AllocPhase>(i));
+    }
+    out << '\n';
+    for (const auto& r : results) {
+        out << r.name << ',' << r.iterations << ',' << r.nsPerOp << ',' << r.allocsPerOp << ',' << r.bytesPerOp;
+        for (size_t i = 0; i < phaseCount; ++i) {
+            out << ',' << r.phaseAllocsPerOp[i];
+        }
+        out << '\n';
+    }
+}
+
+static void printJson(ostream& out, const vector<BenchResult>& results, const BenchOptions& options) {
+    out << "{\n  \"rules\": \"" << RULESET_NAME << "\",\n  \"seed\": " << options.seed << ",\n  \"alloc_tracking\": "
+        << (AllocTracker::isCompiledIn() ? "true" : "false") << ",\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations
+            << ", \"ns_per_op\": " << r.nsPerOp << ", \"allocs_per_op\": " << r.allocsPerOp
+            << ", \"bytes_per_op\": " << r.bytesPerOp << ", \"allocs_by_phase\": {";
+        for (size_t j = 0; j < phaseCount; ++j) {
+            out << (j ? ", " : "") << "\"" << phaseKey(static_cast<AllocPhase>(j)) << "\": " << r.phaseAllocsPerOp[j];
+        }
+        out << "}}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+static bool parseOptions(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        auto value = [&](const string& prefix) { return arg.substr(prefix.size()); };
+        try {
+            if (arg.rfind("--iterations=", 0) == 0) options.iterations = stoul(value("--iterations="));
+            else if (arg.rfind("--seed=", 0) == 0) options.seed = static_cast<unsigned int>(stoul(value("--seed=")));
+            else if (arg.rfind("--format=", 0) == 0) options.format = value("--format=");
+            else if (arg.rfind("--out=", 0) == 0) options.outFile = value("--out=");
+            else if (arg.rfind("--filter=", 0) == 0) options.filter = value("--filter=");
+            else if (arg == "--phases") options.phases = true;
+            else {
+                cerr << "Unknown option: " << arg << endl;
+                return false;
+            }
+        } catch (const exception& e) {
+            cerr << "Invalid value for " << arg << endl;
+            return false;
+        }
+    }
+    if (options.format != "table" && options.format != "json" && options.format != "csv") {
+        cerr << "Unknown format: " << options.format << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        cerr << "Usage: benchmark [--iterations=N] [--seed=N] [--format=table|json|csv] [--out=FILE] [--filter=NAME] [--phases]" << endl;
+        return 1;
+    }
+
+    vector<pair<string, function<BenchResult(const BenchOptions&)>>> benchmarks = {
+        {"calculateDistance", benchCalculateDistance},
+        {"findCloserLocation", benchFindCloserLocation},
+        {"moveToNearestCharacter", benchMoveToNearestCharacter},
+        {"moveTowardsVillager", benchMoveTowardsVillager},
+        {"refillItems", benchRefillItems},
+        {"locationWithMostItems", benchLocationWithMostItems},
+        {"drawCard", benchDrawCard},
+        {"MonsterPhase", benchMonsterPhase},
+        {"OnTheMove", benchOnTheMove},
+        {"GameState", benchGameStateRoundTrip},
+        {"GameSetup", benchGameSetup},
+        {"GameSetupArena", benchGameSetupArena}
+    };
+
+    vector<BenchResult> results;
+    {
+        SilenceCout silence;
+        for (const auto& [key, run] : benchmarks) {
+            if (!options.filter.empty() && key.find(options.filter) == string::npos) continue;
+            try {
+                results.push_back(run(options));
+            } catch (const exception& e) {
+                cerr << "Benchmark " << key << " failed: " << e.what() << endl;
+            }
+        }
+    }
+
+    ofstream file;
+    if (!options.outFile.empty()) {
+        file.open(options.outFile);
+        if (!file) {
+            cerr << "Cannot open " << options.outFile << endl;
+            return 1;
+        }
+    }
+    ostream& out = options.outFile.empty() ? cout : file;
+
+    if (options.format == "json") printJson(out, results, options);
+    else if (options.format == "csv") printCsv(out, results);
+    else printTable(out, results, options);
+
+    return 0;
+}
@@ -1,8 +1,9 @@
 #include "courier.hpp"
+#include "rules.hpp"
 
 using namespace std;
 
-Courier::Courier(const string& playerName, shared_ptr<Location> startingLocation) : Hero(playerName, "Courier", 4, startingLocation) {}
+Courier::Courier(const string& playerName, shared_ptr<Location> startingLocation) : Hero(playerName, HeroKind::Courier, Rules::COURIER_ACTIONS, startingLocation) {}
 
 void Courier::setOtherHero(Hero* otherHero) {
     this->otherHero = otherHero;
@@ -12,33 +13,21 @@ void Courier::specialAction() {
     if (remainingActions <= 0) {
         throw invalid_argument("No remaining actions.");
     }
+    if (!otherHero) {
+        throw invalid_argument("Other hero is not set.");
+    }
 
-    string answer;
-    if (otherHero) {
-        while (true) {
-            cout << "Do you want to move to " << otherHero->getCurrentLocation()->getName() << "(Yes or No)? ";
-            getline(cin, answer);
-            answer = toSentenceCase(answer);
-            if (answer == "No") break;
-            if (answer == "Yes") {
-                auto otherHeroLocation = otherHero->getCurrentLocation();
-                try {
-                    currentLocation->removeCharacter(heroName);
-                    otherHeroLocation->addCharacter(heroName);
-                    setCurrentLocation(otherHeroLocation);
+    auto otherHeroLocation = otherHero->getCurrentLocation();
+    try {
+        currentLocation->removeCharacter(heroName);
+        otherHeroLocation->addCharacter(heroName);
+        setCurrentLocation(otherHeroLocation);
 
-                    cout << heroName << " (" << playerName << ") moved to " << currentLocation->getName() << ".\n";
-                } catch (const exception& e) {
-                    cout << e.what() << endl;
-                }
-                remainingActions--;
-                break;
-            }
-            cout << "Invalid answer. Please try again" << endl;
-        }
-    } else {
-        throw invalid_argument("Other hero is not set.");
+        cout << heroName << " (" << playerName << ") moved to " << currentLocation->getName() << ".\n";
+    } catch (const exception& e) {
+        cout << e.what() << endl;
     }
+    remainingActions--;
 }
 
 void Courier::ability(size_t index) {
@@ -7,9 +7,9 @@ class Courier : public Hero {
 public:
     Courier(const std::string& playerName, std::shared_ptr<Location> startingLocation);
 
-    void setOtherHero(Hero* otherHero) override;
-    void specialAction() override;
-    void ability(size_t index) override;
+    void setOtherHero(Hero* otherHero);
+    void specialAction();
+    void ability(size_t index);
 private:
     Hero* otherHero = nullptr;
 };
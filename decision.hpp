@@ -0,0 +1,176 @@
+#ifndef DECISION_HPP
+#define DECISION_HPP
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "item.hpp"
+
+class Hero;
+
+enum class DecisionType {
+    Defend      // options = the attacked hero's items; DECLINE sends the hero to the Hospital
+};
+
+// A choice the rules need from a player while the engine is running. The
+// engine suspends on it; whichever front end or bot answers resumes it.
+struct Decision {
+    static constexpr int DECLINE = -1;
+
+    DecisionType type = DecisionType::Defend;
+    Hero* hero = nullptr;
+    std::vector<Item> options;
+};
+
+// Shared by a chain of DecisionTasks: the decision the innermost one waits on
+// and the coroutine to resume with the answer
+struct DecisionSlot {
+    const Decision* pending = nullptr;
+    std::coroutine_handle<> waiting;
+    int answer = Decision::DECLINE;
+};
+
+// Suspends the calling DecisionTask until the decision is answered;
+// co_await gives back the chosen option index or Decision::DECLINE
+class DecisionAwaiter {
+public:
+    explicit DecisionAwaiter(Decision decision) : decision(std::move(decision)) {}
+
+    bool await_ready() const noexcept { return false; }
+    template <typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+        slot = handle.promise().slot;
+        slot->pending = &decision;
+        slot->waiting = handle;
+    }
+    int await_resume() noexcept {
+        slot->pending = nullptr;
+        return slot->answer;
+    }
+
+private:
+    Decision decision;
+    DecisionSlot* slot = nullptr;
+};
+
+inline DecisionAwaiter ask(Decision decision) {
+    return DecisionAwaiter(std::move(decision));
+}
+
+struct DecisionPromiseBase {
+    DecisionSlot ownSlot;
+    DecisionSlot* slot = &ownSlot;      // the outermost task's slot
+    std::coroutine_handle<> continuation;
+    std::exception_ptr error;
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+
+    // A finished task goes straight back to the task awaiting it
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+            auto continuation = handle.promise().continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+};
+
+template <typename T>
+struct DecisionPromise : DecisionPromiseBase {
+    T value{};
+    void return_value(T result) { value = std::move(result); }
+};
+
+template <>
+struct DecisionPromise<void> : DecisionPromiseBase {
+    void return_void() {}
+};
+
+// Engine code that may need a player's choice. It starts suspended; start()
+// runs it until it finishes or waits on a Decision, and resume() answers
+// that decision. A DecisionTask co_awaited by another one shares its
+// Decision, so the outermost task is the only one a front end sees.
+template <typename T>
+class DecisionTask {
+public:
+    struct promise_type : DecisionPromise<T> {
+        DecisionTask get_return_object() {
+            return DecisionTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+    };
+    using Handle = std::coroutine_handle<promise_type>;
+
+    DecisionTask() = default;
+    DecisionTask(DecisionTask&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+    DecisionTask& operator=(DecisionTask&& other) noexcept {
+        if (this != &other) {
+            if (handle) handle.destroy();
+            handle = std::exchange(other.handle, {});
+        }
+        return *this;
+    }
+    DecisionTask(const DecisionTask&) = delete;
+    DecisionTask& operator=(const DecisionTask&) = delete;
+    ~DecisionTask() {
+        if (handle) handle.destroy();
+    }
+
+    explicit operator bool() const { return static_cast<bool>(handle); }
+    bool done() const { return !handle || handle.done(); }
+    const Decision* pendingDecision() const {
+        return handle && !handle.done() ? handle.promise().slot->pending : nullptr;
+    }
+
+    void start() {
+        handle.resume();
+    }
+    void resume(int answer) {
+        DecisionSlot* slot = handle.promise().slot;
+        std::coroutine_handle<> waiting = std::exchange(slot->waiting, {});
+        slot->answer = answer;
+        waiting.resume();
+    }
+
+    // Once done: rethrows what the task threw, or returns its value
+    T result() {
+        if (handle.promise().error) {
+            std::rethrow_exception(handle.promise().error);
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(handle.promise().value);
+        }
+    }
+
+    // Awaiting a task runs it inside the awaiting one
+    struct Awaiter {
+        Handle child;
+        bool await_ready() const noexcept { return false; }
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> parent) noexcept {
+            child.promise().slot = parent.promise().slot;
+            child.promise().continuation = parent;
+            return child;
+        }
+        T await_resume() {
+            if (child.promise().error) {
+                std::rethrow_exception(child.promise().error);
+            }
+            if constexpr (!std::is_void_v<T>) {
+                return std::move(child.promise().value);
+            }
+        }
+    };
+    Awaiter operator co_await() && noexcept { return Awaiter{handle}; }
+
+private:
+    explicit DecisionTask(Handle handle) : handle(handle) {}
+    Handle handle;
+};
+
+#endif
@@ -1,14 +1,29 @@
 #include "dice.hpp"
+#include "rules.hpp"
 #include <chrono>
 
 using namespace std;
 
-Dice::Dice() : rng(chrono::steady_clock::now().time_since_epoch().count()), dist(0, 5) {}
+unsigned int Dice::fixedSeed = 0;
+bool Dice::useFixedSeed = false;
+
+Dice::Dice() : dist(0, Rules::DICE_SIDES - 1) {
+    if (useFixedSeed) {
+        rng.seed(fixedSeed++);
+    } else {
+        rng.seed(chrono::steady_clock::now().time_since_epoch().count());
+    }
+}
+
+void Dice::setFixedSeed(unsigned int seed) {
+    fixedSeed = seed;
+    useFixedSeed = true;
+}
 
 DiceFace Dice::roll() {
     int roll = dist(rng);
     if (roll == 0) return DiceFace::Power; 
-    else if (roll == 5) return DiceFace::Strike; 
+    else if (roll == Rules::DICE_SIDES - 1) return DiceFace::Strike; 
     else return DiceFace::Empty;
 }
 
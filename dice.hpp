@@ -15,9 +15,12 @@ class Dice {
 private:
     std::mt19937 rng;
     std::uniform_int_distribution<int> dist;
+    static unsigned int fixedSeed;
+    static bool useFixedSeed;
 public:
     Dice();
 
+    static void setFixedSeed(unsigned int seed);
     DiceFace roll();
     static std::string faceToString(DiceFace face);
 };
@@ -4,20 +4,19 @@
 
 using namespace std;
 
-Dracula::Dracula(shared_ptr<Location> startingLocation) : Monster("Dracula", startingLocation) {
+Dracula::Dracula(shared_ptr<Location> startingLocation) : Monster(MonsterKind::Dracula, startingLocation) {
     powerName = "Dark Charm";
 }
 
 void Dracula::power(Hero* hero, TerrorTracker& terrorTracker, VillagerManager& villagerManager) {
     if (currentLocation == hero->getCurrentLocation()) return;
-    try {
-        auto heroLocation = hero->getCurrentLocation();
-        heroLocation->removeCharacter(hero->getHeroName());
-        currentLocation->addCharacter(hero->getHeroName());
-        hero->setCurrentLocation(currentLocation);
-        
-        cout << hero->getPlayerName() << " (" << hero->getHeroName() << ") moved to " << hero->getCurrentLocation()->getName() << ".\n";
-    } catch (const exception& e) {
-        cout << e.what() << endl;
+    if (!hero->getCurrentLocation()->tryRemoveCharacter(hero->getHeroName())) {
+        cout << hero->getHeroName() << " is not on the board.\n";
+        return;
     }
+    currentLocation->tryAddCharacter(hero->getHeroName());
+    hero->setCurrentLocation(currentLocation);
+    publishEvent(GameEventType::MonsterPower, hero->getHeroName(), currentLocation->getName());
+    
+    cout << hero->getPlayerName() << " (" << hero->getHeroName() << ") moved to " << hero->getCurrentLocation()->getName() << ".\n";
 }
\ No newline at end of file
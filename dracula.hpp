@@ -11,7 +11,7 @@ private:
 
 public:
     Dracula(std::shared_ptr<Location> startingLocation);
-    void power(Hero* hero, TerrorTracker& terrorTracker, VillagerManager& villagerManager) override;
+    void power(Hero* hero, TerrorTracker& terrorTracker, VillagerManager& villagerManager);
 };
 
 #endif
\ No newline at end of file
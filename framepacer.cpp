@@ -0,0 +1,104 @@
+#include "framepacer.hpp"
+#include <raylib.h>
+#include <cstdio>
+
+using namespace std;
+
+FramePacer::FramePacer()
+    : idle(false), lastActivityTime(GetTime()), sampleStartTime(GetTime()), sampleStartCpu(clock()),
+      cpuUsage(0.0f), frameCount(0), framesLastSecond(0) {
+    SetTargetFPS(ACTIVE_FPS);
+}
+
+void FramePacer::endFrame(bool busy) {
+    double now = GetTime();
+
+    frameCount++;
+    if (now - sampleStartTime >= 1.0) {
+        clock_t cpuNow = clock();
+        double cpuSeconds = (double)(cpuNow - sampleStartCpu) / CLOCKS_PER_SEC;
+        cpuUsage = (float)(cpuSeconds / (now - sampleStartTime) * 100.0);
+        framesLastSecond = (int)(frameCount / (now - sampleStartTime) + 0.5);
+        sampleStartTime = now;
+        sampleStartCpu = cpuNow;
+        frameCount = 0;
+    }
+
+    if (busy || inputArrived()) {
+        lastActivityTime = now;
+        if (idle) {
+            DisableEventWaiting();
+            idle = false;
+        }
+    } else if (!idle && now - lastActivityTime >= IDLE_DELAY) {
+        // EndDrawing() now blocks until the next input event instead of ticking at 60 FPS
+        EnableEventWaiting();
+        idle = true;
+    }
+}
+
+bool FramePacer::isIdle() const {
+    return idle;
+}
+
+float FramePacer::getCpuUsage() const {
+    return cpuUsage;
+}
+
+int FramePacer::getFramesLastSecond() const {
+    return framesLastSecond;
+}
+
+// Only safe once the screen handled its input: GetKeyPressed() drains the key queue
+bool FramePacer::inputArrived() {
+    Vector2 mouseDelta = GetMouseDelta();
+    return GetKeyPressed() != 0
+        || mouseDelta.x != 0.0f || mouseDelta.y != 0.0f
+        || GetMouseWheelMove() != 0.0f
+        || IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsMouseButtonDown(MOUSE_BUTTON_RIGHT)
+        || IsWindowResized();
+}
+
+void FrameTimeHistogram::record(float seconds) {
+    float ms = seconds * 1000.0f;
+    int bucket = 0;
+    while (bucket < BUCKET_COUNT - 1 && ms >= BUCKET_LIMITS_MS[bucket]) {
+        bucket++;
+    }
+    counts[bucket]++;
+    if (ms > worstMs) worstMs = ms;
+}
+
+void FrameTimeHistogram::reset() {
+    counts.fill(0);
+    worstMs = 0.0f;
+}
+
+int FrameTimeHistogram::getCount(int bucket) const {
+    return counts[bucket];
+}
+
+int FrameTimeHistogram::getTotal() const {
+    int total = 0;
+    for (int count : counts) total += count;
+    return total;
+}
+
+float FrameTimeHistogram::getWorstMs() const {
+    return worstMs;
+}
+
+string FrameTimeHistogram::summary() const {
+    string text;
+    char part[32];
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        if (i < BUCKET_COUNT - 1) {
+            snprintf(part, sizeof(part), "<%.0f:%d ", BUCKET_LIMITS_MS[i], counts[i]);
+        } else {
+            snprintf(part, sizeof(part), "%.0f+:%d ", BUCKET_LIMITS_MS[i - 1], counts[i]);
+        }
+        text += part;
+    }
+    snprintf(part, sizeof(part), "worst %.1fms", worstMs);
+    return text + part;
+}
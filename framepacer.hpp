@@ -0,0 +1,57 @@
+#ifndef FRAMEPACER_HPP
+#define FRAMEPACER_HPP
+
+#include <array>
+#include <ctime>
+#include <string>
+
+// Runs the window at full rate while something is happening and lets raylib
+// sleep on input events once the screen has been still for a moment.
+class FramePacer {
+public:
+    static const int ACTIVE_FPS = 60;
+    static constexpr double IDLE_DELAY = 1.0;  // seconds without input or timers before idling
+
+    FramePacer();
+
+    // Call once per frame after input has been handled, before EndDrawing().
+    // busy means the screen has timers or animations that need frames.
+    void endFrame(bool busy);
+
+    bool isIdle() const;
+    float getCpuUsage() const;      // percent of one core, averaged over the last second
+    int getFramesLastSecond() const;
+
+private:
+    bool idle;
+    double lastActivityTime;
+    double sampleStartTime;
+    std::clock_t sampleStartCpu;
+    float cpuUsage;
+    int frameCount;
+    int framesLastSecond;
+
+    static bool inputArrived();
+};
+
+// Counts frame times into fixed millisecond buckets, for spotting hitches.
+class FrameTimeHistogram {
+public:
+    static const int BUCKET_COUNT = 6;
+    static constexpr std::array<float, BUCKET_COUNT - 1> BUCKET_LIMITS_MS = {8.0f, 17.0f, 25.0f, 34.0f, 50.0f};
+
+    void record(float seconds);
+    void reset();
+
+    int getCount(int bucket) const;
+    int getTotal() const;
+    float getWorstMs() const;
+    // e.g. "<8:12 <17:940 <25:3 <34:0 <50:0 50+:0 worst 21.4ms"
+    std::string summary() const;
+
+private:
+    std::array<int, BUCKET_COUNT> counts = {};
+    float worstMs = 0.0f;
+};
+
+#endif
@@ -12,6 +12,7 @@
 #include "monstermanager.hpp"
 #include "frenzymarker.hpp"
 #include "terrorteracker.hpp"
+#include "rules.hpp"
 #include "perkdeck.hpp"
 #include "taskboard.hpp"
 #include "TUI.hpp"
@@ -19,6 +20,8 @@
 #include "scientist.hpp"
 #include "gamestate.hpp"
 #include "savemanager.hpp"
+#include "gameevents.hpp"
+#include "gameengine.hpp"
 #include <iostream>
 #include <random>
 #include <chrono>
@@ -30,7 +33,42 @@ using namespace std;
 
 Game::Game() : saveManager(std::make_unique<SaveManager>()) {}
 
+void Game::enableBatchMode(const BatchOptions& options) {
+    batch = std::make_unique<BatchSession>(options);
+    tui.setBatchMode(true);
+}
+
+void Game::recordBatchTurn(int turnCount, const Hero* hero, const TerrorTracker& terrorTracker, const TaskBoard& taskBoard,
+                           const VillagerManager& villagerManager, const vector<GameEvent>& events) {
+    if (!batch) return;
+    BatchTurn turn;
+    turn.turn = turnCount;
+    turn.hero = hero ? hero->getHeroName() : "";
+    turn.terror = terrorTracker.getLevel();
+    turn.draculaDefeated = taskBoard.isDraculaDefeated();
+    turn.invisibleManDefeated = taskBoard.isInvisibleManDefeated();
+    turn.villagersRescued = villagerManager.getRescued().count();
+    for (const auto& event : events) {
+        turn.events.push_back(event.describe());
+    }
+    batch->recordTurn(turn);
+}
+
+void Game::finishBatchGame(const string& outcome, int turnCount, const Hero* hero, const TerrorTracker& terrorTracker,
+                           const TaskBoard& taskBoard, const VillagerManager& villagerManager) {
+    if (!batch) return;
+    BatchTurn last;
+    last.turn = turnCount;
+    last.hero = hero ? hero->getHeroName() : "";
+    last.terror = terrorTracker.getLevel();
+    last.draculaDefeated = taskBoard.isDraculaDefeated();
+    last.invisibleManDefeated = taskBoard.isInvisibleManDefeated();
+    last.villagersRescued = villagerManager.getRescued().count();
+    batch->finishGame(outcome, last);
+}
+
 void Game::play() {
+    if (batch) batch->startGame();
     tui.clearScreen();
     TerrorTracker terrorTracker;
     string player1Name, player2Name, startingPlayerName, otherPlayerName, startingPlayerHero, otherPlayerHero;
@@ -131,13 +169,15 @@ void Game::play() {
         break;
     }
 
-    Map gamemap;
+    GameArena gameArena;
+    Map gamemap(gameArena.resource());
     TaskBoard taskBoard;
-    VillagerManager villagerManager;
+    VillagerManager villagerManager(gameArena.resource());
     ItemBag itembag(gamemap);
     MonsterManager monsterManager;
     PerkDeck perkDeck;
 
+
     villagerManager.addVillager("Dr.Cranley", gamemap.getLocation("Laboratory")); 
     villagerManager.addVillager("Dr.Reed", gamemap.getLocation("Institute"));
     villagerManager.addVillager("Prof.Pearson", gamemap.getLocation("Cave"));
@@ -146,12 +186,12 @@ void Game::play() {
     villagerManager.addVillager("Wilbur And Chick", gamemap.getLocation("Docks"));
     villagerManager.addVillager("Maria", gamemap.getLocation("Barn"));   
 
-    unique_ptr<Hero> mayor;
-    unique_ptr<Hero> archeologist;
-    unique_ptr<Hero> courier;
-    unique_ptr<Hero> scientist;
-    unique_ptr<Monster> dracula;
-    unique_ptr<Monster> invisibleMan;
+    ArenaPtr<Hero> mayor;
+    ArenaPtr<Hero> archeologist;
+    ArenaPtr<Hero> courier;
+    ArenaPtr<Hero> scientist;
+    ArenaPtr<Monster> dracula;
+    ArenaPtr<Monster> invisibleMan;
     Hero* currentHero = nullptr;
     Hero* otherHero = nullptr;
     try {
@@ -161,37 +201,37 @@ void Game::play() {
         auto institute = gamemap.getLocation("Institute");
 
         if (startingPlayerHero == "Archeologist") {
-            archeologist = make_unique<Archeologist>(startingPlayerName, docks);
+            archeologist = gameArena.makeUnique<Archeologist>(startingPlayerName, docks);
             currentHero = archeologist.get();
         } else if (startingPlayerHero == "Mayor") {
-            mayor = make_unique<Mayor>(startingPlayerName, theatre);
+            mayor = gameArena.makeUnique<Mayor>(startingPlayerName, theatre);
             currentHero = mayor.get();
         } else if (startingPlayerHero == "Courier") {
-            courier = make_unique<Courier>(startingPlayerName, shop);
+            courier = gameArena.makeUnique<Courier>(startingPlayerName, shop);
             currentHero = courier.get();
         } else if (startingPlayerHero == "Scientist") {
-            scientist = make_unique<Scientist>(startingPlayerName, institute);
+            scientist = gameArena.makeUnique<Scientist>(startingPlayerName, institute);
             currentHero = scientist.get();
         }
 
         if (otherPlayerHero == "Archeologist") {
-            archeologist = make_unique<Archeologist>(otherPlayerName, docks);
+            archeologist = gameArena.makeUnique<Archeologist>(otherPlayerName, docks);
             otherHero = archeologist.get();
         } else if (otherPlayerHero == "Mayor") {
-            mayor = make_unique<Mayor>(otherPlayerName, theatre);
+            mayor = gameArena.makeUnique<Mayor>(otherPlayerName, theatre);
             otherHero = mayor.get();
         } else if (otherPlayerHero == "Courier") {
-            courier = make_unique<Courier>(otherPlayerName, shop);
+            courier = gameArena.makeUnique<Courier>(otherPlayerName, shop);
             otherHero = courier.get();
         } else if (otherPlayerHero == "Scientist") {
-            scientist = make_unique<Scientist>(otherPlayerName, institute);
+            scientist = gameArena.makeUnique<Scientist>(otherPlayerName, institute);
             otherHero = scientist.get();
         }
 
         auto invisibleManStartingPos = gamemap.getLocation("Inn"); 
         auto draculaStartingPos = gamemap.getLocation("Crypt"); 
-        dracula = make_unique<Dracula>(draculaStartingPos);
-        invisibleMan = make_unique<InvisibleMan>(invisibleManStartingPos);
+        dracula = gameArena.makeUnique<Dracula>(draculaStartingPos);
+        invisibleMan = gameArena.makeUnique<InvisibleMan>(invisibleManStartingPos);
     } catch (const exception &e) {
         tui.showMessage(e.what());
         return;
@@ -209,39 +249,231 @@ void Game::play() {
     FrenzyMarker frenzyMarker(static_cast<Dracula*>(dracula.get()), static_cast<InvisibleMan*>(invisibleMan.get()));
 
     cout << "\nGame setup complete! Let the horror begin!\n";
-    cout << "Press Enter to continue..."; 
-    cin.get();
-
-    int turnCount = 1;
-    bool gameRunning = true;
-    Hero* temp = nullptr;
-
-    while (gameRunning) {
-        tui.clearScreen();
-        tui.showTerrorLevelAndTurn(terrorTracker.getLevel(), 5, turnCount);
-        tui.showMapWithHeroInfo(currentHero, otherHero);
-        tui.showActionMenuWithVillagers(gamemap);
-        tui.showItemsOnBoard(itembag, gamemap);
-        tui.showMonsterStatus({dracula.get(), invisibleMan.get()}, gamemap, taskBoard);
-
-        if (terrorTracker.getLevel() >= 5) {
-            cout << "The terror has reached its peak! The monsters have won. The heroes were unable to save the town.\n";
-            gameRunning = false;
-            break;
+    tui.pause("Press Enter to continue...");
+
+    GameTable table;
+    table.map = &gamemap;
+    table.itemBag = &itembag;
+    table.villagerManager = &villagerManager;
+    table.terrorTracker = &terrorTracker;
+    table.taskBoard = &taskBoard;
+    table.monsterManager = &monsterManager;
+    table.perkDeck = &perkDeck;
+    table.frenzyMarker = &frenzyMarker;
+    table.dracula = &dracula;
+    table.invisibleMan = &invisibleMan;
+
+    GameEngine engine(table);
+    engine.start(currentHero, otherHero);
+    playTurns(engine, {player1Name, player2Name, startingPlayerName, otherPlayerName,
+                       startingPlayerHero, otherPlayerHero, player1GarlicTime, player2GarlicTime});
+}
+
+int Game::askDecision(const Decision& decision) {
+    // Scripts only hold hero-phase commands, so batch mode answers for the player
+    if (batch) return decision.options.empty() ? Decision::DECLINE : 0;
+
+    cout << "\n" << decision.hero->getPlayerName() << " (" << decision.hero->getHeroName()
+         << ") is under attack! Choose an item to defend with:\n";
+    for (size_t i = 0; i < decision.options.size(); ++i) {
+        cout << i + 1 << ". " << decision.options[i].getItemName() << " ("
+             << Item::colorToString(decision.options[i].getColor()) << ", " << decision.options[i].getPower() << ")\n";
+    }
+    int declineChoice = static_cast<int>(decision.options.size()) + 1;
+    cout << declineChoice << ". Take the hit and go to the Hospital\n";
+    while (true) {
+        int choice;
+        cout << "Choose (1-" << declineChoice << "): ";
+        cin >> choice;
+        if (cin.fail()) {
+            cout << "Invalid input. Please enter a number.\n";
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            continue;
+        }
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        if (choice == declineChoice) return Decision::DECLINE;
+        if (choice > 0 && choice < declineChoice) return choice - 1;
+        cout << "Invalid choice. Please try again.\n";
+    }
+}
+
+int Game::askNumber(const string& prompt) {
+    int number;
+    while (true) {
+        cout << prompt;
+        cin >> number;
+        if (cin.fail()) {
+            cout << "Invalid input. Please enter a number.\n";
+            cin.clear(); 
+            cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
+            continue;
+        }
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        return number;
+    }
+}
+
+bool Game::askYesNo(const string& question) {
+    string answer;
+    while (true) {
+        cout << question << "(Yes or No)? ";
+        getline(cin, answer);
+        answer = toSentenceCase(answer);
+        if (answer == "Yes") return true;
+        if (answer == "No") return false;
+        cout << "Invalid answer. Please try again" << endl;
+    }
+}
+
+bool Game::askGuide(const Hero& hero, const VillagerManager& villagerManager, GameAction& action) {
+    GuideOptions guideOptions = hero.getGuideOptions(villagerManager);
+    if (guideOptions.empty()) {
+        cout << "There are no villagers on the map that you can guide right now.\n";
+        return false;
+    }
+
+    cout << "Villagers you can guide:\n";
+    for (size_t i = 0; i < guideOptions.size(); ++i) {
+        cout << i + 1 << ". " << guideOptions[i].villager->getVillagerName()
+             << " (at " << guideOptions[i].villager->getCurrentLocation()->getName() << ")\n";
+    }
+    int villagerIndex = askNumber("Choose a villager to guide (1-" + to_string(guideOptions.size()) + "): ");
+    if (villagerIndex < 1 || villagerIndex > static_cast<int>(guideOptions.size())) {
+        cout << "Invalid choice.\n";
+        return false;
+    }
+
+    const auto& chosen = guideOptions[villagerIndex - 1];
+    const auto& possibleLocations = chosen.destinations;
+    if (possibleLocations.size() == 1) {
+        action = GameAction::guide(chosen.villager, possibleLocations[0]);
+        return true;
+    }
+
+    cout << "Where do you want to take " << chosen.villager->getVillagerName() << "?\n";
+    for (size_t i = 0; i < possibleLocations.size(); ++i) {
+        cout << i + 1 << ". " << possibleLocations[i]->getName() << "\n";
+    }
+    int locationIndex = askNumber("Choose location (1-" + to_string(possibleLocations.size()) + "): ");
+    if (locationIndex < 1 || locationIndex > static_cast<int>(possibleLocations.size())) {
+        cout << "Invalid choice.\n";
+        return false;
+    }
+    action = GameAction::guide(chosen.villager, possibleLocations[locationIndex - 1]);
+    return true;
+}
+
+vector<Item> Game::askItemsToTake(const vector<Item>& available, const string& locationName) {
+    vector<Item> chosen;
+    vector<bool> taken(available.size(), false);
+    cout << "Items in " << locationName << ":\n";
+    for (size_t i = 0; i < available.size(); ++i) {
+        const auto& item = available[i];
+        cout << i + 1 << ". " << item.getItemName() << " (" 
+             << Item::colorToString(item.getColor()) << ", Power: " 
+             << item.getPower() << ")\n";
+    }
+
+    int exitChoice = static_cast<int>(available.size()) + 1;
+    while (chosen.size() < available.size()) {
+        int choice = askNumber("Enter the number of the item to pick up (" + to_string(exitChoice) + " to exit): ");
+        if (choice == exitChoice) break;
+        if (choice <= 0 || choice > exitChoice || taken[choice - 1]) {
+            cout << "Invalid answer. Please try again." << endl;
+            continue;
+        }
+        taken[choice - 1] = true;
+        chosen.push_back(available[choice - 1]);
+    }
+    return chosen;
+}
+
+bool Game::askItemToUse(const Hero& hero, const vector<size_t>& options, const string& title, bool showSource,
+                        GameAction& action) {
+    const auto heroItems = hero.getItems();
+    cout << title << "\n";
+    for (size_t i = 0; i < options.size(); ++i) {
+        const Item& item = heroItems[options[i]];
+        cout << i + 1 << ". " << item.getItemName();
+        if (showSource) {
+            cout << " (from " << item.getLocation()->getName() << ")\n";
+        } else {
+            cout << " (Power: " << item.getPower() << ")\n";
+        }
+    }
+    int choice = askNumber("Enter your choice: ");
+    if (choice < 1 || choice > static_cast<int>(options.size())) {
+        cout << "Invalid choice.\n";
+        return false;
+    }
+    action.index = options[choice - 1];
+    action.useAbility = hero.getKind() == HeroKind::Scientist && askYesNo("Do you want to use your ability");
+    return true;
+}
+
+bool Game::askSpecialAction(const Hero& hero, const Hero& otherHero, GameAction& action) {
+    action = GameAction::specialAction();
+    if (hero.getKind() == HeroKind::Courier) {
+        return askYesNo("Do you want to move to " + otherHero.getCurrentLocation()->getName());
+    }
+    if (hero.getKind() != HeroKind::Archeologist) {
+        return true;
+    }
+
+    vector<shared_ptr<Location>> neighborsWithItems;
+    for (const auto& neighbor : hero.getCurrentLocation()->getNeighbors()) {
+        if (!neighbor->getItems().empty()) {
+            neighborsWithItems.push_back(neighbor);
         }
+    }
+    if (neighborsWithItems.empty()) {
+        throw invalid_argument(hero.getPlayerName() + " (Archeologist) found no items in neighboring locations.");
+    }
+
+    cout << "Neighboring locations with items:\n";
+    for (size_t i = 0; i < neighborsWithItems.size(); ++i) {
+        cout << i + 1 << ". " << neighborsWithItems[i]->getName() << "\n";
+    }
+    int locationChoice = askNumber("Choose a location to pick items from (1-" + to_string(neighborsWithItems.size()) + "): ");
+    if (locationChoice < 1 || locationChoice > static_cast<int>(neighborsWithItems.size())) {
+        cout << "Invalid location choice.\n";
+        return false;
+    }
+
+    auto chosenLocation = neighborsWithItems[locationChoice - 1];
+    auto items = askItemsToTake(chosenLocation->getItems(), chosenLocation->getName());
+    if (items.empty()) return false;
+    action = GameAction::specialAction(chosenLocation, std::move(items));
+    return true;
+}
+
+void Game::playTurns(GameEngine& engine, const PlayerSetup& players) {
+    const GameTable& table = engine.getTable();
+
+    // Monster phase events are collected here and summarized after the dice
+    GameEventBus gameEvents;
+    vector<GameEvent> monsterPhaseEvents;
+    gameEvents.subscribe([&monsterPhaseEvents](const GameEvent& event) { monsterPhaseEvents.push_back(event); });
+    engine.setEventSink(&gameEvents);
+
+    auto showBoard = [&]() {
+        tui.showBoard(table.terrorTracker->getLevel(), Rules::TERROR_LIMIT, engine.getTurn(), engine.getCurrentHero(),
+                      engine.getOtherHero(), *table.map, *table.itemBag, {engine.getDracula(), engine.getInvisibleMan()},
+                      *table.taskBoard);
+    };
+
+    bool quit = false;
+    while (!engine.isOver()) {
+        showBoard();
 
         string choice;
-        while (currentHero->getRemainingActions() > 0) {
-            cout << "Press Enter to continue..."; 
-            cin.get();
-
-            tui.clearScreen();
-            tui.showTerrorLevelAndTurn(terrorTracker.getLevel(), 5, turnCount);
-            tui.showMapWithHeroInfo(currentHero, otherHero);
-            tui.showActionMenuWithVillagers(gamemap);
-            tui.showItemsOnBoard(itembag, gamemap);
-            tui.showMonsterStatus({dracula.get(), invisibleMan.get()}, gamemap, taskBoard);
-    
+        while (engine.getCurrentHero()->getRemainingActions() > 0) {
+            tui.pause("Press Enter to continue...");
+
+            showBoard();
+
+            Hero* currentHero = engine.getCurrentHero();
             cout << "\n======== HERO PHASE ========" << endl;
             cout << "Choose an action: ";
             getline(cin, choice);
@@ -271,49 +503,59 @@ void Game::play() {
                         break;
                     }
                     if (locationChoice > 0 && locationChoice <= static_cast<int>(neighbors.size())) {
-                        currentHero->move(neighbors[locationChoice - 1], villagerManager, &perkDeck);
+                        auto destination = neighbors[locationChoice - 1];
+                        currentHero->checkMove(destination);
+                        bool withVillagers = currentHero->getCurrentLocation()->hasVillagers() &&
+                                             askYesNo("Do you want to move villager(s) with yourself");
+                        engine.submitAction(GameAction::move(destination, withVillagers));
                     } else {
                         cout << "Invalid choice. Please try again.\n";
                     }
                     continue;
                 } else if (choice == "G" || choice == "Guide") {
-                    currentHero->guide(villagerManager, gamemap, &perkDeck);
+                    GameAction action;
+                    if (askGuide(*currentHero, *table.villagerManager, action)) {
+                        engine.submitAction(action);
+                    }
                     continue;
                 } else if (choice == "P" || choice == "Pick Up") {
-                    currentHero->pickUp();
+                    auto location = currentHero->getCurrentLocation();
+                    if (location->getItems().empty()) {
+                        throw invalid_argument("No items to pick up in " + location->getName() + ".\n");
+                    }
+                    auto items = askItemsToTake(location->getItems(), location->getName());
+                    if (!items.empty()) {
+                        engine.submitAction(GameAction::pickUp(std::move(items)));
+                    }
                     continue;
                 } else if (choice == "A" || choice == "Advance") {
-                    currentHero->advance(*static_cast<Dracula*>(dracula.get()), *static_cast<InvisibleMan*>(invisibleMan.get()), taskBoard);
+                    auto options = currentHero->getAdvanceOptions(engine.getDracula(), engine.getInvisibleMan(), *table.taskBoard);
+                    bool atPrecinct = currentHero->getCurrentLocation()->getName() == "Precinct";
+                    GameAction action(GameActionType::Advance);
+                    if (askItemToUse(*currentHero, options, atPrecinct ? "Choose an item to use against Invisible man:"
+                                                                       : "Choose a red item to use:",
+                                     atPrecinct, action)) {
+                        engine.submitAction(action);
+                    }
                     continue;
                 } else if (choice == "D" || choice == "Defeat") {
-                    currentHero->defeat(*static_cast<Dracula*>(dracula.get()), taskBoard);
-                    bool draculaDead = taskBoard.isDraculaDefeated();
-                    bool invisibleManDead = taskBoard.isInvisibleManDefeated();
-                    if (draculaDead) {
-                        if (dracula->getCurrentLocation() != nullptr) {
-                            dracula->getCurrentLocation()->removeCharacter("Dracula");
-                            dracula->setCurrentLocation(nullptr);
-                            dracula = nullptr;
-                            frenzyMarker.advance(dracula.get(), invisibleMan.get());
-                        }
-                    }
-                    if (invisibleManDead) {
-                        if (invisibleMan->getCurrentLocation() != nullptr) {
-                            invisibleMan->getCurrentLocation()->removeCharacter("Invisible man");
-                            invisibleMan->setCurrentLocation(nullptr);
-                            invisibleMan = nullptr;
-                            frenzyMarker.advance(dracula.get(), invisibleMan.get());
-                        }
-                    }
-                    if (draculaDead && invisibleManDead) {
-                        cout << "Heroes win! Both Dracula and Invisible man are defeated!" << endl;
-                        gameRunning = false;
-                        break;
+                    auto options = currentHero->getDefeatOptions(engine.getDracula(), *table.taskBoard);
+                    string title = currentHero->getCurrentLocation()->hasCharacter("Invisible man")
+                        ? "Choose a red item to use against the Invisible man (" + to_string(table.taskBoard->getInvisibleManDefeatStrength()) +
+                          "/" + to_string(Rules::INVISIBLE_MAN_DEFEAT_STRENGTH) + " so far):"
+                        : "Choose a yellow item to use against Dracula (" + to_string(table.taskBoard->getDraculaDefeatStrength()) +
+                          "/" + to_string(Rules::DRACULA_DEFEAT_STRENGTH) + " so far):";
+                    GameAction action(GameActionType::Defeat);
+                    if (askItemToUse(*currentHero, options, title, false, action)) {
+                        engine.submitAction(action);
                     }
+                    if (engine.isOver()) break;
                     continue;
                 } else if (choice == "S" || choice == "Special Action") {
-                    currentHero->setOtherHero(otherHero);
-                    currentHero->specialAction();
+                    GameAction action;
+                    if (askSpecialAction(*currentHero, *engine.getOtherHero(), action)) {
+                        engine.submitAction(action);
+                    }
                     continue;
                 } else if (choice == "U" || choice == "Use Perk") {
                     auto perkCards = currentHero->getPerkCards();
@@ -341,7 +583,16 @@ void Game::play() {
                         break;
                     }
                     if (perkChoice > 0 && perkChoice <= static_cast<int>(perkCards.size())) {
-                        currentHero->usePerkCard(perkChoice - 1, gamemap, villagerManager, &perkDeck, static_cast<InvisibleMan*>(invisibleMan.get()), &itembag, otherHero, static_cast<Dracula*>(dracula.get()));
+                        shared_ptr<Location> target;
+                        InvisibleMan* invisibleMan = engine.getInvisibleMan();
+                        if (perkCards[perkChoice - 1].getType() == PerkType::VisitFromTheDetective &&
+                            invisibleMan && invisibleMan->getCurrentLocation()) {
+                            cout << "Choose a location to place the Invisible Man: ";
+                            string locationName;
+                            getline(cin, locationName);
+                            target = table.map->getLocation(toSentenceCase(locationName));
+                        }
+                        engine.submitAction(GameAction::usePerk(perkChoice - 1, target));
                     } else if (perkChoice == exitChoice) {
                         continue;
                     } else {
@@ -354,14 +605,15 @@ void Game::play() {
                 } else if (choice == "E" || choice == "End Turn") {
                     break;
                 } else if (choice == "Save") {
-                    saveCurrentGame(player1Name, player2Name, startingPlayerName, otherPlayerName,
-                                  startingPlayerHero, otherPlayerHero, player1GarlicTime, player2GarlicTime,
-                                  turnCount, terrorTracker, gameRunning, currentHero, otherHero,
-                                  dracula, invisibleMan, villagerManager, itembag, gamemap, taskBoard,
-                                  monsterManager, perkDeck, frenzyMarker);
+                    saveCurrentGame(players.player1Name, players.player2Name, players.startingPlayerName, players.otherPlayerName,
+                                  players.startingPlayerHero, players.otherPlayerHero, players.player1GarlicTime,
+                                  players.player2GarlicTime, engine.getTurn(), *table.terrorTracker, true, currentHero,
+                                  engine.getOtherHero(), *table.dracula, *table.invisibleMan, *table.villagerManager,
+                                  *table.itemBag, *table.map, *table.taskBoard, *table.monsterManager, *table.perkDeck,
+                                  *table.frenzyMarker);
                     continue;
                 } else if (choice == "Q" || choice == "Quit") {
-                    gameRunning = false;
+                    quit = true;
                     break;
                 } else {
                     cout << "Invalid choice. Please try again.\n";
@@ -372,61 +624,62 @@ void Game::play() {
             }
         }
 
-        if (!gameRunning) break;
+        if (quit || engine.isOver()) break;
 
-        cout << "\nEnd of Hero Phase. Press Enter to continue..."; 
-        cin.get();
+        tui.pause("\nEnd of Hero Phase. Press Enter to continue...");
 
-        tui.clearScreen();
-        tui.showTerrorLevelAndTurn(terrorTracker.getLevel(), 5, turnCount);
-        tui.showMapWithHeroInfo(currentHero, otherHero);
-        tui.showActionMenuWithVillagers(gamemap);
-        tui.showItemsOnBoard(itembag, gamemap);
-        tui.showMonsterStatus({dracula.get(), invisibleMan.get()}, gamemap, taskBoard);
+        showBoard();
 
         cout << "\n======== MONSTER PHASE ========" << endl;
-        vector<string> diceResults;
-        if (currentHero->shouldSkipNextMonsterPhase()) {
+        Hero* actingHero = engine.getCurrentHero();
+        monsterPhaseEvents.clear();
+        try {
+            engine.submitAction(GameAction(GameActionType::EndTurn));
+            while (const Decision* decision = engine.getPendingDecision()) {
+                engine.submitAction(GameAction::decide(askDecision(*decision)));
+            }
+        } catch (const exception& e) {
+            tui.showMessage(string("Error during monster phase: ") + e.what());
+        }
+        bool skipped = any_of(monsterPhaseEvents.begin(), monsterPhaseEvents.end(),
+                              [](const GameEvent& event) { return event.type == GameEventType::MonsterPhaseSkipped; });
+        if (skipped) {
             cout << "Monster phase skipped due to Break of Dawn perk card!\n";
-            currentHero->setSkipNextMonsterPhase(false);
         } else {
-            try {
-                monsterManager.MonsterPhase(gamemap, itembag, static_cast<Dracula*>(dracula.get()), 
-                                       static_cast<InvisibleMan*>(invisibleMan.get()), frenzyMarker, currentHero, terrorTracker,
-                                       static_cast<Archeologist*>(archeologist.get()), static_cast<Mayor*>(mayor.get()),
-                                       static_cast<Courier*>(courier.get()), static_cast<Scientist*>(scientist.get()), villagerManager, diceResults);
-            } catch (const exception& e) {
-                tui.showMessage(string("Error during monster phase: ") + e.what());
+            if (!engine.getDiceResults().empty()) {
+                tui.showDiceRoll(engine.getDiceResults());
             }
-            tui.showDiceRoll(diceResults);
-        }
-        cout << "\nEnd of Monster Phase. Press Enter to continue..."; 
-        cin.get();
-
-        tui.clearScreen();
-        tui.showTerrorLevelAndTurn(terrorTracker.getLevel(), 5, turnCount);
-        tui.showMapWithHeroInfo(currentHero, otherHero);
-        tui.showActionMenuWithVillagers(gamemap);
-        tui.showItemsOnBoard(itembag, gamemap);
-        tui.showMonsterStatus({dracula.get(), invisibleMan.get()}, gamemap, taskBoard);
-
-        if (monsterManager.isEmpty() && 
-            (!taskBoard.isDraculaDefeated() || !taskBoard.isInvisibleManDefeated())) {
-            cout << "The monster card deck is empty, but not all monsters have been defeated!" << endl;
-            cout << "The monsters have won. The town is lost." << endl;
-            gameRunning = false;
-            break;
+            tui.showEventSummary(monsterPhaseEvents);
         }
+        tui.pause("\nEnd of Monster Phase. Press Enter to continue...");
 
-        currentHero->resetActions();
-        otherHero->resetActions();
+        showBoard();
 
-        temp = currentHero;
-        currentHero = otherHero;
-        otherHero = temp;
+        recordBatchTurn(engine.getTurn(), actingHero, *table.terrorTracker, *table.taskBoard, *table.villagerManager,
+                        monsterPhaseEvents);
 
-        turnCount++;
+        if (engine.isOver()) break;
+        engine.submitAction(GameAction(GameActionType::NextTurn));
     }
+
+    switch (engine.getOutcome()) {
+        case GameOutcome::HeroesWin:
+            cout << "Heroes win! Both Dracula and Invisible man are defeated!" << endl;
+            break;
+        case GameOutcome::Terror:
+            cout << "The terror has reached its peak! The monsters have won. The heroes were unable to save the town.\n";
+            break;
+        case GameOutcome::DeckEmpty:
+            cout << "The monster card deck is empty, but not all monsters have been defeated!" << endl;
+            cout << "The monsters have won. The town is lost." << endl;
+            break;
+        case GameOutcome::None:
+            break;
+    }
+
+    string outcome = quit ? "quit" : GameEngine::getOutcomeName(engine.getOutcome());
+    finishBatchGame(outcome, engine.getTurn(), engine.getCurrentHero(), *table.terrorTracker, *table.taskBoard,
+                    *table.villagerManager);
     cout << "\n=========Game Over=========" << endl;
 }
 
@@ -531,28 +784,18 @@ void Game::restoreGameFromState(const GameState& gameState) {
     gameState.restoreGameState(turnCount, terrorLevel, gameRunning);
     int currentHeroIndex = gameState.getCurrentHeroIndex();
     
-    Map gamemap;
+    GameArena gameArena;
+    Map gamemap(gameArena.resource());
     TaskBoard taskBoard;
-    VillagerManager villagerManager;
+    VillagerManager villagerManager(gameArena.resource());
     ItemBag itembag(gamemap);
     MonsterManager monsterManager;
     PerkDeck perkDeck;
     
-    // villagers
-    auto villagerStates = gameState.getVillagerStates();
-    for (const auto& villagerState : villagerStates) {
-        if (!villagerState.currentLocationName.empty() && villagerState.currentLocationName != "Defeated") {
-            auto location = gamemap.getLocation(villagerState.currentLocationName);
-            if (location) {
-                villagerManager.addVillager(villagerState.villagerName, location);
-            }
-        }
-    }
-    
-    unique_ptr<Hero> mayor;
-    unique_ptr<Hero> archeologist;
-    unique_ptr<Hero> courier;
-    unique_ptr<Hero> scientist;
+    ArenaPtr<Hero> mayor;
+    ArenaPtr<Hero> archeologist;
+    ArenaPtr<Hero> courier;
+    ArenaPtr<Hero> scientist;
     Hero* currentHero = nullptr;
     Hero* otherHero = nullptr;
     
@@ -563,30 +806,30 @@ void Game::restoreGameFromState(const GameState& gameState) {
         auto institute = gamemap.getLocation("Institute");
         
         if (startHero == "Archeologist") {
-            archeologist = make_unique<Archeologist>(startPlayer, docks);
+            archeologist = gameArena.makeUnique<Archeologist>(startPlayer, docks);
             currentHero = archeologist.get();
         } else if (startHero == "Mayor") {
-            mayor = make_unique<Mayor>(startPlayer, theatre);
+            mayor = gameArena.makeUnique<Mayor>(startPlayer, theatre);
             currentHero = mayor.get();
         } else if (startHero == "Courier") {
-            courier = make_unique<Courier>(startPlayer, shop);
+            courier = gameArena.makeUnique<Courier>(startPlayer, shop);
             currentHero = courier.get();
         } else if (startHero == "Scientist") {
-            scientist = make_unique<Scientist>(startPlayer, institute);
+            scientist = gameArena.makeUnique<Scientist>(startPlayer, institute);
             currentHero = scientist.get();
         }
         
         if (otherHeroName == "Archeologist") {
-            archeologist = make_unique<Archeologist>(otherPlayer, docks);
+            archeologist = gameArena.makeUnique<Archeologist>(otherPlayer, docks);
             otherHero = archeologist.get();
         } else if (otherHeroName == "Mayor") {
-            mayor = make_unique<Mayor>(otherPlayer, theatre);
+            mayor = gameArena.makeUnique<Mayor>(otherPlayer, theatre);
             otherHero = mayor.get();
         } else if (otherHeroName == "Courier") {
-            courier = make_unique<Courier>(otherPlayer, shop);
+            courier = gameArena.makeUnique<Courier>(otherPlayer, shop);
             otherHero = courier.get();
         } else if (otherHeroName == "Scientist") {
-            scientist = make_unique<Scientist>(otherPlayer, institute);
+            scientist = gameArena.makeUnique<Scientist>(otherPlayer, institute);
             otherHero = scientist.get();
         }
         
@@ -677,15 +920,15 @@ void Game::restoreGameFromState(const GameState& gameState) {
         
         auto invisibleManStartingPos = gamemap.getLocation("Inn"); 
         auto draculaStartingPos = gamemap.getLocation("Crypt"); 
-        unique_ptr<Monster> dracula = nullptr;
-        unique_ptr<Monster> invisibleMan = nullptr;
+        ArenaPtr<Monster> dracula = nullptr;
+        ArenaPtr<Monster> invisibleMan = nullptr;
         auto draculaState = gameState.getMonsterState(true);
         auto invisibleManState = gameState.getMonsterState(false);
         if (draculaState.isAlive) {
-            dracula = make_unique<Dracula>(draculaStartingPos);
+            dracula = gameArena.makeUnique<Dracula>(draculaStartingPos);
         }
         if (invisibleManState.isAlive) {
-            invisibleMan = make_unique<InvisibleMan>(invisibleManStartingPos);
+            invisibleMan = gameArena.makeUnique<InvisibleMan>(invisibleManStartingPos);
         }
         
         // map state
@@ -707,6 +950,17 @@ void Game::restoreGameFromState(const GameState& gameState) {
             }
         }
         
+        // villagers, after the map so their locations already list them
+        auto villagerStates = gameState.getVillagerStates();
+        for (const auto& villagerState : villagerStates) {
+            if (!villagerState.currentLocationName.empty() && villagerState.currentLocationName != "Defeated") {
+                auto location = gamemap.getLocation(villagerState.currentLocationName);
+                if (location) {
+                    villagerManager.addVillager(villagerState.villagerName, location);
+                }
+            }
+        }
+        
         // monster states
         if (dracula && draculaState.isAlive) {
             auto draculaLocation = gamemap.getLocation(draculaState.currentLocationName);
@@ -774,10 +1028,9 @@ void Game::restoreGameFromState(const GameState& gameState) {
         terrorTracker.setLevel(terrorLevel);
                 
         playRestoredGame(p1Name, p2Name, startPlayer, otherPlayer, startHero, otherHeroName,
-                        p1Garlic, p2Garlic, turnCount, terrorTracker, gameRunning,
+                        p1Garlic, p2Garlic, turnCount, terrorTracker,
                         currentHero, otherHero, dracula, invisibleMan, villagerManager,
-                        itembag, gamemap, taskBoard, monsterManager, perkDeck, frenzyMarker, 
-                        archeologist, mayor, courier, scientist);
+                        itembag, gamemap, taskBoard, monsterManager, perkDeck, frenzyMarker);
         
     } catch (const exception &e) {
         cout << "Error restoring game: " << e.what() << endl;
@@ -822,232 +1075,33 @@ void Game::playRestoredGame(const string& player1Name, const string& player2Name
                            const string& startingPlayerName, const string& otherPlayerName,
                            const string& startingPlayerHero, const string& otherPlayerHero,
                            int player1GarlicTime, int player2GarlicTime, int turnCount,
-                           TerrorTracker& terrorTracker, bool gameRunning, Hero* currentHero,
-                           Hero* otherHero, unique_ptr<Monster>& dracula,
-                           unique_ptr<Monster>& invisibleMan, VillagerManager& villagerManager,
+                           TerrorTracker& terrorTracker, Hero* currentHero,
+                           Hero* otherHero, ArenaPtr<Monster>& dracula,
+                           ArenaPtr<Monster>& invisibleMan, VillagerManager& villagerManager,
                            ItemBag& itemBag, Map& gamemap, TaskBoard& taskBoard,
                            MonsterManager& monsterManager, PerkDeck& perkDeck,
-                           FrenzyMarker& frenzyMarker, unique_ptr<Hero>& archeologist, 
-                           unique_ptr<Hero>& mayor, unique_ptr<Hero>& courier, unique_ptr<Hero>& scientist) {
+                           FrenzyMarker& frenzyMarker) {
+    if (batch) batch->startGame();
 
     cout << "\nLet the horror continue!\n";
-    cout << "Press Enter to continue..."; 
-    cin.get();
-
-    Hero* temp = nullptr;
-
-    while (gameRunning) {
-        tui.clearScreen();
-        tui.showTerrorLevelAndTurn(terrorTracker.getLevel(), 5, turnCount);
-        tui.showMapWithHeroInfo(currentHero, otherHero);
-        tui.showActionMenuWithVillagers(gamemap);
-        tui.showItemsOnBoard(itemBag, gamemap);
-        tui.showMonsterStatus({dracula.get(), invisibleMan.get()}, gamemap, taskBoard);
-
-        if (terrorTracker.getLevel() >= 5) {
-            cout << "The terror has reached its peak! The monsters have won. The heroes were unable to save the town.\n";
-            gameRunning = false;
-            break;
-        }
-
-        string choice;
-        while (currentHero->getRemainingActions() > 0) {
-            cout << "Press Enter to continue..."; 
-            cin.get();
-
-            tui.clearScreen();
-            tui.showTerrorLevelAndTurn(terrorTracker.getLevel(), 5, turnCount);
-            tui.showMapWithHeroInfo(currentHero, otherHero);
-            tui.showActionMenuWithVillagers(gamemap);
-            tui.showItemsOnBoard(itemBag, gamemap);
-            tui.showMonsterStatus({dracula.get(), invisibleMan.get()}, gamemap, taskBoard);
-    
-            cout << "\n======== HERO PHASE ========" << endl;
-            cout << "Choose an action: ";
-            getline(cin, choice);
-            choice = toSentenceCase(choice);
-            try {
-                if (choice == "M" || choice == "Move") {
-                    auto neighbors = currentHero->getCurrentLocation()->getNeighbors();
-                     if (neighbors.empty()) {
-                        cout << "No neighbor locations available.\n";
-                        continue;
-                    }
-                    cout << "Available locations:\n";
-                    for (size_t i = 0; i < neighbors.size(); ++i) {
-                        cout << i + 1 << ". " << neighbors[i]->getName() << endl;
-                    }
-                    int locationChoice;  
-                    while (true) {
-                        cout << "Choose location (1-" << neighbors.size() << "): ";
-                        cin >> locationChoice;
-                        if (cin.fail()) {
-                            cout << "Invalid input. Please enter a number.\n";
-                            cin.clear(); 
-                            cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-                            continue;
-                        }
-                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                        break;
-                    }
-                    if (locationChoice > 0 && locationChoice <= static_cast<int>(neighbors.size())) {
-                        currentHero->move(neighbors[locationChoice - 1], villagerManager, &perkDeck);
-                    } else {
-                        cout << "Invalid choice. Please try again.\n";
-                    }
-                    continue;
-                } else if (choice == "G" || choice == "Guide") {
-                    currentHero->guide(villagerManager, gamemap, &perkDeck);
-                    continue;
-                } else if (choice == "P" || choice == "Pick Up") {
-                    currentHero->pickUp();
-                    continue;
-                } else if (choice == "A" || choice == "Advance") {
-                    currentHero->advance(*static_cast<Dracula*>(dracula.get()), *static_cast<InvisibleMan*>(invisibleMan.get()), taskBoard);
-                    continue;
-                } else if (choice == "D" || choice == "Defeat") {
-                    currentHero->defeat(*static_cast<Dracula*>(dracula.get()), taskBoard);
-                    bool draculaDead = taskBoard.isDraculaDefeated();
-                    bool invisibleManDead = taskBoard.isInvisibleManDefeated();
-                    if (draculaDead) {
-                        if (dracula->getCurrentLocation() != nullptr) {
-                            dracula->getCurrentLocation()->removeCharacter("Dracula");
-                            dracula->setCurrentLocation(nullptr);
-                            dracula = nullptr;
-                            frenzyMarker.advance(dracula.get(), invisibleMan.get());
-                        }
-                    }
-                    if (invisibleManDead) {
-                        if (invisibleMan->getCurrentLocation() != nullptr) {
-                            invisibleMan->getCurrentLocation()->removeCharacter("Invisible man");
-                            invisibleMan->setCurrentLocation(nullptr);
-                            invisibleMan = nullptr;
-                            frenzyMarker.advance(dracula.get(), invisibleMan.get());
-                        }
-                    }
-                    if (draculaDead && invisibleManDead) {
-                        cout << "Heroes win! Both Dracula and Invisible man are defeated!" << endl;
-                        gameRunning = false;
-                        break;
-                    }
-                    continue;
-                } else if (choice == "S" || choice == "Special Action") {
-                    currentHero->setOtherHero(otherHero);
-                    currentHero->specialAction();
-                    continue;
-                } else if (choice == "U" || choice == "Use Perk") {
-                    auto perkCards = currentHero->getPerkCards();
-                    if (perkCards.empty()) {
-                        cout << "You have no perk cards to use.\n";
-                        continue;
-                    }
-                    cout << "Choose a perk card to use:\n";
-                    for (size_t i = 0; i < perkCards.size(); ++i) {
-                        cout << i + 1 << ". " << PerkCard::perkTypeToString(perkCards[i].getType()) 
-                             << ": " << perkCards[i].getDescription() << "\n";
-                    }
-                    int exitChoice = static_cast<int>(perkCards.size()) + 1;
-                    int perkChoice;
-                    while (true) {
-                        cout << "Choose perk card (" << exitChoice << " to exit): ";
-                        cin >> perkChoice;
-                        if (cin.fail()) {
-                            cout << "Invalid input. Please enter a number.\n";
-                            cin.clear(); 
-                            cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-                            continue;
-                        }
-                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-                        break;
-                    }
-                    if (perkChoice > 0 && perkChoice <= static_cast<int>(perkCards.size())) {
-                        currentHero->usePerkCard(perkChoice - 1, gamemap, villagerManager, &perkDeck, static_cast<InvisibleMan*>(invisibleMan.get()), &itemBag, otherHero, static_cast<Dracula*>(dracula.get()));
-                    } else if (perkChoice == exitChoice) {
-                        continue;
-                    } else {
-                        cout << "Invalid choice. Please try again.\n";
-                    }
-                    continue;
-                } else if (choice == "H" || choice == "Help") {
-                    tui.showHelpMenu();
-                    continue;
-                } else if (choice == "E" || choice == "End Turn") {
-                    break;
-                } else if (choice == "Save") {
-                    saveCurrentGame(player1Name, player2Name, startingPlayerName, otherPlayerName,
-                                  startingPlayerHero, otherPlayerHero, player1GarlicTime, player2GarlicTime,
-                                  turnCount, terrorTracker, gameRunning, currentHero, otherHero,
-                                  dracula, invisibleMan, villagerManager, itemBag, gamemap, taskBoard,
-                                  monsterManager, perkDeck, frenzyMarker);
-                    continue;
-                } else if (choice == "Q" || choice == "Quit") {
-                    gameRunning = false;
-                    break;
-                } else {
-                    cout << "Invalid choice. Please try again.\n";
-                    continue;
-                }
-            } catch (const exception& e) {
-                tui.showMessage(e.what());
-            }
-        }
-
-        if (!gameRunning) break;
-
-        cout << "\nEnd of Hero Phase. Press Enter to continue..."; 
-        cin.get();
-
-        tui.clearScreen();
-        tui.showTerrorLevelAndTurn(terrorTracker.getLevel(), 5, turnCount);
-        tui.showMapWithHeroInfo(currentHero, otherHero);
-        tui.showActionMenuWithVillagers(gamemap);
-        tui.showItemsOnBoard(itemBag, gamemap);
-        tui.showMonsterStatus({dracula.get(), invisibleMan.get()}, gamemap, taskBoard);
-
-        cout << "\n======== MONSTER PHASE ========" << endl;
-        vector<string> diceResults;
-        if (currentHero->shouldSkipNextMonsterPhase()) {
-            cout << "Monster phase skipped due to Break of Dawn perk card!\n";
-            currentHero->setSkipNextMonsterPhase(false);
-        } else {
-            try {
-                monsterManager.MonsterPhase(gamemap, itemBag, static_cast<Dracula*>(dracula.get()), 
-                                       static_cast<InvisibleMan*>(invisibleMan.get()), frenzyMarker, currentHero, terrorTracker,
-                                       static_cast<Archeologist*>(archeologist.get()), static_cast<Mayor*>(mayor.get()),
-                                       static_cast<Courier*>(courier.get()), static_cast<Scientist*>(scientist.get()), villagerManager, diceResults);
-            } catch (const exception& e) {
-                tui.showMessage(string("Error during monster phase: ") + e.what());
-            }
-            tui.showDiceRoll(diceResults);
-        }
-        cout << "\nEnd of Monster Phase. Press Enter to continue..."; 
-        cin.get();
-
-        tui.clearScreen();
-        tui.showTerrorLevelAndTurn(terrorTracker.getLevel(), 5, turnCount);
-        tui.showMapWithHeroInfo(currentHero, otherHero);
-        tui.showActionMenuWithVillagers(gamemap);
-        tui.showItemsOnBoard(itemBag, gamemap);
-        tui.showMonsterStatus({dracula.get(), invisibleMan.get()}, gamemap, taskBoard);
-
-        if (monsterManager.isEmpty() && 
-            (!taskBoard.isDraculaDefeated() || !taskBoard.isInvisibleManDefeated())) {
-            cout << "The monster card deck is empty, but not all monsters have been defeated!" << endl;
-            cout << "The monsters have won. The town is lost." << endl;
-            gameRunning = false;
-            break;
-        }
-
-        currentHero->resetActions();
-        otherHero->resetActions();
-
-        temp = currentHero;
-        currentHero = otherHero;
-        otherHero = temp;
-
-        turnCount++;
-    }
-    cout << "\n=========Game Over=========" << endl;
+    tui.pause("Press Enter to continue...");
+
+    GameTable table;
+    table.map = &gamemap;
+    table.itemBag = &itemBag;
+    table.villagerManager = &villagerManager;
+    table.terrorTracker = &terrorTracker;
+    table.taskBoard = &taskBoard;
+    table.monsterManager = &monsterManager;
+    table.perkDeck = &perkDeck;
+    table.frenzyMarker = &frenzyMarker;
+    table.dracula = &dracula;
+    table.invisibleMan = &invisibleMan;
+
+    GameEngine engine(table);
+    engine.start(currentHero, otherHero, turnCount);
+    playTurns(engine, {player1Name, player2Name, startingPlayerName, otherPlayerName,
+                       startingPlayerHero, otherPlayerHero, player1GarlicTime, player2GarlicTime});
 }
 
 void Game::saveCurrentGame(const string& player1Name, const string& player2Name,
@@ -1055,8 +1109,8 @@ void Game::saveCurrentGame(const string& player1Name, const string& player2Name,
                           const string& startingPlayerHero, const string& otherPlayerHero,
                           int player1GarlicTime, int player2GarlicTime, int turnCount,
                           const TerrorTracker& terrorTracker, bool gameRunning, Hero* currentHero,
-                          Hero* otherHero, const unique_ptr<Monster>& dracula,
-                          const unique_ptr<Monster>& invisibleMan, const VillagerManager& villagerManager,
+                          Hero* otherHero, const ArenaPtr<Monster>& dracula,
+                          const ArenaPtr<Monster>& invisibleMan, const VillagerManager& villagerManager,
                           const ItemBag& itemBag, const Map& gamemap, const TaskBoard& taskBoard,
                           const MonsterManager& monsterManager, const PerkDeck& perkDeck,
                           const FrenzyMarker& frenzyMarker) {
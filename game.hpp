@@ -4,12 +4,28 @@
 #include <memory>
 #include "gamestate.hpp"
 #include "savemanager.hpp"
+#include "gamearena.hpp"
 #include "tui.hpp"
+#include "batchmode.hpp"
+#include "gameengine.hpp"
+
+// The players of a game, as written to a save
+struct PlayerSetup {
+    std::string player1Name;
+    std::string player2Name;
+    std::string startingPlayerName;
+    std::string otherPlayerName;
+    std::string startingPlayerHero;
+    std::string otherPlayerHero;
+    int player1GarlicTime = 0;
+    int player2GarlicTime = 0;
+};
 
 class Game {
 private:
     std::unique_ptr<SaveManager> saveManager;
     TUI tui;
+    std::unique_ptr<BatchSession> batch;
     
     void showMainMenu();
     void startNewGame();
@@ -19,33 +35,54 @@ private:
     void showDetailedSaveInfo(int slotNumber);
     void deleteSave();
     bool confirmAction(const std::string& message);
+    void recordBatchTurn(int turnCount, const Hero* hero, const TerrorTracker& terrorTracker, const TaskBoard& taskBoard,
+                         const VillagerManager& villagerManager, const std::vector<GameEvent>& events);
+    void finishBatchGame(const std::string& outcome, int turnCount, const Hero* hero, const TerrorTracker& terrorTracker,
+                         const TaskBoard& taskBoard, const VillagerManager& villagerManager);
     
+    // Reads hero actions until the engine reports the end of the game or the players quit
+    void playTurns(GameEngine& engine, const PlayerSetup& players);
+    // Returns an option index or Decision::DECLINE
+    int askDecision(const Decision& decision);
+    // Prompts for the choices of a hero action. The ask* helpers that fill in
+    // an action return false when the player backs out.
+    int askNumber(const std::string& prompt);
+    bool askYesNo(const std::string& question);
+    bool askGuide(const Hero& hero, const VillagerManager& villagerManager, GameAction& action);
+    // Any number of the items, each at most once; empty when none were picked
+    std::vector<Item> askItemsToTake(const std::vector<Item>& available, const std::string& locationName);
+    // Picks one of the hero's items by index for Advance or Defeat
+    bool askItemToUse(const Hero& hero, const std::vector<std::size_t>& options, const std::string& title,
+                      bool showSource, GameAction& action);
+    bool askSpecialAction(const Hero& hero, const Hero& otherHero, GameAction& action);
+
     void restoreGameFromState(const GameState& gameState);
     void playRestoredGame(const std::string& player1Name, const std::string& player2Name,
                          const std::string& startingPlayerName, const std::string& otherPlayerName,
                          const std::string& startingPlayerHero, const std::string& otherPlayerHero,
                          int player1GarlicTime, int player2GarlicTime, int turnCount,
-                         TerrorTracker& terrorTracker, bool gameRunning, Hero* currentHero,
-                         Hero* otherHero, std::unique_ptr<Monster>& dracula,
-                         std::unique_ptr<Monster>& invisibleMan, VillagerManager& villagerManager,
+                         TerrorTracker& terrorTracker, Hero* currentHero,
+                         Hero* otherHero, ArenaPtr<Monster>& dracula,
+                         ArenaPtr<Monster>& invisibleMan, VillagerManager& villagerManager,
                          ItemBag& itemBag, Map& gamemap, TaskBoard& taskBoard,
                          MonsterManager& monsterManager, PerkDeck& perkDeck,
-                         FrenzyMarker& frenzyMarker, unique_ptr<Hero>& Archeologist, 
-                         unique_ptr<Hero>& Mayor, unique_ptr<Hero>& Courier, unique_ptr<Hero>& Scientist);
+                         FrenzyMarker& frenzyMarker);
     
     void saveCurrentGame(const std::string& player1Name, const std::string& player2Name,
                         const std::string& startingPlayerName, const std::string& otherPlayerName,
                         const std::string& startingPlayerHero, const std::string& otherPlayerHero,
                         int player1GarlicTime, int player2GarlicTime, int turnCount,
                         const TerrorTracker& terrorTracker, bool gameRunning, Hero* currentHero,
-                        Hero* otherHero, const std::unique_ptr<Monster>& dracula,
-                        const std::unique_ptr<Monster>& invisibleMan, const VillagerManager& villagerManager,
+                        Hero* otherHero, const ArenaPtr<Monster>& dracula,
+                        const ArenaPtr<Monster>& invisibleMan, const VillagerManager& villagerManager,
                         const ItemBag& itemBag, const Map& gamemap, const TaskBoard& taskBoard,
                         const MonsterManager& monsterManager, const PerkDeck& perkDeck,
                         const FrenzyMarker& frenzyMarker);
 
 public:
     Game();
+    // Reads commands from a script instead of a player; see BatchOptions
+    void enableBatchMode(const BatchOptions& options);
     void play();
     void runMainMenu();
 };
@@ -3,14 +3,23 @@
 #include <functional>
 #include <algorithm>
 #include <sstream>
+#include <cstdio>
+#include <cmath>
 #include "invisibleman.hpp"
+#include "archeologist.hpp"
+#include "mayor.hpp"
+#include "courier.hpp"
+#include "scientist.hpp"
+#include "rules.hpp"
 #include "perkcard.hpp"
 #include "item.hpp"
+#include "alloctracker.hpp"
 
-GameScreen::GameScreen(const std::vector<PlayerInfo>& playerInfo, const std::string& startPlayer, int windowWidth, int windowHeight) 
-    : players(playerInfo), startingPlayer(startPlayer), currentTurn(1), gameRunning(true), 
+GameScreen::GameScreen(const std::vector<PlayerInfo>& playerInfo, const std::string& startPlayer, int windowWidth, int windowHeight,
+                       const AssetArchive* archive)
+    : assetArchive(archive), players(playerInfo), startingPlayer(startPlayer), currentTurn(1), gameRunning(true), 
       currentTerrorLevel(0), currentPhase(HERO_PHASE), currentHero(nullptr), otherHero(nullptr),
-      remainingActions(5), maxActions(5), monsterCardLoaded(false), frenziedMonsterTextureLoaded(false) {
+      remainingActions(5), maxActions(5) {
     
     // Use the provided window dimensions instead of creating a new window
     screenWidth = windowWidth;
@@ -21,29 +30,26 @@ GameScreen::GameScreen(const std::vector<PlayerInfo>& playerInfo, const std::str
     int titleFontSize = screenHeight * 0.04f;  // 4% of screen height
     int largeFontSize = screenHeight * 0.03f;  // 3% of screen height
     
-    gameFont = LoadFontEx(getAssetPath("fonts/Rubik-Regular.ttf").c_str(), gameFontSize, 0, 0);
-    titleFont = LoadFontEx(getAssetPath("fonts/Creepster-Regular.ttf").c_str(), titleFontSize, 0, 0);
-    largeFont = LoadFontEx(getAssetPath("fonts/Rubik-Regular.ttf").c_str(), largeFontSize, 0, 0);
+    gameFont = loadFont("fonts/Rubik-Regular.ttf", gameFontSize);
+    titleFont = loadFont("fonts/Creepster-Regular.ttf", titleFontSize);
+    largeFont = loadFont("fonts/Rubik-Regular.ttf", largeFontSize);
     
     if (gameFont.texture.id == 0) gameFont = GetFontDefault();
     if (titleFont.texture.id == 0) titleFont = GetFontDefault();
     if (largeFont.texture.id == 0) largeFont = GetFontDefault();
     
-    // Load map texture
-    std::string mapPath = getAssetPath("Horrified_Assets/map2.jpg");
-    if (FileExists(mapPath.c_str())) {
-        mapTexture = LoadTexture(mapPath.c_str());
-        mapLoaded = true;
-        std::cout << "Map loaded successfully from: " << mapPath << std::endl;
-    }
-    
-    // Load hero and monster images
+    // Queue the map and card images; workers decode them while the loading screen runs
+    heroImagesLoaded = monsterImagesLoaded = villagerImagesLoaded = itemImagesLoaded = false;
+    perkCardImagesLoaded = coffinImagesLoaded = false;
+    assetLoader = std::make_unique<AssetLoader>(assetArchive);
+    assetLoader->request("map", "Horrified_Assets/map2.jpg");
     loadHeroImages();
     loadMonsterImages();
     loadVillagerImages();
     loadItemImages();
     loadPerkCardImages();
     loadCoffinImages();
+    loadMonsterCardImages();
     
     // Initialize UI Layout - Fully responsive positioning based on screen size
     float margin = screenWidth * 0.015f;  // 1.5% margin (reduced)
@@ -85,6 +91,9 @@ GameScreen::GameScreen(const std::vector<PlayerInfo>& playerInfo, const std::str
     evidencePanel = {rightPanelX, rightPanelY + heroInfoHeight + margin + actionsHeight + margin * 4, rightPanelWidth - 100, evidenceHeight};
     monsterPhasePanel = {rightPanelX, rightPanelY + heroInfoHeight + margin + actionsHeight + margin * 5 + evidenceHeight, rightPanelWidth - 100, monsterPhaseHeight};
     
+    // Rescues and deaths during the hero phase arrive here as they happen
+    gameEvents.subscribe([this](const GameEvent& event) { handleGameEvent(event); });
+
     // Initialize game components
     initializeGameState();
     initializeMap();
@@ -97,23 +106,15 @@ GameScreen::GameScreen(const std::vector<PlayerInfo>& playerInfo, const std::str
     // Initialize tooltip
     itemTooltip = {"", {}, {0, 0}, false, 0.0f, "", ""};
 
-    itemWasPickedUpThisTurn = false;
-
     showArcheologistLocationChoice = false;
     showArcheologistItemChoice = false;
-    archeologistPickedUpItem = false;
 }
 
 GameScreen::~GameScreen() {
+    waitForMonsterWorker();
     if (mapLoaded && mapTexture.id != 0) {
         UnloadTexture(mapTexture);
     }
-    if (monsterCardLoaded && monsterCardTexture.id != 0) {
-        UnloadTexture(monsterCardTexture);
-    }
-    if (frenziedMonsterTextureLoaded && frenziedMonsterTexture.id != 0) {
-        UnloadTexture(frenziedMonsterTexture);
-    }
     if (gameFont.texture.id != 0 && gameFont.texture.id != GetFontDefault().texture.id) {
         UnloadFont(gameFont);
     }
@@ -123,6 +124,10 @@ GameScreen::~GameScreen() {
     if (largeFont.texture.id != 0 && largeFont.texture.id != GetFontDefault().texture.id) {
         UnloadFont(largeFont);
     }
+    textLayoutCache.clear();
+    if (boardTextureLoaded) {
+        UnloadRenderTexture(boardTexture);
+    }
     
     // Unload hero and monster images
     unloadImages();
@@ -135,10 +140,12 @@ void GameScreen::initializeGameState() {
     saveManager = std::make_unique<SaveManager>();
     
     // Initialize game map
-    gameMap = std::make_unique<Map>();
+    gameMap = std::make_unique<Map>(gameArena.resource());
+    villagerManager = VillagerManager(gameArena.resource());
+    villagerManager.setEventSink(&gameEvents);
     
     // Initialize game components
-    itemBag = new ItemBag(*gameMap);
+    itemBag = gameArena.create<ItemBag>(*gameMap);
     monsterManager = MonsterManager();
     perkDeck = PerkDeck();
     taskBoard = TaskBoard();
@@ -147,30 +154,30 @@ void GameScreen::initializeGameState() {
     for (const auto& player : players) {
         if (player.name == startingPlayer) {
             if (player.hero == "Mayor") {
-                currentHero = new Mayor(player.name, gameMap->getLocation("Theatre"));
+                currentHero = gameArena.create<Mayor>(player.name, gameMap->getLocation("Theatre"));
             } else if (player.hero == "Archeologist") {
-                currentHero = new Archeologist(player.name, gameMap->getLocation("Docks"));
+                currentHero = gameArena.create<Archeologist>(player.name, gameMap->getLocation("Docks"));
             } else if (player.hero == "Courier") {
-                currentHero = new Courier(player.name, gameMap->getLocation("Shop"));
+                currentHero = gameArena.create<Courier>(player.name, gameMap->getLocation("Shop"));
             } else if (player.hero == "Scientist") {
-                currentHero = new Scientist(player.name, gameMap->getLocation("Laboratory"));
+                currentHero = gameArena.create<Scientist>(player.name, gameMap->getLocation("Laboratory"));
             }
         } else {
             if (player.hero == "Mayor") {
-                otherHero = new Mayor(player.name, gameMap->getLocation("Theatre"));
+                otherHero = gameArena.create<Mayor>(player.name, gameMap->getLocation("Theatre"));
             } else if (player.hero == "Archeologist") {
-                otherHero = new Archeologist(player.name, gameMap->getLocation("Docks"));
+                otherHero = gameArena.create<Archeologist>(player.name, gameMap->getLocation("Docks"));
             } else if (player.hero == "Courier") {
-                otherHero = new Courier(player.name, gameMap->getLocation("Shop"));
+                otherHero = gameArena.create<Courier>(player.name, gameMap->getLocation("Shop"));
             } else if (player.hero == "Scientist") {
-                otherHero = new Scientist(player.name, gameMap->getLocation("Laboratory"));
+                otherHero = gameArena.create<Scientist>(player.name, gameMap->getLocation("Laboratory"));
             }
         }
     }
     
     // Initialize monsters
-    dracula = std::make_unique<Dracula>(gameMap->getLocation("Crypt"));
-    invisibleMan = std::make_unique<InvisibleMan>(gameMap->getLocation("Inn"));
+    dracula = gameArena.makeUnique<Dracula>(gameMap->getLocation("Crypt"));
+    invisibleMan = gameArena.makeUnique<InvisibleMan>(gameMap->getLocation("Inn"));
     
     // Initialize frenzy marker
     frenzyMarker = std::make_unique<FrenzyMarker>(static_cast<Dracula*>(dracula.get()), 
@@ -194,7 +201,21 @@ void GameScreen::initializeGameState() {
     }
     
     // Initialize action counts
-    remainingActions = maxActions;
+    refreshActionCount();
+
+    GameTable table;
+    table.map = gameMap.get();
+    table.itemBag = itemBag;
+    table.villagerManager = &villagerManager;
+    table.terrorTracker = &terrorTracker;
+    table.taskBoard = &taskBoard;
+    table.monsterManager = &monsterManager;
+    table.perkDeck = &perkDeck;
+    table.frenzyMarker = frenzyMarker.get();
+    table.dracula = &dracula;
+    table.invisibleMan = &invisibleMan;
+    engine.setTable(table);
+    engine.start(currentHero, otherHero, currentTurn);
 }
 
 void GameScreen::initializeMap() {
@@ -298,17 +319,27 @@ void GameScreen::initializeLocations() {
         
         // Add villagers to locations
         try {
-            for (const auto& [villagerName, villager] : villagerManager.getAllVillagers()) {
+            for (const auto& villager : villagerManager.getAllVillagers()) {
                 if (villager && villager->getCurrentLocation()) {
                     std::string villagerLocation = villager->getCurrentLocation()->getName();
                     if (mapLocations.find(villagerLocation) != mapLocations.end()) {
-                        mapLocations[villagerLocation].characters.push_back(villagerName);
+                        mapLocations[villagerLocation].characters.push_back(villager->getVillagerName());
                     }
                 }
             }
         } catch (const std::exception& e) {
             std::cout << "Error adding villagers to locations: " << e.what() << std::endl;
         }
+
+        markBoardDirty();
+
+        // Resolve sprites now so drawing doesn't search the image tables every frame
+        for (auto& [name, location] : mapLocations) {
+            location.characterVisuals.clear();
+            for (const auto& charName : location.characters) {
+                location.characterVisuals.push_back(resolveCharacterVisual(charName));
+            }
+        }
     } catch (const std::exception& e) {
         std::cout << "Error in initializeLocations: " << e.what() << std::endl;
     }
@@ -394,10 +425,10 @@ void GameScreen::initializeTerrorTracker() {
     float trackerWidth = terrorTrackerArea.width * 0.15f;  // 15% of tracker area width
     float trackerHeight = terrorTrackerArea.height * 0.6f;  // 60% of tracker area height
     float trackerSpacing = terrorTrackerArea.width * 0.05f;  // 5% spacing
-    float startX = terrorTrackerArea.x + (terrorTrackerArea.width - (trackerWidth * 5 + trackerSpacing * 4)) / 2;
+    float startX = terrorTrackerArea.x + (terrorTrackerArea.width - (trackerWidth * Rules::TERROR_LIMIT + trackerSpacing * (Rules::TERROR_LIMIT - 1))) / 2;
     float trackerY = terrorTrackerArea.y + (terrorTrackerArea.height - trackerHeight) / 2;
     
-    for (int i = 0; i < 5; i++) {
+    for (int i = 0; i < Rules::TERROR_LIMIT; i++) {
         Rectangle tracker = {
             startX + i * (trackerWidth + trackerSpacing),
             trackerY,
@@ -415,13 +446,49 @@ void GameScreen::run() {
 void GameScreen::draw() {
     // Clear the screen with the game's background color
     ClearBackground(backgroundColor);
+
+    if (!assetsReady) {
+        updateAssetLoading();
+        drawLoadingScreen();
+        return;
+    }
+
+    if (isMonsterTurnRunning()) {
+        // The engine thread owns the game state: show the last board frame until it is done
+        drawBoardLayer();
+        const char* waitText = "The monsters are moving...";
+        Vector2 waitSize = measureText(titleFont, waitText, titleFont.baseSize, 1);
+        drawText(titleFont, waitText, {mapArea.x + (mapArea.width - waitSize.x) / 2, mapArea.y + mapArea.height / 2}, titleFont.baseSize, 1, WHITE);
+        return;
+    }
+
+    // Frames spent waiting for input while idle are not render time
+    if (!framePacer || !framePacer->isIdle()) {
+        frameTimes.record(GetFrameTime());
+        if (currentPhase == MONSTER_PHASE) {
+            monsterPhaseFrameTimes.record(GetFrameTime());
+        }
+    }
+
+    // Font sizes follow the window size, so cached layouts are stale after a resize
+    if (GetScreenWidth() != textLayoutScreenWidth || GetScreenHeight() != textLayoutScreenHeight) {
+        textLayoutCache.clear();
+        textLayoutScreenWidth = GetScreenWidth();
+        textLayoutScreenHeight = GetScreenHeight();
+    }
     
-    // Draw game elements in order
-    drawMap();
+    // Draw game elements in order: the cached board, then the hover/selection circles
+    drawBoardLayer();
     drawLocations();
-    drawCoffins();  // Draw coffins first (background)
-    drawCharacters(); // Draw characters on top
-    drawItems();     // Draw items on top
+    if (currentPhase == MONSTER_PHASE && !monsterEventLocation.empty()) {
+        // Pulse around where the last monster event happened
+        auto eventLocation = mapLocations.find(monsterEventLocation);
+        if (eventLocation != mapLocations.end()) {
+            float pulse = 1.0f + 0.15f * sinf((float)GetTime() * 6.0f);
+            Vector2 center = eventLocation->second.position;
+            DrawCircleLines((int)center.x, (int)center.y, eventLocation->second.radius * 1.4f * pulse, dangerColor);
+        }
+    }
     drawTerrorTracker();
     drawPhaseIndicator();
     
@@ -478,8 +545,8 @@ void GameScreen::draw() {
         DrawRectangleLinesEx({boxX, boxY, boxWidth, boxHeight}, 3, WHITE);
 
         std::string message = "No actions left!\nClick 'End Turn' to continue.";
-        Vector2 textSize = MeasureTextEx(titleFont, message.c_str(), titleFont.baseSize, 1);
-        DrawTextEx(titleFont, message.c_str(),
+        Vector2 textSize = measureText(titleFont, message.c_str(), titleFont.baseSize, 1);
+        drawText(titleFont, message.c_str(),
                 {boxX + (boxWidth - textSize.x) / 2,
                     boxY + (boxHeight - textSize.y) / 2},
                 titleFont.baseSize, 1, WHITE);
@@ -540,9 +607,61 @@ void GameScreen::draw() {
     if (showSaveSlots) {
         drawSaveSlotsOverlay();
     }
+
+    if (showDebugOverlay) {
+        drawDebugOverlay();
+    }
+}
+
+void GameScreen::drawDebugOverlay() {
+    float fontSize = gameFont.baseSize * 0.9f;
+    float lineHeight = fontSize * 1.2f;
+    float padding = 8.0f;
+    std::vector<std::string> lines;
+
+    lines.push_back("DEBUG (F3)  FPS: " + std::to_string(GetFPS()));
+    if (framePacer) {
+        char cpuText[32];
+        std::snprintf(cpuText, sizeof(cpuText), "%.1f", framePacer->getCpuUsage());
+        lines.push_back(std::string("CPU: ") + cpuText + "%  frames/s: " + std::to_string(framePacer->getFramesLastSecond()) +
+                        (framePacer->isIdle() ? "  (idle, waiting for input)" : "  (active)"));
+    }
+    if (AllocTracker::isCompiledIn()) {
+        lines.push_back("Heap allocations by phase:");
+        for (int i = 0; i < static_cast<int>(AllocPhase::Count); ++i) {
+            AllocPhase phase = static_cast<AllocPhase>(i);
+            AllocStats stats = AllocTracker::getStats(phase);
+            lines.push_back("  " + AllocTracker::phaseName(phase) + ": " + std::to_string(stats.allocations) +
+                            " allocs, " + std::to_string(stats.bytes / 1024) + " KB");
+        }
+    } else {
+        lines.push_back("Allocation tracking not compiled in (ALLOC_TRACKING)");
+    }
+    lines.push_back("Text layouts cached: " + std::to_string(textLayoutCache.size()));
+    lines.push_back("Board rebuilds: " + std::to_string(boardRebuilds));
+    lines.push_back("Frame ms (all): " + frameTimes.summary());
+    lines.push_back("Frame ms (monster phase): " + monsterPhaseFrameTimes.summary());
+
+    float boxWidth = screenWidth * 0.4f;
+    float boxHeight = lines.size() * lineHeight + padding * 2;
+    float boxX = screenWidth - boxWidth - padding;
+    float boxY = screenHeight - boxHeight - padding;
+    DrawRectangle(boxX, boxY, boxWidth, boxHeight, {0, 0, 0, 200});
+    DrawRectangleLinesEx({boxX, boxY, boxWidth, boxHeight}, 1, GRAY);
+
+    float textY = boxY + padding;
+    for (const auto& line : lines) {
+        // These lines change every frame, keep them out of the layout cache
+        DrawTextEx(gameFont, line.c_str(), {boxX + padding, textY}, fontSize, 1, successColor);
+        textY += lineHeight;
+    }
 }
 
 void GameScreen::handleInput() {
+    if (!assetsReady || isMonsterTurnRunning()) {
+        return;
+    }
+
     // If the game is over, only process input for the game over screen
     if (isGameOver) {
         handleGameOverClick(GetMousePosition());
@@ -551,7 +670,13 @@ void GameScreen::handleInput() {
 
     Vector2 mousePos = GetMousePosition();
     
+    // Clicks are what drive engine changes, so redraw the board after any of them
+    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) || IsMouseButtonPressed(MOUSE_RIGHT_BUTTON)) {
+        markBoardDirty();
+    }
+
     if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        AllocPhaseScope allocScope(currentPhase == HERO_PHASE ? AllocPhase::HeroAction : AllocPhase::Other);
         if (showHeroDefenseYesNoOverlay) {
             handleHeroDefenseYesNoClick(mousePos);
         } else if (showGameMessage) {
@@ -618,6 +743,12 @@ void GameScreen::handleInput() {
         advanceMonsterPhase();
     }
     
+    // F3 toggles the debug overlay
+    if (IsKeyPressed(KEY_F3)) {
+        showDebugOverlay = !showDebugOverlay;
+        AllocTracker::setEnabled(showDebugOverlay);
+    }
+
     // Handle keyboard input
     if (IsKeyPressed(KEY_ESCAPE)) {
         if (showGameMessage) {
@@ -627,10 +758,7 @@ void GameScreen::handleInput() {
             processNextGameMessage();
         } else if (showHeroDefense) {
             // Treat ESC as cancel/No for defense selection when item grid is open
-            if (onDefenseCanceled) {
-                onDefenseCanceled();
-            }
-            cancelHeroDefense();
+            answerDefense(Decision::DECLINE);
         } else if (showGuideVillagers || selectedVillager) {
             cancelGuideAction();
         } else if (showPickUpItems) {
@@ -658,11 +786,8 @@ void GameScreen::handleInput() {
     // Handle hero defense keyboard input
     if (showHeroDefense) {
         for (int i = 0; i < static_cast<int>(heroDefenseItems.size()); i++) {
-            if (IsKeyPressed(KEY_ONE + i)) {
-                if (onItemSelectedIndex && i < static_cast<int>(heroDefenseItemIndices.size())) {
-                    onItemSelectedIndex(heroDefenseItemIndices[i]);
-                }
-                cancelHeroDefense();
+            if (IsKeyPressed(KEY_ONE + i) && i < static_cast<int>(heroDefenseItemIndices.size())) {
+                answerDefense(heroDefenseItemIndices[i]);
                 return;
             }
         }
@@ -670,7 +795,7 @@ void GameScreen::handleInput() {
     
     // Handle guide overlays keyboard input
     if (showGuideVillagers) {
-        for (int i = 0; i < static_cast<int>(guidableVillagers.size()); i++) {
+        for (int i = 0; i < static_cast<int>(guideOptions.size()); i++) {
             if (IsKeyPressed(KEY_ONE + i)) {
                 selectVillagerToGuide(i);
                 return;
@@ -695,11 +820,13 @@ void GameScreen::handleInput() {
 }
 
 void GameScreen::updateGame() {
-    // If the game is over, stop updating the game state
-    if (isGameOver) {
+    // If the game is over (or still loading), stop updating the game state
+    if (isGameOver || !assetsReady) {
         return;
     }
 
+    updateMonsterTurn();
+
     // Update tooltip display time
     if (itemTooltip.isVisible) {
         itemTooltip.displayTime += GetFrameTime();
@@ -732,6 +859,60 @@ void GameScreen::updateGame() {
     }
 }
 
+void GameScreen::markBoardDirty() {
+    ++boardVersion;
+}
+
+void GameScreen::drawBoardLayer() {
+    int width = GetScreenWidth();
+    int height = GetScreenHeight();
+    if (!boardTextureLoaded || boardTexture.texture.width != width || boardTexture.texture.height != height) {
+        if (boardTextureLoaded) {
+            UnloadRenderTexture(boardTexture);
+        }
+        boardTexture = LoadRenderTexture(width, height);
+        boardTextureLoaded = boardTexture.id != 0;
+        boardTextureVersion = 0;
+    }
+
+    if (!boardTextureLoaded) {
+        // No render target available, draw the board directly
+        drawMap();
+        if (isMonsterTurnRunning()) return;
+        drawCoffins();
+        drawCharacters();
+        drawItems();
+        return;
+    }
+
+    // Never rebuild while the monster phase is still changing the board
+    if (boardTextureVersion != boardVersion && !isMonsterTurnRunning()) {
+        BeginTextureMode(boardTexture);
+        ClearBackground(BLANK);
+        drawMap();
+        drawCoffins();  // Draw coffins first (background)
+        drawCharacters(); // Draw characters on top
+        drawItems();     // Draw items on top
+        EndTextureMode();
+        boardTextureVersion = boardVersion;
+        boardRebuilds++;
+    }
+
+    // Render textures are stored upside down
+    DrawTextureRec(boardTexture.texture, Rectangle{0, 0, (float)width, -(float)height}, Vector2{0, 0}, WHITE);
+}
+
+bool GameScreen::isBusy() const {
+    return !assetsReady
+        || isMonsterTurnRunning()
+        || !pendingMonsterEvents.empty()
+        || itemTooltip.isVisible
+        || showEndTurnPrompt
+        || guideMessageTimer > 0.0f
+        || pickUpMessageTimer > 0.0f
+        || (showGameMessage && !currentGameMessage.requiresAction && currentGameMessage.timer > 0.0f);
+}
+
 void GameScreen::drawMap() {
     // Draw map background
     DrawRectangleRec(mapArea, {40, 40, 40, 255});
@@ -745,7 +926,7 @@ void GameScreen::drawMap() {
             Vector2{0, 0}, 0.0f, WHITE);
     } else {
         // Draw placeholder map
-        DrawTextEx(gameFont, "GAME MAP", 
+        drawText(gameFont, "GAME MAP", 
             Vector2{mapArea.x + mapArea.width/2 - 50, mapArea.y + mapArea.height/2 - 20}, 
             gameFont.baseSize * 2, 2, GRAY);
     }
@@ -780,8 +961,8 @@ void GameScreen::drawLocations() {
             
             // Draw location name for available move/guide locations
             if (isAvailableMove || isAvailableGuide) {
-                DrawTextEx(gameFont, name.c_str(), 
-                    Vector2{pos.x - MeasureTextEx(gameFont, name.c_str(), gameFont.baseSize, 1).x/2, 
+                drawText(gameFont, name.c_str(), 
+                    Vector2{pos.x - measureText(gameFont, name.c_str(), gameFont.baseSize, 1).x/2, 
                            pos.y + location.radius + 5}, 
                     gameFont.baseSize * 0.8f, 1, GREEN);
             }
@@ -790,7 +971,8 @@ void GameScreen::drawLocations() {
 }
 
 void GameScreen::drawCharacters() {
-    // Draw characters on the map
+    // Sprites first and names afterwards, so the atlas sprites go out in one batch
+    // instead of alternating with the font texture
     for (const auto& [name, location] : mapLocations) {
         if (!location.characters.empty()) {
             Vector2 pos = {mapArea.x + location.position.x, mapArea.y + location.position.y};
@@ -800,71 +982,31 @@ void GameScreen::drawCharacters() {
                 float offsetX = (i - location.characters.size()/2.0f) * screenWidth * 0.03f;  // Increased spacing
                 float imageSize = screenWidth * 0.045f;  // Increased from 0.025f to 0.045f (45% larger)
                 
-                // Try to find and draw the character image
-                bool imageDrawn = false;
-                std::string charName = location.characters[i];
-                
-                // Check for hero images
-                for (const auto& [heroName, texture] : heroImages) {
-                    if (charName.find(heroName) != std::string::npos) {
-                        Rectangle sourceRect = {0, 0, (float)texture.width, (float)texture.height};
-                        Rectangle destRect = {pos.x + offsetX - imageSize/2, pos.y - imageSize/2, imageSize, imageSize};
-                        DrawTexturePro(texture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
-                        imageDrawn = true;
-                        break;
-                    }
-                }
-                
-                // Check for monster images
-                if (!imageDrawn) {
-                    for (const auto& [monsterName, texture] : monsterImages) {
-                        // Handle special case for "Invisible man" vs "InvisibleMan"
-                        std::string searchName = charName;
-                        if (charName == "Invisible man") {
-                            searchName = "InvisibleMan";
-                        }
-                        if (searchName.find(monsterName) != std::string::npos) {
-                            Rectangle sourceRect = {0, 0, (float)texture.width, (float)texture.height};
-                            Rectangle destRect = {pos.x + offsetX - imageSize/2, pos.y - imageSize/2, imageSize, imageSize};
-                            DrawTexturePro(texture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
-                            imageDrawn = true;
-                            break;
-                        }
-                    }
-                }
-                
-                // Check for villager images
-                if (!imageDrawn) {
-                    for (const auto& [villagerName, texture] : villagerImages) {
-                        if (charName.find(villagerName) != std::string::npos) {
-                            Rectangle sourceRect = {0, 0, (float)texture.width, (float)texture.height};
-                            Rectangle destRect = {pos.x + offsetX - imageSize/2, pos.y - imageSize/2, imageSize, imageSize};
-                            DrawTexturePro(texture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
-                            imageDrawn = true;
-                            break;
-                        }
-                    }
-                }
-                
-                // Fallback to colored circle if no image found
-                if (!imageDrawn) {
-                    Color charColor = BLUE;
-                    if (charName.find("Dracula") != std::string::npos) {
-                        charColor = RED;
-                    } else if (charName.find("Invisible") != std::string::npos) {
-                        charColor = PURPLE;
-                    } else if (charName.find("Mayor") != std::string::npos || 
-                               charName.find("Archeologist") != std::string::npos ||
-                               charName.find("Courier") != std::string::npos ||
-                               charName.find("Scientist") != std::string::npos) {
-                        charColor = GREEN;
-                    }
-                    DrawCircle(pos.x + offsetX, pos.y, imageSize/2, charColor);
+                if (i >= location.characterVisuals.size()) break;
+                const CharacterVisual& visual = location.characterVisuals[i];
+                if (visual.sprite) {
+                    Rectangle destRect = {pos.x + offsetX - imageSize/2, pos.y - imageSize/2, imageSize, imageSize};
+                    DrawTexturePro(visual.sprite->texture, visual.sprite->source, destRect, Vector2{0, 0}, 0.0f, WHITE);
+                } else {
+                    // Fallback to colored circle if no image found
+                    DrawCircle(pos.x + offsetX, pos.y, imageSize/2, visual.fallbackColor);
                 }
+            }
+        }
+    }
+
+    for (const auto& [name, location] : mapLocations) {
+        if (!location.characters.empty()) {
+            Vector2 pos = {mapArea.x + location.position.x, mapArea.y + location.position.y};
+            
+            for (size_t i = 0; i < location.characters.size(); i++) {
+                float offsetX = (i - location.characters.size()/2.0f) * screenWidth * 0.03f;
+                float imageSize = screenWidth * 0.045f;
+                const std::string& charName = location.characters[i];
                 
                 // Draw character name with better positioning
-                DrawTextEx(gameFont, charName.c_str(), 
-                    Vector2{pos.x + offsetX - MeasureTextEx(gameFont, charName.c_str(), gameFont.baseSize, 1).x/2, 
+                drawText(gameFont, charName.c_str(), 
+                    Vector2{pos.x + offsetX - measureText(gameFont, charName.c_str(), gameFont.baseSize, 1).x/2, 
                            pos.y + imageSize/2 + 8},  // Increased spacing from 5 to 8
                     gameFont.baseSize * 0.9f, 1, textColor);  // Increased font size from 0.8f to 0.9f
             }
@@ -876,29 +1018,33 @@ void GameScreen::drawItems() {
     // Draw items on the map using itemBag
     if (!gameMap) return;
 
-    for (const auto& pair : gameMap->locations) {
-        const std::string& locationName = pair.first;
-        const auto& location = pair.second;
-        auto mapLocIt = mapLocations.find(locationName);
-        if (mapLocIt == mapLocations.end()) continue;
-
-        Vector2 pos = {mapArea.x + mapLocIt->second.position.x, mapArea.y + mapLocIt->second.position.y};
-
-        const auto& itemsAtLocation = location->getItems();
-        for (const auto& item : itemsAtLocation) {
-            const std::string itemName = item.getItemName();
-            auto it = itemImages.find(itemName);
-            if (it != itemImages.end()) {
-                float imageSize = screenWidth * 0.03f;  // 3% of screen width
-                Rectangle sourceRect = {0, 0, (float)it->second.width, (float)it->second.height};
-                Rectangle destRect = {pos.x - imageSize/2, pos.y + 10 - imageSize/2, imageSize, imageSize};
-                DrawTexturePro(it->second, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
+    // Sprites in one pass, labels in a second one (see drawCharacters)
+    for (int pass = 0; pass < 2; ++pass) {
+        for (const auto& pair : gameMap->locations) {
+            const std::string& locationName = pair.first;
+            const auto& location = pair.second;
+            auto mapLocIt = mapLocations.find(locationName);
+            if (mapLocIt == mapLocations.end()) continue;
+
+            Vector2 pos = {mapArea.x + mapLocIt->second.position.x, mapArea.y + mapLocIt->second.position.y};
+
+            const auto& itemsAtLocation = location->getItems();
+            for (const auto& item : itemsAtLocation) {
+                const std::string itemName = item.getItemName();
+                if (pass == 0) {
+                    auto it = itemImages.find(itemName);
+                    if (it != itemImages.end()) {
+                        float imageSize = screenWidth * 0.03f;  // 3% of screen width
+                        Rectangle destRect = {pos.x - imageSize/2, pos.y + 10 - imageSize/2, imageSize, imageSize};
+                        DrawTexturePro(it->second.texture, it->second.source, destRect, Vector2{0, 0}, 0.0f, WHITE);
+                    }
+                } else {
+                    drawText(gameFont, itemName.c_str(),
+                        Vector2{pos.x - measureText(gameFont, itemName.c_str(), gameFont.baseSize * 0.7f, 1).x/2,
+                                pos.y + 20},
+                        gameFont.baseSize * 0.7f, 1, textColor);
+                }
             }
-
-            DrawTextEx(gameFont, itemName.c_str(),
-                Vector2{pos.x - MeasureTextEx(gameFont, itemName.c_str(), gameFont.baseSize * 0.7f, 1).x/2,
-                        pos.y + 20},
-                gameFont.baseSize * 0.7f, 1, textColor);
         }
     }
 }
@@ -906,28 +1052,29 @@ void GameScreen::drawItems() {
 void GameScreen::drawCoffins() {
     if (!coffinImagesLoaded) return;
     
-    for (const auto& [name, location] : mapLocations) {
-        if (isCoffinLocation(name)) {
+    for (size_t coffinId = 0; coffinId < TaskBoard::COFFIN_COUNT; ++coffinId) {
+        auto it = mapLocations.find(TaskBoard::getCoffinLocation(coffinId));
+        if (it != mapLocations.end()) {
+            const MapLocation& location = it->second;
             Vector2 pos = {mapArea.x + location.position.x, mapArea.y + location.position.y};
             
             // Check if coffin is destroyed using TaskBoard
-            bool isDestroyed = taskBoard.isCoffinDestroyed(name);
+            bool isDestroyed = taskBoard.isCoffinDestroyed(coffinId);
             
-            // Choose appropriate texture
-            Texture2D& texture = isDestroyed ? smashedCoffinTexture : coffinTexture;
+            // Choose appropriate sprite
+            const Sprite& sprite = isDestroyed ? smashedCoffinTexture : coffinTexture;
             
             // Scale image to fit properly
             float imageSize = screenWidth * 0.04f;  // 4% of screen width
             
-            Rectangle sourceRect = {0, 0, (float)texture.width, (float)texture.height};
             Rectangle destRect = {pos.x - imageSize/2, pos.y - imageSize/2, imageSize, imageSize};
             
-            DrawTexturePro(texture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
+            DrawTexturePro(sprite.texture, sprite.source, destRect, Vector2{0, 0}, 0.0f, WHITE);
             
             // Draw coffin label
             std::string label = isDestroyed ? "Destroyed" : "Coffin";
-            DrawTextEx(gameFont, label.c_str(), 
-                Vector2{pos.x - MeasureTextEx(gameFont, label.c_str(), gameFont.baseSize, 1).x/2, 
+            drawText(gameFont, label.c_str(), 
+                Vector2{pos.x - measureText(gameFont, label.c_str(), gameFont.baseSize, 1).x/2, 
                        pos.y + imageSize/2 + 5}, 
                 gameFont.baseSize * 0.8f, 1, isDestroyed ? RED : WHITE);
         }
@@ -946,7 +1093,7 @@ void GameScreen::drawTerrorTracker() {
     const float padding = 10;
     const float titleX = terrorTrackerArea.x + padding;
     const float titleY = terrorTrackerArea.y + padding + 10;
-    DrawTextEx(titleFont, "TERROR LEVEL:", 
+    drawText(titleFont, "TERROR LEVEL:", 
         Vector2{titleX, titleY}, 
         titleFont.baseSize, 2, titleColor);
 
@@ -960,7 +1107,7 @@ void GameScreen::drawTerrorTracker() {
     float totalIndicatorsWidth = (numLevels * indicatorWidth) + ((numLevels - 1) * spacing);
     
     // Position the indicators to be vertically centered and horizontally after the title
-    float startX = titleX + MeasureTextEx(titleFont, "TERROR LEVEL:", titleFont.baseSize, 2).x + 30;
+    float startX = titleX + measureText(titleFont, "TERROR LEVEL:", titleFont.baseSize, 2).x + 30;
     float startY = terrorTrackerArea.y + (terrorTrackerArea.height - indicatorHeight) / 2;
 
     // Draw the 5 rectangle indicators
@@ -979,12 +1126,12 @@ void GameScreen::drawTerrorTracker() {
 
         // Draw the level number centered inside the rectangle
         std::string levelText = std::to_string(i + 1);
-        Vector2 textSize = MeasureTextEx(gameFont, levelText.c_str(), gameFont.baseSize, 1);
+        Vector2 textSize = measureText(gameFont, levelText.c_str(), gameFont.baseSize, 1);
         Vector2 textPos = {
             indicatorRect.x + (indicatorRect.width - textSize.x) / 2,
             indicatorRect.y + (indicatorRect.height - textSize.y) / 2
         };
-        DrawTextEx(gameFont, levelText.c_str(), textPos, gameFont.baseSize, 1, WHITE);
+        drawText(gameFont, levelText.c_str(), textPos, gameFont.baseSize, 1, WHITE);
     }
 }
 
@@ -1001,7 +1148,7 @@ void GameScreen::drawPhaseIndicator() {
     float turnX = turnPhasePanel.x + padding;
     float turnY = turnPhasePanel.y + (turnPhasePanel.height - largeFont.baseSize) / 2;
     
-    DrawTextEx(titleFont, turnText.c_str(), 
+    drawText(titleFont, turnText.c_str(), 
         Vector2{turnX, turnY}, 
         largeFont.baseSize, 1, textColor);
     
@@ -1016,11 +1163,11 @@ void GameScreen::drawPhaseIndicator() {
     }
     
     // Calculate text width to center it with proper margins
-    int textWidth = MeasureTextEx(titleFont, phaseText.c_str(), largeFont.baseSize, 1).x;
+    int textWidth = measureText(titleFont, phaseText.c_str(), largeFont.baseSize, 1).x;
     float phaseX = turnPhasePanel.x + turnPhasePanel.width - textWidth - padding;
     float phaseY = turnPhasePanel.y + (turnPhasePanel.height - largeFont.baseSize) / 2;
     
-    DrawTextEx(titleFont, phaseText.c_str(), 
+    drawText(titleFont, phaseText.c_str(), 
         Vector2{phaseX, phaseY}, 
         largeFont.baseSize, 1, titleColor);
 }
@@ -1053,83 +1200,83 @@ void GameScreen::drawHeroInfoPanel() {
     
     // Draw current hero info (left side)
     float leftY = leftPanel.y + titleSpacing;
-    DrawTextEx(gameFont, "CURRENT HERO", 
+    drawText(gameFont, "CURRENT HERO", 
         Vector2{leftPanel.x + padding, leftY}, 
         gameFont.baseSize, 1, titleColor);
     
     if (currentHero) {
         leftY += lineSpacing * 2;
-        DrawTextEx(gameFont, ("Hero: " + currentHero->getHeroName()).c_str(), 
+        drawText(gameFont, ("Hero: " + currentHero->getHeroName()).c_str(), 
             Vector2{leftPanel.x + padding, leftY}, gameFont.baseSize, 1, textColor);
         
         leftY += lineSpacing;
-        DrawTextEx(gameFont, ("Player: " + currentHero->getPlayerName()).c_str(), 
+        drawText(gameFont, ("Player: " + currentHero->getPlayerName()).c_str(), 
             Vector2{leftPanel.x + padding, leftY}, gameFont.baseSize, 1, textColor);
         
         leftY += lineSpacing;
-        DrawTextEx(gameFont, ("Location: " + currentHero->getCurrentLocation()->getName()).c_str(), 
+        drawText(gameFont, ("Location: " + currentHero->getCurrentLocation()->getName()).c_str(), 
             Vector2{leftPanel.x + padding, leftY}, gameFont.baseSize, 1, textColor);
         
         leftY += lineSpacing;
-        DrawTextEx(gameFont, ("Actions: " + std::to_string(remainingActions) + "/" + std::to_string(maxActions)).c_str(), 
+        drawText(gameFont, ("Actions: " + std::to_string(remainingActions) + "/" + std::to_string(maxActions)).c_str(), 
             Vector2{leftPanel.x + padding, leftY}, gameFont.baseSize, 1, textColor);
         
         leftY += lineSpacing;
         // Show actual perk card information
         const auto& currentHeroPerks = currentHero->getPerkCards();
         if (currentHeroPerks.empty()) {
-            DrawTextEx(gameFont, "Perk Cards: None", 
+            drawText(gameFont, "Perk Cards: None", 
                 Vector2{leftPanel.x + padding, leftY}, gameFont.baseSize, 1, textColor);
         } else {
-            DrawTextEx(gameFont, ("Perk Cards: " + std::to_string(currentHeroPerks.size()) + " (Hover to view)").c_str(), 
+            drawText(gameFont, ("Perk Cards: " + std::to_string(currentHeroPerks.size()) + " (Hover to view)").c_str(), 
                 Vector2{leftPanel.x + padding, leftY}, gameFont.baseSize, 1, textColor);
         }
         
         leftY += lineSpacing;
         // Show actual item information
         const auto& currentHeroItems = currentHero->getItems();
-        DrawTextEx(gameFont, ("Items: " + std::to_string(currentHeroItems.size())).c_str(), 
+        drawText(gameFont, ("Items: " + std::to_string(currentHeroItems.size())).c_str(), 
             Vector2{leftPanel.x + padding, leftY}, gameFont.baseSize, 1, textColor);
     }
     
     // Draw other hero info (right side)
     float rightY = rightPanel.y + titleSpacing;
-    DrawTextEx(gameFont, "OTHER HERO", 
+    drawText(gameFont, "OTHER HERO", 
         Vector2{rightPanel.x + padding, rightY}, 
         gameFont.baseSize, 1, titleColor);
     
     if (otherHero) {
         rightY += lineSpacing * 2;
-        DrawTextEx(gameFont, ("Hero: " + otherHero->getHeroName()).c_str(), 
+        drawText(gameFont, ("Hero: " + otherHero->getHeroName()).c_str(), 
             Vector2{rightPanel.x + padding, rightY}, gameFont.baseSize, 1, textColor);
         
         rightY += lineSpacing;
-        DrawTextEx(gameFont, ("Player: " + otherHero->getPlayerName()).c_str(), 
+        drawText(gameFont, ("Player: " + otherHero->getPlayerName()).c_str(), 
             Vector2{rightPanel.x + padding, rightY}, gameFont.baseSize, 1, textColor);
         
         rightY += lineSpacing;
-        DrawTextEx(gameFont, ("Location: " + otherHero->getCurrentLocation()->getName()).c_str(), 
+        drawText(gameFont, ("Location: " + otherHero->getCurrentLocation()->getName()).c_str(), 
             Vector2{rightPanel.x + padding, rightY}, gameFont.baseSize, 1, textColor);
         
         rightY += lineSpacing;
-        DrawTextEx(gameFont, ("Actions: " + std::to_string(otherHero->getRemainingActions()) + "/" + std::to_string(otherHero->getMaxActions())).c_str(), 
+        drawText(gameFont, ("Actions: " + std::to_string(otherHero->getRemainingActions()) + "/" + std::to_string(otherHero->getMaxActions())).c_str(), 
             Vector2{rightPanel.x + padding, rightY}, gameFont.baseSize, 1, textColor);
         
         rightY += lineSpacing;
         // Show actual perk card information for other hero
         const auto& otherHeroPerks = otherHero->getPerkCards();
         if (otherHeroPerks.empty()) {
-            DrawTextEx(gameFont, "Perk Cards: None", 
+            drawText(gameFont, "Perk Cards: None", 
                 Vector2{rightPanel.x + padding, rightY}, gameFont.baseSize, 1, textColor);
         } else {
-            DrawTextEx(gameFont, ("Perk Cards: " + std::to_string(otherHeroPerks.size()) + " (Hover to view)").c_str(), 
+            drawText(gameFont, ("Perk Cards: " + std::to_string(otherHeroPerks.size()) + " (Hover to view)").c_str(), 
                 Vector2{rightPanel.x + padding, rightY}, gameFont.baseSize, 1, textColor);
         }
         
         rightY += lineSpacing;
         // Show actual item information for other hero
         const auto& otherHeroItems = otherHero->getItems();
-        DrawTextEx(gameFont, ("Items: " + std::to_string(otherHeroItems.size())).c_str(), 
+        drawText(gameFont, ("Items: " + std::to_string(otherHeroItems.size())).c_str(), 
             Vector2{rightPanel.x + padding, rightY}, gameFont.baseSize, 1, textColor);
     }
 }
@@ -1138,7 +1285,7 @@ void GameScreen::drawActionsPanel() {
     DrawRectangleRec(actionsPanel, {60, 60, 60, 255});
     DrawRectangleLinesEx(actionsPanel, 2, WHITE);
     float padding = screenWidth * 0.005f;
-    DrawTextEx(gameFont, "ACTIONS", Vector2{actionsPanel.x + padding, actionsPanel.y + padding}, gameFont.baseSize * 1.5, 2, titleColor);
+    drawText(gameFont, "ACTIONS", Vector2{actionsPanel.x + padding, actionsPanel.y + padding}, gameFont.baseSize * 1.5, 2, titleColor);
     Vector2 mousePos = GetMousePosition();
     for (const auto& button : actionButtons) {
         bool isHovered = CheckCollisionPointRec(mousePos, button.bounds);
@@ -1146,8 +1293,8 @@ void GameScreen::drawActionsPanel() {
         Color buttonColor = isDisabled ? GRAY : (isHovered ? button.hoverColor : button.color);
         DrawRectangleRec(button.bounds, buttonColor);
         DrawRectangleLinesEx(button.bounds, 1, WHITE);
-        int textWidth = MeasureTextEx(gameFont, button.name.c_str(), gameFont.baseSize, 1).x;
-        DrawTextEx(gameFont, button.name.c_str(), Vector2{button.bounds.x + button.bounds.width/2 - textWidth/2, button.bounds.y + button.bounds.height/2 - gameFont.baseSize/2}, gameFont.baseSize, 1, isDisabled ? DARKGRAY : textColor);
+        int textWidth = measureText(gameFont, button.name.c_str(), gameFont.baseSize, 1).x;
+        drawText(gameFont, button.name.c_str(), Vector2{button.bounds.x + button.bounds.width/2 - textWidth/2, button.bounds.y + button.bounds.height/2 - gameFont.baseSize/2}, gameFont.baseSize, 1, isDisabled ? DARKGRAY : textColor);
     }
 }
 
@@ -1160,45 +1307,39 @@ void GameScreen::drawEvidencePanel() {
     float padding = screenWidth * 0.005f;  // 0.5% padding
     
     // Draw panel title
-    DrawTextEx(gameFont, "INVISIBLE MAN EVIDENCES", 
+    drawText(gameFont, "INVISIBLE MAN EVIDENCES", 
         Vector2{evidencePanel.x + padding, evidencePanel.y + padding}, 
         gameFont.baseSize * 1.2, 2, titleColor);
     
-    // Get evidence delivery status from TaskBoard
-    const auto& evidenceLocations = taskBoard.getInvisibleManCluesDelivered();
-    
-    // Define the 5 evidence locations
-    std::vector<std::string> locations = {"Inn", "Mansion", "Barn", "Laboratory", "Institute"};
-    
     // Calculate section dimensions
-    float sectionWidth = (evidencePanel.width - padding * 3) / 5 - 8;  // 5 sections with padding
+    float sectionWidth = (evidencePanel.width - padding * 3) / TaskBoard::CLUE_COUNT - 8;  // 5 sections with padding
     float sectionHeight = evidencePanel.height - gameFont.baseSize * 2 - padding * 3 + 15;  // Leave space for title
     float startX = evidencePanel.x + padding;
     float startY = evidencePanel.y + gameFont.baseSize * 1.5 + padding;
     
     // Draw each evidence section
-    for (size_t i = 0; i < locations.size(); i++) {
+    for (size_t i = 0; i < TaskBoard::CLUE_COUNT; i++) {
+        const std::string& locationName = TaskBoard::getClueLocation(i);
         float sectionX = startX + i * (sectionWidth + padding);
         Rectangle sectionRect = {sectionX, startY, sectionWidth, sectionHeight};
         
         // Draw section background
-        bool isDelivered = evidenceLocations.find(locations[i]) != evidenceLocations.end() && 
-                          evidenceLocations.at(locations[i]);
+        bool isDelivered = taskBoard.isClueDelivered(i);
         Color sectionColor = isDelivered ? successColor : (Color){40, 40, 40, 255};
         DrawRectangleRec(sectionRect, sectionColor);
         DrawRectangleLinesEx(sectionRect, 1, WHITE);
         
         // Draw location name
-        int textWidth = MeasureTextEx(gameFont, locations[i].c_str(), gameFont.baseSize * 0.8f, 1).x;
-        DrawTextEx(gameFont, locations[i].c_str(), 
+        int textWidth = measureText(gameFont, locationName.c_str(), gameFont.baseSize * 0.8f, 1).x;
+        drawText(gameFont, locationName.c_str(), 
             Vector2{sectionX + sectionWidth/2 - textWidth/2 - 5, startY + padding}, 
             gameFont.baseSize, 1, textColor);
         
         // Draw evidence status
         std::string status = isDelivered ? "Delivered" : "Empty";
         Color statusColor = isDelivered ? WHITE : GRAY;
-        int statusWidth = MeasureTextEx(gameFont, status.c_str(), gameFont.baseSize * 0.7f, 1).x;
-        DrawTextEx(gameFont, status.c_str(), 
+        int statusWidth = measureText(gameFont, status.c_str(), gameFont.baseSize * 0.7f, 1).x;
+        drawText(gameFont, status.c_str(), 
             Vector2{sectionX + sectionWidth/2 - statusWidth/2, startY + sectionHeight - gameFont.baseSize * 0.7f - padding}, 
             gameFont.baseSize * 0.7f, 1, statusColor);
     }
@@ -1212,7 +1353,7 @@ void GameScreen::drawMonsterPhasePanel() {
     float padding = screenWidth * 0.005f;
     
     // Draw panel title
-    DrawTextEx(gameFont, "MONSTER PHASE", 
+    drawText(gameFont, "MONSTER PHASE", 
         Vector2{monsterPhasePanel.x + padding, monsterPhasePanel.y + padding}, 
         gameFont.baseSize * 1.5, 2, titleColor);
     
@@ -1223,7 +1364,7 @@ void GameScreen::drawMonsterPhasePanel() {
         
         // Show monster card info
         if (!currentMonsterCard.empty()) {
-            DrawTextEx(gameFont, ("Monster Card: " + currentMonsterCard).c_str(), 
+            drawText(gameFont, ("Monster Card: " + currentMonsterCard).c_str(), 
                 Vector2{monsterPhasePanel.x + padding, startY}, 
                 gameFont.baseSize, 1, textColor);
         }
@@ -1234,39 +1375,39 @@ void GameScreen::drawMonsterPhasePanel() {
             for (const auto& result : diceResults) {
                 diceText += result + " ";
             }
-            DrawTextEx(gameFont, diceText.c_str(), 
+            drawText(gameFont, diceText.c_str(), 
                 Vector2{monsterPhasePanel.x + padding, startY + gameFont.baseSize + padding}, 
                 gameFont.baseSize, 1, textColor);
         }
         
         // Show frenzied monster
         if (!currentFrenziedMonster.empty()) {
-            DrawTextEx(gameFont, ("Frenzied: " + currentFrenziedMonster).c_str(), 
+            drawText(gameFont, ("Frenzied: " + currentFrenziedMonster).c_str(), 
                 Vector2{monsterPhasePanel.x + padding, startY + (gameFont.baseSize + padding) * 2}, 
                 gameFont.baseSize, 1, textColor);
         }
         
         // Show instruction
         std::string instruction = "Press SPACE to continue";
-        int textWidth = MeasureTextEx(gameFont, instruction.c_str(), gameFont.baseSize, 1).x;
-        DrawTextEx(gameFont, instruction.c_str(), 
+        int textWidth = measureText(gameFont, instruction.c_str(), gameFont.baseSize, 1).x;
+        drawText(gameFont, instruction.c_str(), 
             Vector2{monsterPhasePanel.x + (monsterPhasePanel.width - textWidth) / 2, 
                    monsterPhasePanel.y + monsterPhasePanel.height - gameFont.baseSize - padding}, 
             gameFont.baseSize, 1, GRAY);
     } else {
         // Draw default monster info
         std::string monsterName = "Current Monster: " + (dracula ? dracula->getMonsterName() : "None");
-        DrawTextEx(gameFont, monsterName.c_str(), 
+        drawText(gameFont, monsterName.c_str(), 
             Vector2{monsterPhasePanel.x + padding, monsterPhasePanel.y + 50}, 
             gameFont.baseSize, 1, textColor);
         
         std::string monsterLocation = "Location: " + (dracula ? dracula->getCurrentLocation()->getName() : "N/A");
-        DrawTextEx(gameFont, monsterLocation.c_str(), 
+        drawText(gameFont, monsterLocation.c_str(), 
             Vector2{monsterPhasePanel.x + padding, monsterPhasePanel.y + 80}, 
             gameFont.baseSize, 1, textColor);
         
         std::string monsterAction = "Current Action: " + std::string(dracula ? "Active" : "Idle");
-        DrawTextEx(gameFont, monsterAction.c_str(), 
+        drawText(gameFont, monsterAction.c_str(), 
             Vector2{monsterPhasePanel.x + padding, monsterPhasePanel.y + 110}, 
             gameFont.baseSize, 1, textColor);
     }
@@ -1287,7 +1428,7 @@ void GameScreen::drawMonsterPhaseUI() {
     
     // Draw title
     float padding = screenWidth * 0.005f;
-    DrawTextEx(gameFont, "MONSTER PHASE", 
+    drawText(gameFont, "MONSTER PHASE", 
         Vector2{monsterPhaseArea.x + padding, monsterPhaseArea.y + padding}, 
         gameFont.baseSize * 1.5, 2, titleColor);
     
@@ -1308,10 +1449,19 @@ void GameScreen::drawMonsterPhaseUI() {
     drawDiceResultsBox();
     drawFrenzyMarkerBox();
     
+    // Latest monster event, presented by updateMonsterTurn()
+    if (!lastMonsterEventText.empty()) {
+        int eventWidth = measureText(gameFont, lastMonsterEventText, gameFont.baseSize, 1).x;
+        drawText(gameFont, lastMonsterEventText,
+            Vector2{monsterPhaseArea.x + (monsterPhaseArea.width - eventWidth) / 2,
+                   monsterPhaseArea.y + monsterPhaseArea.height - (gameFont.baseSize + padding) * 2},
+            gameFont.baseSize, 1, textColor);
+    }
+
     // Draw advancement instruction
     std::string instructionText = "Press SPACE to continue to next turn";
-    int textWidth = MeasureTextEx(gameFont, instructionText.c_str(), gameFont.baseSize, 1).x;
-    DrawTextEx(gameFont, instructionText.c_str(), 
+    int textWidth = measureText(gameFont, instructionText.c_str(), gameFont.baseSize, 1).x;
+    drawText(gameFont, instructionText.c_str(), 
         Vector2{monsterPhaseArea.x + (monsterPhaseArea.width - textWidth) / 2, 
                monsterPhaseArea.y + monsterPhaseArea.height - gameFont.baseSize - padding}, 
         gameFont.baseSize, 1, GRAY);
@@ -1326,7 +1476,7 @@ void GameScreen::drawMonsterCardBox() {
     float padding = screenWidth * 0.005f;  // 0.5% padding
     
     // Draw title
-    DrawTextEx(gameFont, "MONSTER CARD", 
+    drawText(gameFont, "MONSTER CARD", 
         Vector2{monsterCardBox.x + padding, monsterCardBox.y + padding}, 
         gameFont.baseSize, 1, titleColor);
     
@@ -1341,35 +1491,30 @@ void GameScreen::drawMonsterCardBox() {
     bool monsterCardsOver = monsterManager.isEmpty();
     std::string cardName = monsterManager.getCurrentCardName();
     std::string eventText = monsterManager.getCurrentCard().getEventText();
-    std::string imageName = convertMonsterCardNameToImage(cardName);
 
     if (monsterCardsOver) {
         // Show message if deck is empty
         float textX = monsterCardBox.x + padding * 2 + imageWidth;
         float textY = monsterCardBox.y + titleHeight;
-        DrawTextEx(gameFont, "Monster cards are over", Vector2{textX, textY}, gameFont.baseSize, 1, textColor);
+        drawText(gameFont, "Monster cards are over", Vector2{textX, textY}, gameFont.baseSize, 1, textColor);
     } else {
         // Always show the current monster card image if available
-        if (!imageName.empty()) {
-            std::string cardPath = getAssetPath("Horrified_Assets/Monster_Cards/" + imageName);
-            if (FileExists(cardPath.c_str())) {
-                Texture2D cardTexture = LoadTexture(cardPath.c_str());
-                if (cardTexture.id != 0) {
-                    float scale = std::min(imageWidth / cardTexture.width, availableHeight / cardTexture.height);
-                    float scaledWidth = cardTexture.width * scale;
-                    float scaledHeight = cardTexture.height * scale;
-                    Rectangle sourceRect = {0, 0, (float)cardTexture.width, (float)cardTexture.height};
-                    Rectangle destRect = {monsterCardBox.x + padding,
-                                       monsterCardBox.y + titleHeight + (availableHeight - scaledHeight) / 2,
-                                       scaledWidth, scaledHeight};
-                    DrawTexturePro(cardTexture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
-                }
-            }
+        auto cardImage = monsterCardImages.find(cardName);
+        if (cardImage != monsterCardImages.end() && cardImage->second.id != 0) {
+            const Texture2D& cardTexture = cardImage->second;
+            float scale = std::min(imageWidth / cardTexture.width, availableHeight / cardTexture.height);
+            float scaledWidth = cardTexture.width * scale;
+            float scaledHeight = cardTexture.height * scale;
+            Rectangle sourceRect = {0, 0, (float)cardTexture.width, (float)cardTexture.height};
+            Rectangle destRect = {monsterCardBox.x + padding,
+                               monsterCardBox.y + titleHeight + (availableHeight - scaledHeight) / 2,
+                               scaledWidth, scaledHeight};
+            DrawTexturePro(cardTexture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
         }
         // Draw card name above event text, next to image
         float nameX = monsterCardBox.x + padding * 2 + imageWidth;
         float nameY = monsterCardBox.y + titleHeight;
-        DrawTextEx(gameFont, cardName.c_str(), Vector2{nameX, nameY}, gameFont.baseSize, 1, titleColor);
+        drawText(gameFont, cardName.c_str(), Vector2{nameX, nameY}, gameFont.baseSize, 1, titleColor);
         // Draw event text below card name
         float textY = nameY + gameFont.baseSize + 5;
         float textX = nameX;
@@ -1382,7 +1527,7 @@ void GameScreen::drawMonsterCardBox() {
             if (c == ' ' || c == '\n') {
                 if (!word.empty()) {
                     std::string testLine = currentLine.empty() ? word : currentLine + " " + word;
-                    float lineWidth = MeasureTextEx(gameFont, testLine.c_str(), gameFont.baseSize * 0.9f, 1).x;
+                    float lineWidth = measureText(gameFont, testLine.c_str(), gameFont.baseSize * 0.9f, 1).x;
                     if (lineWidth <= eventTextWidth) {
                         currentLine = testLine;
                     } else {
@@ -1403,7 +1548,7 @@ void GameScreen::drawMonsterCardBox() {
         }
         if (!word.empty()) {
             std::string testLine = currentLine.empty() ? word : currentLine + " " + word;
-            float lineWidth = MeasureTextEx(gameFont, testLine.c_str(), gameFont.baseSize * 0.9f, 1).x;
+            float lineWidth = measureText(gameFont, testLine.c_str(), gameFont.baseSize * 0.9f, 1).x;
             if (lineWidth <= eventTextWidth) {
                 currentLine = testLine;
             } else {
@@ -1419,7 +1564,7 @@ void GameScreen::drawMonsterCardBox() {
         }
         float lineHeight = gameFont.baseSize * 0.9f + 3;
         for (size_t i = 0; i < wrappedLines.size() && textY + i * lineHeight < monsterCardBox.y + monsterCardBox.height - padding; i++) {
-            DrawTextEx(gameFont, wrappedLines[i].c_str(), Vector2{textX, textY + i * lineHeight}, gameFont.baseSize * 0.9f, 1, textColor);
+            drawText(gameFont, wrappedLines[i].c_str(), Vector2{textX, textY + i * lineHeight}, gameFont.baseSize * 0.9f, 1, textColor);
         }
     }
 }
@@ -1434,7 +1579,7 @@ void GameScreen::drawDiceResultsBox() {
     float lineSpacing = screenHeight * 0.012f;  // 1.2% line spacing
     
     // Draw title
-    DrawTextEx(gameFont, "DICE RESULTS", 
+    drawText(gameFont, "DICE RESULTS", 
         Vector2{diceResultsBox.x + padding, diceResultsBox.y + padding}, 
         gameFont.baseSize, 1, titleColor);
     
@@ -1445,13 +1590,13 @@ void GameScreen::drawDiceResultsBox() {
         if (i < diceResults.size() - 1) resultsText += " ";
     }
     
-    DrawTextEx(gameFont, resultsText.c_str(), 
+    drawText(gameFont, resultsText.c_str(), 
         Vector2{diceResultsBox.x + padding, diceResultsBox.y + gameFont.baseSize + padding + lineSpacing}, 
         gameFont.baseSize, 1, textColor);
     
     // Draw legend
     std::string legendText = "[!] = Power\n[*] = Strike\n[ ] = Empty";
-    DrawTextEx(gameFont, legendText.c_str(), 
+    drawText(gameFont, legendText.c_str(), 
         Vector2{diceResultsBox.x + padding, diceResultsBox.y + gameFont.baseSize + padding + lineSpacing * 3}, 
         gameFont.baseSize, 1, GRAY);
 }
@@ -1466,47 +1611,41 @@ void GameScreen::drawFrenzyMarkerBox() {
     float lineSpacing = screenHeight * 0.012f;  // 1.2% line spacing
     
     // Draw title
-    DrawTextEx(gameFont, "FRENZIED MONSTER", 
+    drawText(gameFont, "FRENZIED MONSTER", 
         Vector2{frenzyMarkerBox.x + padding, frenzyMarkerBox.y + padding}, 
         gameFont.baseSize, 1, titleColor);
     
     // Draw frenzied monster name
-    DrawTextEx(gameFont, currentFrenziedMonster.c_str(), 
+    drawText(gameFont, currentFrenziedMonster.c_str(), 
         Vector2{frenzyMarkerBox.x + padding, frenzyMarkerBox.y + gameFont.baseSize + padding + lineSpacing}, 
         gameFont.baseSize, 1, textColor);
     
-    // Load frenzied monster texture if needed
-    if (!currentFrenziedMonster.empty() && !frenziedMonsterTextureLoaded) {
-        loadFrenziedMonsterTexture();
-    }
-    
-    // Draw monster image if texture is loaded
-    if (frenziedMonsterTextureLoaded && frenziedMonsterTexture.id != 0) {
+    // The monster portraits are already in the sprite atlas
+    const Sprite* frenziedSprite = findFrenziedMonsterSprite();
+    if (frenziedSprite != nullptr) {
         // Scale image to fit in box with responsive margins
         float imageMargin = padding * 2;
         float textAreaHeight = gameFont.baseSize + padding + lineSpacing * 2;
-        float scale = std::min((frenzyMarkerBox.width - imageMargin) / frenziedMonsterTexture.width, 
-                             (frenzyMarkerBox.height - imageMargin - textAreaHeight) / frenziedMonsterTexture.height);
-        float scaledWidth = frenziedMonsterTexture.width * scale;
-        float scaledHeight = frenziedMonsterTexture.height * scale;
+        float scale = std::min((frenzyMarkerBox.width - imageMargin) / frenziedSprite->source.width, 
+                             (frenzyMarkerBox.height - imageMargin - textAreaHeight) / frenziedSprite->source.height);
+        float scaledWidth = frenziedSprite->source.width * scale;
+        float scaledHeight = frenziedSprite->source.height * scale;
         
-        Rectangle sourceRect = {0, 0, (float)frenziedMonsterTexture.width, (float)frenziedMonsterTexture.height};
         Rectangle destRect = {frenzyMarkerBox.x + (frenzyMarkerBox.width - scaledWidth) / 2,
                            frenzyMarkerBox.y + textAreaHeight,
                            scaledWidth, scaledHeight};
         
-        DrawTexturePro(frenziedMonsterTexture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
-        // Do NOT unload the texture here; keep it loaded until monster phase ends
+        DrawTexturePro(frenziedSprite->texture, frenziedSprite->source, destRect, Vector2{0, 0}, 0.0f, WHITE);
     }
 }
 
 void GameScreen::drawItemTooltip() {
     if (itemTooltip.isVisible) {
         DrawRectangle(itemTooltip.position.x, itemTooltip.position.y, 200, 50, {0, 0, 0, 150});
-        DrawTextEx(gameFont, itemTooltip.name.c_str(), 
+        drawText(gameFont, itemTooltip.name.c_str(), 
             Vector2{itemTooltip.position.x + 10, itemTooltip.position.y + 10}, 
             gameFont.baseSize, 1, WHITE);
-        DrawTextEx(gameFont, itemTooltip.description.c_str(), 
+        drawText(gameFont, itemTooltip.description.c_str(), 
             Vector2{itemTooltip.position.x + 10, itemTooltip.position.y + 30}, 
             gameFont.baseSize, 1, GRAY);
     }
@@ -1592,32 +1731,12 @@ void GameScreen::moveHero(const std::string& location) {
     
     try {
         auto newLocation = gameMap->getLocation(location);
-        if (!newLocation) return;
-        if (currentHero->getCurrentLocation()->getName() == location) return;
-        
-        const auto& neighbors = currentHero->getCurrentLocation()->getNeighbors();
-        bool isNeighbor = false;
-        for (const auto& neighbor : neighbors) {
-            if (neighbor && neighbor->getName() == location) {
-                isNeighbor = true;
-                break;
-            }
-        }
-        if (!isNeighbor) return;
+        currentHero->checkMove(newLocation);
 
         // Store data needed for the action
         pendingMoveLocation = location;
         
-        villagersToMove.clear();
-        auto characters = currentHero->getCurrentLocation()->getCharacters();
-        for (const auto& character : characters) {
-            if (character != "Archeologist" && character != "Mayor" && character != "Scientist" && 
-                character != "Courier" && character != "Dracula" && character != "Invisible man") {
-                villagersToMove.push_back(character);
-            }
-        }
-        
-        if (!villagersToMove.empty()) {            
+        if (currentHero->getCurrentLocation()->hasVillagers()) {            
             // 1. Build the question string
             std::string question = "There are villagers here. Move them with you?";
             
@@ -1639,63 +1758,13 @@ void GameScreen::moveHero(const std::string& location) {
 }
 
 void GameScreen::completeHeroMove(bool withVillagers) {
-    // 1. Get the target location using the stored "pending" variable.
-    auto newLocation = gameMap->getLocation(pendingMoveLocation);
-    if (!newLocation) return; // Safety check in case the location name is invalid.
+    auto newLocation = gameMap->findLocation(pendingMoveLocation);
+    pendingMoveLocation.clear();
+    if (!newLocation) return;
 
-    // 2. Check the player's decision about moving villagers.
-    if (withVillagers && !villagersToMove.empty()) {
-        std::cout << "Moving villagers with hero..." << std::endl;
-        
-        // Loop through the list of villagers that were at the hero's starting location.
-        for (const auto& villagerName : villagersToMove) {
-            try {
-                auto villager = villagerManager.getVillager(villagerName);
-                if (villager) {
-                    // Capture perk count before move to detect perk grant
-                    size_t prevPerkCount = currentHero->getPerkCards().size();
-                    std::string villagerNameCopy = villager->getVillagerName();
-                    // Move each villager to the same new location.
-                    villager->move(newLocation, currentHero, &perkDeck);
-                    // If villager left the board (reached safe place), show message
-                    if (!villager->getCurrentLocation()) {
-                        addGameMessage(villagerNameCopy + " has reached their safe place and left the game!");
-                    }
-                    // If a perk was granted to the guiding hero, show message
-                    const auto& heroPerks = currentHero->getPerkCards();
-                    if (heroPerks.size() > prevPerkCount) {
-                        const auto& grantedPerk = heroPerks.back();
-                        addGameMessage(currentHero->getPlayerName() + std::string(" (") + currentHero->getHeroName() + ") received perk card: " +
-                                       PerkCard::perkTypeToString(grantedPerk.getType()) +
-                                       " for helping " + villagerNameCopy + " reach their safe place!");
-                    }
-                }
-            } catch (const std::exception& e) {
-                std::cout << "Error moving villager " << villagerName << ": " << e.what() << std::endl;
-            }
-        }
-    }
-    
-    // 3. Move the hero itself.
-    currentHero->getCurrentLocation()->removeCharacter(currentHero->getHeroName());
-    newLocation->addCharacter(currentHero->getHeroName());
-    currentHero->setCurrentLocation(newLocation);
-    
-    // 4. Update the map display to show all characters in their new positions.
-    initializeLocations();
-    
-    // 5. Consume one action point. This is only done *after* the move is complete.
-    remainingActions--;
-    if (remainingActions <= 0) {
-        showEndTurnPrompt = true;
-        endTurnPromptTimer = 3.0f;
+    if (submitHeroAction(GameAction::move(newLocation, withVillagers))) {
+        std::cout << currentHero->getHeroName() << " (" << currentHero->getPlayerName() << ") moved to " << newLocation->getName() << std::endl;
     }
-    
-    std::cout << currentHero->getHeroName() << " (" << currentHero->getPlayerName() << ") moved to " << pendingMoveLocation << std::endl;
-
-    // 6. Clean up the temporary variables used for this specific action.
-    pendingMoveLocation.clear();
-    villagersToMove.clear();
 }
 
 void GameScreen::startGuideAction() {
@@ -1703,50 +1772,11 @@ void GameScreen::startGuideAction() {
     
     try {
         // Clear previous state
-        guidableVillagers.clear();
-        guidableMoves.clear();
         selectedVillager = nullptr;
         availableGuideLocations.clear();
-        
-        auto heroLoc = currentHero->getCurrentLocation();
-        const auto& heroNeighbors = heroLoc->getNeighbors();
-
-        // Find all guidable villagers (same logic as in hero.cpp)
-        for (const auto& locPair : gameMap->locations) {
-            auto loc = locPair.second;
-            const auto& characters = loc->getCharacters();
-            for (const auto& character : characters) {
-                if (character == "Archeologist" || character == "Mayor" || character == "Scientist" || character == "Courier" || character == "Dracula" || character == "Invisible man") continue;
-
-                std::vector<std::shared_ptr<Location>> possibleMoves;
-
-                if (loc->getName() == heroLoc->getName()) {
-                    for (const auto& neighbor : heroNeighbors) {
-                        possibleMoves.push_back(neighbor);
-                    }
-                } else {
-                    const auto& vNeighbors = loc->getNeighbors();
-                    for (const auto& vNeighbor : vNeighbors) {
-                        if (vNeighbor->getName() == heroLoc->getName()) {
-                            possibleMoves.push_back(heroLoc);
-                            break;
-                        }
-                    }
-                }
+        guideOptions = currentHero->getGuideOptions(villagerManager);
 
-                if (!possibleMoves.empty()) {
-                    try {
-                        auto villager = villagerManager.getVillager(character);
-                        guidableVillagers.push_back(villager);
-                        guidableMoves.push_back(possibleMoves);
-                    } catch (const std::exception& e) {
-                        std::cout << e.what() << std::endl;
-                    }
-                }
-            }
-        }
-
-        if (guidableVillagers.empty()) {
+        if (guideOptions.empty()) {
             guideMessage = "There are no villagers on the map that you can guide right now.";
             guideMessageTimer = 3.0f;
             return;
@@ -1762,12 +1792,12 @@ void GameScreen::startGuideAction() {
 }
 
 void GameScreen::selectVillagerToGuide(int villagerIndex) {
-    if (villagerIndex < 0 || villagerIndex >= static_cast<int>(guidableVillagers.size())) {
+    if (villagerIndex < 0 || villagerIndex >= static_cast<int>(guideOptions.size())) {
         return;
     }
     
-    selectedVillager = guidableVillagers[villagerIndex];
-    availableGuideLocations = guidableMoves[villagerIndex];
+    selectedVillager = guideOptions[villagerIndex].villager;
+    availableGuideLocations = guideOptions[villagerIndex].destinations;
     
     showGuideVillagers = false;
     showGuideLocations = false; // Don't show overlay, show green circles on map instead
@@ -1778,48 +1808,14 @@ void GameScreen::selectLocationToGuide(int locationIndex) {
         return;
     }
     
-    try {
-        auto chosenLocation = availableGuideLocations[locationIndex];
-        // Capture perk count before move to detect perk grant
-        size_t prevPerkCount = currentHero->getPerkCards().size();
-        std::string villagerNameCopy = selectedVillager->getVillagerName();
-        selectedVillager->move(chosenLocation, currentHero, &perkDeck);
-        // If villager left the board (reached safe place), show message
-        if (!selectedVillager->getCurrentLocation()) {
-            addGameMessage(villagerNameCopy + " has reached their safe place and left the game!");
-        }
-        // If a perk was granted to the guiding hero, show message
-        const auto& heroPerks = currentHero->getPerkCards();
-        if (heroPerks.size() > prevPerkCount) {
-            const auto& grantedPerk = heroPerks.back();
-            addGameMessage(currentHero->getPlayerName() + std::string(" (") + currentHero->getHeroName() + ") received perk card: " +
-                           PerkCard::perkTypeToString(grantedPerk.getType()) +
-                           " for helping " + villagerNameCopy + " reach their safe place!");
-        }
-        
-        // Update map display
-        initializeLocations();
-        
-        remainingActions--;
-        if (remainingActions <= 0) {
-            showEndTurnPrompt = true;
-            endTurnPromptTimer = 3.0f;
-        }
-        
-        // Clear guide state
-        cancelGuideAction();
-        
-    } catch (const std::exception& e) {
-        std::cout << "Error during guide: " << e.what() << std::endl;
-        cancelGuideAction();
-    }
+    submitHeroAction(GameAction::guide(selectedVillager, availableGuideLocations[locationIndex]));
+    cancelGuideAction();
 }
 
 void GameScreen::cancelGuideAction() {
     showGuideVillagers = false;
     showGuideLocations = false;
-    guidableVillagers.clear();
-    guidableMoves.clear();
+    guideOptions.clear();
     selectedVillager = nullptr;
     availableGuideLocations.clear();
     selectedAction = "";
@@ -1833,7 +1829,7 @@ void GameScreen::startPickUpAction(const std::string& location) {
         auto currentLoc = currentHero->getCurrentLocation();
         if (!currentLoc) return;
 
-        itemWasPickedUpThisTurn = false;
+        pickedUpItems.clear();
         
         availableItems = currentLoc->getItems();
         pickUpLocation = location;
@@ -1857,45 +1853,20 @@ void GameScreen::pickUpItem(int itemIndex) {
         return;
     }
     
-    try {
-        // Get the item to pick up
-        Item itemToPickUp = availableItems[itemIndex];
-        
-        // Add item to hero's inventory
-        currentHero->addItem(itemToPickUp);
-        
-        // Remove item from location
-        auto currentLoc = currentHero->getCurrentLocation();
-        if (currentLoc) {
-            currentLoc->removeItem(itemToPickUp);
-        }
-        
-        // Remove item from available items list
-        availableItems.erase(availableItems.begin() + itemIndex);
-        
-        // Update map display
-        initializeLocations();
-
-        itemWasPickedUpThisTurn = true;
-        
-        // If no more items, close the overlay and consume action
-        if (availableItems.empty()) {
-            cancelPickUpAction();
-        }
-        
-    } catch (const std::exception& e) {
-        std::cout << "Error during pick up: " << e.what() << std::endl;
+    // The items move when the overlay closes, all in one action
+    pickedUpItems.push_back(availableItems[itemIndex]);
+    availableItems.erase(availableItems.begin() + itemIndex);
+    
+    // If no more items, close the overlay
+    if (availableItems.empty()) {
+        cancelPickUpAction();
     }
 }
 
 void GameScreen::cancelPickUpAction() {
-    // THE FIX: Check the flag. If true, consume one action.
-    if (itemWasPickedUpThisTurn) {
-        remainingActions--;
-        if (remainingActions <= 0) {
-            showEndTurnPrompt = true;
-            endTurnPromptTimer = 3.0f;
-        }
+    if (!pickedUpItems.empty()) {
+        submitHeroAction(GameAction::pickUp(std::move(pickedUpItems)));
+        pickedUpItems.clear();
     }
 
     // Now, perform the normal cleanup.
@@ -1913,22 +1884,13 @@ void GameScreen::advanceMonster(const std::string& location) {
     if (!currentHero || remainingActions <= 0) return;
     
     try {
-        // Check if we're at Precinct (evidence delivery) or coffin location
-        if (currentHero->getCurrentLocation()->getName() == "Precinct") {
-            // Evidence delivery for Invisible Man
-            showAdvanceItemSelection = true;
-            advanceDefeatAction = "advance";
-            advanceDefeatTarget = "invisibleman";
-        } else if (taskBoard.isCoffinLocation(currentHero->getCurrentLocation()->getName())) {
-            // Coffin destruction for Dracula
-            showAdvanceItemSelection = true;
-            advanceDefeatAction = "advance";
-            advanceDefeatTarget = "coffin";
-        } else {
-            addGameMessage("Cannot use advance action here.", 3.0f);
-        }
+        advanceDefeatOptions = currentHero->getAdvanceOptions(engine.getDracula(), engine.getInvisibleMan(), taskBoard);
+        showAdvanceItemSelection = true;
+        advanceDefeatAction = "advance";
+        // Evidence delivery at the Precinct, otherwise a coffin
+        advanceDefeatTarget = currentHero->getCurrentLocation()->getName() == "Precinct" ? "invisibleman" : "coffin";
     } catch (const std::exception& e) {
-        addGameMessage(std::string("Error during advance: ") + e.what());
+        addGameMessage(e.what(), 3.0f);
     }
 }
 
@@ -1936,27 +1898,12 @@ void GameScreen::defeatMonster(const std::string& location) {
     if (!currentHero || remainingActions <= 0) return;
     
     try {
-        // Check if we're at Invisible Man or Dracula location
-        bool atInvisibleMan = false;
-        for (const auto& c : currentHero->getCurrentLocation()->getCharacters()) {
-            if (c == "Invisible man") atInvisibleMan = true;
-        }
-        
-        if (atInvisibleMan) {
-            // Defeat Invisible Man
-            showDefeatItemSelection = true;
-            advanceDefeatAction = "defeat";
-            advanceDefeatTarget = "invisibleman";
-        } else if (currentHero->getCurrentLocation() == dracula->getCurrentLocation()) {
-            // Defeat Dracula
-            showDefeatItemSelection = true;
-            advanceDefeatAction = "defeat";
-            advanceDefeatTarget = "dracula";
-        } else {
-            addGameMessage("No monster to defeat at this location.", 3.0f);
-        }
+        advanceDefeatOptions = currentHero->getDefeatOptions(engine.getDracula(), taskBoard);
+        showDefeatItemSelection = true;
+        advanceDefeatAction = "defeat";
+        advanceDefeatTarget = currentHero->getCurrentLocation()->hasCharacter("Invisible man") ? "invisibleman" : "dracula";
     } catch (const std::exception& e) {
-        addGameMessage(std::string("Error during defeat: ") + e.what());
+        addGameMessage(e.what(), 3.0f);
     }
 }
 
@@ -1968,35 +1915,23 @@ void GameScreen::specialAction() {
         return;
     }
 
-    std::string heroName = currentHero->getHeroName();
-
-    if (heroName == "Mayor" || heroName == "Scientist") {
+    switch (currentHero->getKind()) {
+    case HeroKind::Mayor:
+    case HeroKind::Scientist:
         // --- MAYOR & SCIENTIST: Show message, no action cost ---
-        addGameMessage(heroName + " has no special action.", 3.0f);
+        addGameMessage(currentHero->getHeroName() + " has no special action.", 3.0f);
         // This does NOT consume an action.
+        break;
 
-    } else if (heroName == "Courier") {
-        // --- COURIER: Perform special action, costs 1 action ---
-        try {
-            // Ensure the other hero is set before the action is called
-            currentHero->setOtherHero(otherHero);
-            currentHero->specialAction(); // This will throw if it fails
-
-            remainingActions--;
+    case HeroKind::Courier:
+        // --- COURIER: Moves to the other hero, costs 1 action ---
+        submitHeroAction(GameAction::specialAction());
+        break;
 
-            // The action cost is handled inside Courier::specialAction()
-            if (remainingActions <= 0) {
-                showEndTurnPrompt = true;
-                endTurnPromptTimer = 3.0f;
-            }
-            initializeLocations(); // Update map display
-        } catch (const std::exception& e) {
-            addGameMessage(e.what(), 3.0f);
-        }
-
-    } else if (heroName == "Archeologist") {
+    case HeroKind::Archeologist:
         // --- ARCHEOLOGIST: Start the UI flow, costs 1 action if items are taken ---
         startArcheologistSpecialAction();
+        break;
     }
 }
 
@@ -2026,11 +1961,8 @@ void GameScreen::endTurn() {
     selectedAction.clear();
     selectedLocation.clear();
     
-    // Execute monster phase first to get real results
+    // Starts the monster phase on its own thread; finishMonsterTurn() shows the results
     executeMonsterTurn();
-    
-    // Now display the results
-    showMonsterPhaseResults();
 }
 
 // Starts the process for the Archeologist's special action.
@@ -2052,23 +1984,21 @@ void GameScreen::startArcheologistSpecialAction() {
 
     // If locations with items are found, show the selection screen.
     showArcheologistLocationChoice = true;
-    archeologistPickedUpItem = false; // Reset for the new action.
+    archeologistPickedItems.clear(); // Reset for the new action.
 }
 
 // Ends and cleans up the Archeologist's special action state.
 void GameScreen::endArcheologistSpecialAction() {
-    if (archeologistPickedUpItem) {
-        remainingActions--;
-        if (remainingActions <= 0) {
-            showEndTurnPrompt = true;
-            endTurnPromptTimer = 3.0f;
-        }
+    if (!archeologistPickedItems.empty()) {
+        submitHeroAction(GameAction::specialAction(archeologistChosenLocation, std::move(archeologistPickedItems)));
+        archeologistPickedItems.clear();
     }
     showArcheologistLocationChoice = false;
     showArcheologistItemChoice = false;
     archeologistTargetLocations.clear();
     archeologistLocationButtons.clear();
     archeologistItemButtons.clear();
+    archeologistAvailableItems.clear();
     archeologistChosenLocation = nullptr;
 }
 
@@ -2085,8 +2015,8 @@ void GameScreen::drawArcheologistLocationChoiceOverlay() {
     DrawRectangleLinesEx({boxX, boxY, boxWidth, boxHeight}, 3, WHITE);
 
     std::string title = "Choose a location to search:";
-    Vector2 titleSize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
 
     archeologistLocationButtons.clear();
     float buttonHeight = 50;
@@ -2102,8 +2032,8 @@ void GameScreen::drawArcheologistLocationChoiceOverlay() {
         DrawRectangleLinesEx(btnRect, 2, WHITE);
 
         const std::string& locName = archeologistTargetLocations[i]->getName();
-        Vector2 textSize = MeasureTextEx(gameFont, locName.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, locName.c_str(), {btnRect.x + (btnRect.width - textSize.x) / 2, btnRect.y + (btnRect.height - textSize.y) / 2}, gameFont.baseSize, 1, WHITE);
+        Vector2 textSize = measureText(gameFont, locName.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, locName.c_str(), {btnRect.x + (btnRect.width - textSize.x) / 2, btnRect.y + (btnRect.height - textSize.y) / 2}, gameFont.baseSize, 1, WHITE);
     }
 }
 
@@ -2119,11 +2049,11 @@ void GameScreen::drawArcheologistItemChoiceOverlay() {
     DrawRectangleLinesEx({boxX, boxY, boxWidth, boxHeight}, 3, WHITE);
 
     std::string title = "Items at " + archeologistChosenLocation->getName();
-    Vector2 titleSize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
 
     archeologistItemButtons.clear();
-    const auto& items = archeologistChosenLocation->getItems();
+    const auto& items = archeologistAvailableItems;
     float itemHeight = 40;
     float spacing = 10;
     float startY = boxY + 80;
@@ -2137,7 +2067,7 @@ void GameScreen::drawArcheologistItemChoiceOverlay() {
         DrawRectangleLinesEx(itemRect, 2, WHITE);
 
         std::string itemText = items[i].getItemName() + " (Power: " + std::to_string(items[i].getPower()) + ")";
-        DrawTextEx(gameFont, itemText.c_str(), {itemRect.x + 20, itemRect.y + 10}, gameFont.baseSize, 1, WHITE);
+        drawText(gameFont, itemText.c_str(), {itemRect.x + 20, itemRect.y + 10}, gameFont.baseSize, 1, WHITE);
     }
 
     // "Done" button
@@ -2146,7 +2076,7 @@ void GameScreen::drawArcheologistItemChoiceOverlay() {
     bool isHovered = CheckCollisionPointRec(GetMousePosition(), archeologistDoneButton);
     DrawRectangleRec(archeologistDoneButton, isHovered ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(archeologistDoneButton, 2, WHITE);
-    DrawTextEx(gameFont, "Done", {archeologistDoneButton.x + 35, archeologistDoneButton.y + 15}, gameFont.baseSize, 1, WHITE);
+    drawText(gameFont, "Done", {archeologistDoneButton.x + 35, archeologistDoneButton.y + 15}, gameFont.baseSize, 1, WHITE);
 }
 
 // Handles clicks for the location choice overlay.
@@ -2154,6 +2084,7 @@ void GameScreen::handleArcheologistLocationChoiceClick(Vector2 mousePos) {
     for (size_t i = 0; i < archeologistLocationButtons.size(); ++i) {
         if (CheckCollisionPointRec(mousePos, archeologistLocationButtons[i])) {
             archeologistChosenLocation = archeologistTargetLocations[i];
+            archeologistAvailableItems = archeologistChosenLocation->getItems();
             showArcheologistLocationChoice = false;
             showArcheologistItemChoice = true;
             return;
@@ -2163,13 +2094,11 @@ void GameScreen::handleArcheologistLocationChoiceClick(Vector2 mousePos) {
 
 // Handles clicks for the item choice overlay.
 void GameScreen::handleArcheologistItemChoiceClick(Vector2 mousePos) {
-    auto itemsCopy = archeologistChosenLocation->getItems();
-    for (size_t i = 0; i < itemsCopy.size(); ++i) {
+    for (size_t i = 0; i < archeologistAvailableItems.size() && i < archeologistItemButtons.size(); ++i) {
         if (CheckCollisionPointRec(mousePos, archeologistItemButtons[i])) {
-            Item selectedItem = itemsCopy[i];
-            currentHero->addItem(selectedItem);
-            archeologistChosenLocation->removeItem(selectedItem);
-            archeologistPickedUpItem = true; // Mark that an item was taken
+            // Taken when Done is pressed, all in one action
+            archeologistPickedItems.push_back(archeologistAvailableItems[i]);
+            archeologistAvailableItems.erase(archeologistAvailableItems.begin() + i);
             return;
         }
     }
@@ -2185,87 +2114,210 @@ void GameScreen::startMonsterPhase() {
 }
 
 void GameScreen::advanceMonsterPhase() {
+    if (isMonsterTurnRunning() || engine.getPendingDecision()) return;
+    if (!pendingMonsterEvents.empty()) {
+        // First SPACE skips the rest of the presentation, the next one advances
+        while (!pendingMonsterEvents.empty()) {
+            presentMonsterEvent(pendingMonsterEvents.front());
+            pendingMonsterEvents.pop_front();
+        }
+        return;
+    }
     std::cout << "Advancing monster phase..." << std::endl;
+    lastMonsterEventText.clear();
+    monsterEventLocation.clear();
     
     // Monster phase is already executed, just switch back to hero phase
     currentPhase = HERO_PHASE;
     showMonsterPhaseUI = false;
-    currentTurn++;
-    remainingActions = maxActions;
-    
-    // Switch heroes for next turn
-    Hero* temp = currentHero;
-    currentHero = otherHero;
-    otherHero = temp;
+
+    // The engine hands play to the other hero
+    if (engine.getPhase() == TurnPhase::Monster) {
+        engine.submitAction(GameAction(GameActionType::NextTurn));
+    }
+    currentHero = engine.getCurrentHero();
+    otherHero = engine.getOtherHero();
+    currentTurn = engine.getTurn();
+    refreshActionCount();
     
     std::cout << "Monster phase complete. Starting turn " << currentTurn << std::endl;
 }
 
 void GameScreen::executeMonsterTurn() {
+    AllocPhaseScope allocScope(AllocPhase::MonsterPhase);
+    markBoardDirty();
     std::cout << "Executing monster turn..." << std::endl;
     
-    // Skip monster phase if hero has Break of Dawn perk
-    if (currentHero->shouldSkipNextMonsterPhase()) {
-        addGameMessage("Monster phase skipped due to Break of Dawn perk card!");
-        currentHero->setSkipNextMonsterPhase(false);
-        return;
-    }
-    
-    // Store initial state for comparison
-    int initialTerrorLevel = terrorTracker.getLevel();
-    std::string initialFrenziedMonster = currentFrenziedMonster;
-    
-    // Capture pre-monster phase state
-    capturePreMonsterPhaseState();
-    
-    // Execute monster phase using MonsterManager
-    try {
-        std::vector<std::string> diceResults;
-        
-        monsterManager.MonsterPhase(*gameMap, *itemBag, 
-                                  static_cast<Dracula*>(dracula.get()), 
-                                  static_cast<InvisibleMan*>(invisibleMan.get()), 
-                                  *frenzyMarker, currentHero, terrorTracker,
-                                  static_cast<Archeologist*>(dynamic_cast<Archeologist*>(currentHero)),
-                                  static_cast<Mayor*>(dynamic_cast<Mayor*>(currentHero)),
-                                  static_cast<Courier*>(dynamic_cast<Courier*>(currentHero)),
-                                  static_cast<Scientist*>(dynamic_cast<Scientist*>(currentHero)),
-                                  villagerManager, diceResults, &perkDeck, currentHero, otherHero
-                            #ifndef TERMINAL
-                                , this
-                            #endif
-    );
-        
-        // Store dice results for display
-        this->diceResults = diceResults;
-        
-        // Update current frenzied monster after monster phase
-        std::string newFrenziedMonster = "";
-        if (frenzyMarker && frenzyMarker->getCurrentFrenzied()) {
-            newFrenziedMonster = frenzyMarker->getCurrentFrenzied()->getMonsterName();
+    lastMonsterEventText.clear();
+    monsterEventLocation.clear();
+    monsterEventTimer = 0.0f;
+    // Break of Dawn is handled by the engine, which then publishes MonsterPhaseSkipped
+    startMonsterWorker(GameAction(GameActionType::EndTurn));
+}
+
+void GameScreen::startMonsterWorker(const GameAction& action) {
+    // Everything below runs on the engine thread and reports back through monsterEvents
+    engine.setEventSink(&monsterEvents);
+    monsterWorkerDone.store(false);
+    monsterWorkerError.clear();
+    monsterWorker = std::thread([this, action]() {
+        AllocPhaseScope allocScope(AllocPhase::MonsterPhase);
+        try {
+            engine.submitAction(action);
+        } catch (const std::exception& e) {
+            monsterWorkerError = e.what();
         }
-        
-        if (newFrenziedMonster != currentFrenziedMonster) {
-            currentFrenziedMonster = newFrenziedMonster;
-            if (!currentFrenziedMonster.empty()) {
-                loadFrenziedMonsterTexture();
-            }
+        monsterWorkerDone.store(true, std::memory_order_release);
+    });
+}
+
+void GameScreen::updateMonsterTurn() {
+    GameEvent event;
+    while (monsterEvents.tryPop(event)) {
+        pendingMonsterEvents.push_back(std::move(event));
+    }
+    if (isMonsterTurnRunning() && monsterWorkerDone.load(std::memory_order_acquire)) {
+        // Pick up anything published just before the thread finished
+        while (monsterEvents.tryPop(event)) {
+            pendingMonsterEvents.push_back(std::move(event));
         }
-        
-    } catch (const std::exception& e) {
-        std::cout << "Error during monster phase: " << e.what() << std::endl;
-        addGameMessage("Error during monster phase: " + std::string(e.what()));
+        finishMonsterTurn();
     }
-    
+
+    monsterEventTimer -= GetFrameTime();
+    while (!pendingMonsterEvents.empty() && monsterEventTimer <= 0.0f) {
+        presentMonsterEvent(pendingMonsterEvents.front());
+        pendingMonsterEvents.pop_front();
+        monsterEventTimer = MONSTER_EVENT_INTERVAL;
+    }
+}
+
+void GameScreen::finishMonsterTurn() {
+    monsterWorker.join();
+    markBoardDirty();
+
+    if (!monsterWorkerError.empty()) {
+        std::cout << "Error during monster phase: " << monsterWorkerError << std::endl;
+        addGameMessage("Error during monster phase: " + monsterWorkerError);
+    }
+
+    // The engine is waiting for the attacked hero to choose; answerDefense() resumes it
+    if (const Decision* decision = engine.getPendingDecision()) {
+        initializeLocations();
+        showDefenseDecision(*decision);
+        return;
+    }
+
+    // Store dice results for display
+    diceResults = engine.getDiceResults();
+
+    // Update current frenzied monster after monster phase
+    std::string newFrenziedMonster = "";
+    if (frenzyMarker && frenzyMarker->getCurrentFrenzied()) {
+        newFrenziedMonster = frenzyMarker->getCurrentFrenzied()->getMonsterName();
+    }
+    currentFrenziedMonster = newFrenziedMonster;
+
     initializeLocations();
+    showMonsterPhaseResults();
 
-    if (terrorTracker.getLevel() >= 5) {
+    if (engine.getOutcome() == GameOutcome::Terror) {
         setGameOver("DEFEAT!", "The terror level has reached its peak!");
-    } else if (monsterManager.isEmpty()) {
+    } else if (engine.getOutcome() == GameOutcome::DeckEmpty) {
         setGameOver("DEFEAT!", "Time has run out! The monster deck is empty.");
     }
 }
 
+bool GameScreen::submitHeroAction(const GameAction& action) {
+    if (!currentHero) return false;
+    size_t perkCount = currentHero->getPerkCards().size();
+    engine.setEventSink(&gameEvents);
+    try {
+        engine.submitAction(action);
+    } catch (const std::exception& e) {
+        addGameMessage(e.what(), 3.0f);
+        return false;
+    }
+
+    // A villager brought to their safe place hands the hero a perk card
+    const auto& heroPerks = currentHero->getPerkCards();
+    if (heroPerks.size() > perkCount) {
+        addGameMessage(currentHero->getPlayerName() + std::string(" (") + currentHero->getHeroName() + ") received perk card: " +
+                       PerkCard::perkTypeToString(heroPerks.back().getType()));
+    }
+
+    // A defeat may have taken a monster off the board and moved the frenzy marker on
+    currentFrenziedMonster = frenzyMarker && frenzyMarker->getCurrentFrenzied()
+                           ? frenzyMarker->getCurrentFrenzied()->getMonsterName() : "";
+    initializeLocations();
+    refreshActionCount();
+    if (engine.getOutcome() == GameOutcome::HeroesWin) {
+        setGameOver("VICTORY!", "Both Dracula and the Invisible Man have been defeated!");
+    } else if (remainingActions <= 0) {
+        showEndTurnPrompt = true;
+        endTurnPromptTimer = 3.0f;
+    }
+    return true;
+}
+
+void GameScreen::refreshActionCount() {
+    // The hero keeps the count; the panel shows a copy
+    if (!currentHero) return;
+    remainingActions = currentHero->getRemainingActions();
+    maxActions = currentHero->getMaxActions();
+}
+
+void GameScreen::waitForMonsterWorker() {
+    if (!isMonsterTurnRunning()) return;
+    // The worker blocks when the event queue is full, so keep draining it
+    GameEvent event;
+    while (!monsterWorkerDone.load(std::memory_order_acquire)) {
+        while (monsterEvents.tryPop(event)) {}
+        std::this_thread::yield();
+    }
+    monsterWorker.join();
+}
+
+void GameScreen::presentMonsterEvent(const GameEvent& event) {
+    lastMonsterEventText = event.describe();
+    if (!event.location.empty()) {
+        monsterEventLocation = event.location;
+    }
+
+    bool targetIsHero = (currentHero && event.target == currentHero->getHeroName())
+                     || (otherHero && event.target == otherHero->getHeroName());
+    switch (event.type) {
+        case GameEventType::MonsterAttack:
+            if (targetIsHero) addGameMessage(lastMonsterEventText);
+            break;
+        case GameEventType::MonsterPhaseSkipped:
+            addGameMessage("Monster phase skipped due to Break of Dawn perk card!");
+            break;
+        case GameEventType::HeroDefended:
+            addGameMessage(lastMonsterEventText);
+            break;
+        case GameEventType::HeroHospitalized:
+        case GameEventType::VillagerKilled:
+        case GameEventType::VillagerRescued:
+        case GameEventType::ItemsStolen:
+            addGameMessage(lastMonsterEventText);
+            break;
+        default:
+            break;
+    }
+}
+
+void GameScreen::handleGameEvent(const GameEvent& event) {
+    switch (event.type) {
+        case GameEventType::VillagerKilled:
+        case GameEventType::VillagerRescued:
+            addGameMessage(event.describe());
+            break;
+        default:
+            break;
+    }
+}
+
 void GameScreen::drawPerkSelectionOverlay() {
     DrawRectangle(0, 0, screenWidth, screenHeight, {0, 0, 0, 180});
 
@@ -2278,8 +2330,8 @@ void GameScreen::drawPerkSelectionOverlay() {
     DrawRectangleLinesEx({boxX, boxY, boxWidth, boxHeight}, 3, WHITE);
 
     std::string title = "Choose a Perk Card";
-    Vector2 titleSize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 18}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 18}, titleFont.baseSize, 1, WHITE);
 
     // Grid of cards
     const auto& perks = currentHero->getPerkCards();
@@ -2321,14 +2373,14 @@ void GameScreen::drawPerkSelectionOverlay() {
 
         // Name
         std::string name = PerkCard::perkTypeToString(perks[i].getType());
-        Vector2 nameSize = MeasureTextEx(gameFont, name.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, name.c_str(), {r.x + (r.width - nameSize.x) / 2.0f, r.y + r.height * 0.6f}, gameFont.baseSize, 1, WHITE);
+        Vector2 nameSize = measureText(gameFont, name.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, name.c_str(), {r.x + (r.width - nameSize.x) / 2.0f, r.y + r.height * 0.6f}, gameFont.baseSize, 1, WHITE);
 
         // Description
         std::string desc = perks[i].getDescription();
         // simple wrap: draw as 2 lines max
         float textY = r.y + r.height * 0.6f + nameSize.y + 6.0f;
-        DrawTextEx(gameFont, desc.c_str(), {r.x + 10.0f, textY}, gameFont.baseSize, 1, {230,230,230,255});
+        drawText(gameFont, desc.c_str(), {r.x + 10.0f, textY}, gameFont.baseSize, 1, {230,230,230,255});
     }
 
     // Cancel button
@@ -2338,8 +2390,8 @@ void GameScreen::drawPerkSelectionOverlay() {
     DrawRectangleRec(perkCancelButton, hovered ? dangerColor : buttonColor);
     DrawRectangleLinesEx(perkCancelButton, 2, WHITE);
     std::string cancel = "Cancel";
-    Vector2 csz = MeasureTextEx(gameFont, cancel.c_str(), gameFont.baseSize, 1);
-    DrawTextEx(gameFont, cancel.c_str(), {perkCancelButton.x + (perkCancelButton.width - csz.x) / 2.0f, perkCancelButton.y + (perkCancelButton.height - csz.y) / 2.0f}, gameFont.baseSize, 1, WHITE);
+    Vector2 csz = measureText(gameFont, cancel.c_str(), gameFont.baseSize, 1);
+    drawText(gameFont, cancel.c_str(), {perkCancelButton.x + (perkCancelButton.width - csz.x) / 2.0f, perkCancelButton.y + (perkCancelButton.height - csz.y) / 2.0f}, gameFont.baseSize, 1, WHITE);
 }
 
 void GameScreen::handlePerkSelectionClick(Vector2 mousePos) {
@@ -2352,26 +2404,18 @@ void GameScreen::handlePerkSelectionClick(Vector2 mousePos) {
     const auto& perks = currentHero->getPerkCards();
     for (size_t i = 0; i < perkSelectionButtons.size() && i < perks.size(); ++i) {
         if (CheckCollisionPointRec(mousePos, perkSelectionButtons[i])) {
-            // Special handling for Visit from the Detective
-            if (perks[i].getType() == PerkType::VisitFromTheDetective) {
+            // Visit from the Detective first asks where the Invisible man goes
+            InvisibleMan* invisibleManOnBoard = engine.getInvisibleMan();
+            if (perks[i].getType() == PerkType::VisitFromTheDetective &&
+                invisibleManOnBoard && invisibleManOnBoard->getCurrentLocation()) {
                 showPerkSelection = false;
                 showVisitFromDetectiveSelection = true;
                 return;
             }
 
-            try {
-                currentHero->usePerkCard(i, *gameMap, villagerManager, &perkDeck,
-                                         static_cast<InvisibleMan*>(invisibleMan.get()),
-                                         itemBag, otherHero,
-                                         static_cast<Dracula*>(dracula.get()));
-
-                remainingActions = currentHero->getRemainingActions();
-                maxActions = currentHero->getMaxActions();
-
-                addGameMessage("Used perk card: " + PerkCard::perkTypeToString(perks[i].getType()));
-                initializeLocations();
-            } catch (const std::exception& e) {
-                addGameMessage(std::string("Error using perk card: ") + e.what());
+            std::string perkName = PerkCard::perkTypeToString(perks[i].getType());
+            if (submitHeroAction(GameAction::usePerk(i))) {
+                addGameMessage("Used perk card: " + perkName);
             }
             showPerkSelection = false;
             break;
@@ -2387,9 +2431,6 @@ void GameScreen::showMonsterPhaseResults() {
         // Show important game messages based on what happened
         addImportantGameMessages(terrorTracker.getLevel(), currentFrenziedMonster);
         
-        // Compare state changes and add additional messages
-        compareAndAddStateChangeMessages();
-        
     } catch (const std::exception& e) {
         std::cout << "Error showing monster phase results: " << e.what() << std::endl;
         addGameMessage("Error: Could not show monster phase results");
@@ -2468,11 +2509,15 @@ void GameScreen::restoreFromGameState(const GameState& gameState) {
         }
 
         // Restore villagers
-        villagerManager = VillagerManager();
+        villagerManager = VillagerManager(gameArena.resource());
+        villagerManager.setEventSink(&gameEvents);
         for (const auto& vs : gameState.getVillagerStates()) {
             if (!vs.currentLocationName.empty() && vs.currentLocationName != "Defeated") {
                 auto l = gameMap->getLocation(vs.currentLocationName);
-                if (l) villagerManager.addVillager(vs.villagerName, l);
+                if (l) {
+                    l->tryAddCharacter(vs.villagerName);
+                    villagerManager.addVillager(vs.villagerName, l);
+                }
             }
         }
 
@@ -2502,6 +2547,8 @@ void GameScreen::restoreFromGameState(const GameState& gameState) {
 
         // Rebuild map characters for drawing
         initializeLocations();
+        engine.start(currentHero, otherHero, currentTurn);
+        refreshActionCount();
         addGameMessage("Game loaded.", 2.0f);
     } catch (const std::exception& e) {
         std::cout << "Error restoring from state: " << e.what() << std::endl;
@@ -2546,8 +2593,8 @@ void GameScreen::drawSaveSlotsOverlay() {
 
     // Title
     std::string title = "SAVE GAME";
-    Vector2 tsize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {overlayX + (overlayWidth - tsize.x)/2, overlayY + 12}, titleFont.baseSize, 1, titleColor);
+    Vector2 tsize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {overlayX + (overlayWidth - tsize.x)/2, overlayY + 12}, titleFont.baseSize, 1, titleColor);
 
     // Slots list
     auto slots = saveManager->getSaveSlots();
@@ -2562,9 +2609,9 @@ void GameScreen::drawSaveSlotsOverlay() {
         const SaveSlot& s = slots[i];
         std::string line1 = std::string("Slot ") + std::to_string(i+1) + (s.hasSave ? std::string(" - ") + s.saveName : " - EMPTY");
         std::string line2 = s.hasSave ? (s.saveDate + " | Turn " + std::to_string(s.turnCount) + ", Terror " + std::to_string(s.terrorLevel)) : "Click to save here";
-        Vector2 l1 = MeasureTextEx(gameFont, line1.c_str(), gameFont.baseSize * 1.1f, 1);
-        DrawTextEx(gameFont, line1.c_str(), {r.x + 12, r.y + 8}, gameFont.baseSize * 1.1f, 1, WHITE);
-        DrawTextEx(gameFont, line2.c_str(), {r.x + 12, r.y + 12 + gameFont.baseSize * 1.1f}, gameFont.baseSize * 0.9f, 1, GRAY);
+        Vector2 l1 = measureText(gameFont, line1.c_str(), gameFont.baseSize * 1.1f, 1);
+        drawText(gameFont, line1.c_str(), {r.x + 12, r.y + 8}, gameFont.baseSize * 1.1f, 1, WHITE);
+        drawText(gameFont, line2.c_str(), {r.x + 12, r.y + 12 + gameFont.baseSize * 1.1f}, gameFont.baseSize * 0.9f, 1, GRAY);
     }
 
     // Footer buttons
@@ -2572,11 +2619,11 @@ void GameScreen::drawSaveSlotsOverlay() {
     bool menuHover = CheckCollisionPointRec(GetMousePosition(), saveGoToMenuButton);
     DrawRectangleRec(saveBackToGameButton, backHover ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(saveBackToGameButton, 1, WHITE);
-    DrawTextEx(gameFont, "Back to Game", {saveBackToGameButton.x + 10, saveBackToGameButton.y + 10}, gameFont.baseSize, 1, WHITE);
+    drawText(gameFont, "Back to Game", {saveBackToGameButton.x + 10, saveBackToGameButton.y + 10}, gameFont.baseSize, 1, WHITE);
 
     DrawRectangleRec(saveGoToMenuButton, menuHover ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(saveGoToMenuButton, 1, WHITE);
-    DrawTextEx(gameFont, "Main Menu", {saveGoToMenuButton.x + 10, saveGoToMenuButton.y + 10}, gameFont.baseSize, 1, WHITE);
+    drawText(gameFont, "Main Menu", {saveGoToMenuButton.x + 10, saveGoToMenuButton.y + 10}, gameFont.baseSize, 1, WHITE);
 }
 
 void GameScreen::handleSaveSlotsClick(Vector2 mousePos) {
@@ -2638,6 +2685,7 @@ void GameScreen::handleSaveSlotsClick(Vector2 mousePos) {
 }
 
 GameState GameScreen::buildCurrentGameStateSnapshot() {
+    AllocPhaseScope allocScope(AllocPhase::Save);
     GameState gs;
     try {
         // Players
@@ -2718,59 +2766,6 @@ void GameScreen::updateItemTooltip(const std::string& locationName, const std::v
     itemTooltip.displayTime = 0.0f;
 }
 
-void GameScreen::startHeroDefense(Hero* hero,
-                                  std::function<void(int)> onItemSelected,
-                                  std::function<void()> onCanceled) {
-    if (!hero) return;
-
-    // Store the defending hero and callbacks
-    defendingHero = hero;
-    onItemSelectedIndex = onItemSelected;
-    onDefenseCanceled = onCanceled;
-
-    // Show the Yes/No choice first
-    isHeroDefenseChoiceActive = true;
-}
-
-void GameScreen::useItemForDefense(const Item& item) {
-    std::cout << "Warning: useItemForDefense(const Item&) is deprecated. Use useItemForDefenseByIndex(int) instead." << std::endl;
-}
-
-void GameScreen::useItemForDefenseByIndex(int itemIndex) {
-    try {
-        // Check if currentHero is valid
-        if (!currentHero) {
-            std::cout << "Error: No current hero to use item!" << std::endl;
-            addGameMessage("Error: No current hero to use item!");
-            return;
-        }
-        
-        // Check if item index is valid
-        const auto& heroItems = currentHero->getItems();
-        if (itemIndex < 0 || itemIndex >= static_cast<int>(heroItems.size())) {
-            std::cout << "Error: Invalid item index " << itemIndex << "!" << std::endl;
-            addGameMessage("Error: Invalid item index!");
-            return;
-        }
-        
-        // Get the item to use
-        const Item& itemToUse = heroItems[itemIndex];
-        // Scientist ability applies when using an item
-        if (currentHero->getHeroName() == std::string("Scientist")) {
-            currentHero->ability(static_cast<size_t>(itemIndex));
-        }
-        
-        // Remove the used item from hero's inventory
-        currentHero->removeItem(itemIndex);
-        
-        // Show success message
-        addGameMessage("Hero successfully defended using " + itemToUse.getItemName() + "!");
-    } catch (const std::exception& e) {
-        std::cout << "Error in useItemForDefenseByIndex: " << e.what() << std::endl;
-        addGameMessage("Error: Could not use item for defense");
-    }
-}
-
 void GameScreen::updateTerrorLevel(int level) {
     currentTerrorLevel = level;
     terrorTracker.setLevel(level);
@@ -2873,30 +2868,16 @@ void GameScreen::loadHeroImages() {
     };
     
     for (const auto& [charName, fileName] : heroMappings) {
-        std::string imagePath = getAssetPath("Horrified_Assets/Heros/" + fileName + ".png");
-        if (FileExists(imagePath.c_str())) {
-            heroImages[charName] = LoadTexture(imagePath.c_str());
-            std::cout << "Loaded hero image: " << imagePath << " for " << charName << std::endl;
-        } else {
-            std::cout << "Failed to load hero image: " << imagePath << " for " << charName << std::endl;
-        }
+        assetLoader->request("hero:" + charName, "Horrified_Assets/Heros/" + fileName + ".png");
     }
-    heroImagesLoaded = !heroImages.empty();
 }
 
 void GameScreen::loadMonsterImages() {
     std::vector<std::string> monsterNames = {"Dracula", "InvisibleMan"};
     
     for (const auto& monster : monsterNames) {
-        std::string imagePath = getAssetPath("Horrified_Assets/Monsters/" + monster + ".png");
-        if (FileExists(imagePath.c_str())) {
-            monsterImages[monster] = LoadTexture(imagePath.c_str());
-            std::cout << "Loaded monster image: " << imagePath << std::endl;
-        } else {
-            std::cout << "Failed to load monster image: " << imagePath << std::endl;
-        }
+        assetLoader->request("monster:" + monster, "Horrified_Assets/Monsters/" + monster + ".png");
     }
-    monsterImagesLoaded = !monsterImages.empty();
 }
 
 void GameScreen::loadVillagerImages() {
@@ -2912,15 +2893,8 @@ void GameScreen::loadVillagerImages() {
     };
     
     for (const auto& [codeName, fileName] : villagerMappings) {
-        std::string imagePath = getAssetPath("Horrified_Assets/Villager/" + fileName + ".png");
-        if (FileExists(imagePath.c_str())) {
-            villagerImages[codeName] = LoadTexture(imagePath.c_str());
-            std::cout << "Loaded villager image: " << imagePath << " for " << codeName << std::endl;
-        } else {
-            std::cout << "Failed to load villager image: " << imagePath << " for " << codeName << std::endl;
-        }
+        assetLoader->request("villager:" + codeName, "Horrified_Assets/Villager/" + fileName + ".png");
     }
-    villagerImagesLoaded = !villagerImages.empty();
 }
 
 void GameScreen::loadItemImages() {
@@ -2969,7 +2943,7 @@ void GameScreen::loadItemImages() {
     
     // Load all items with mapping
     for (const auto& [codeName, fileName] : itemMappings) {
-        std::string imagePath = getAssetPath("Horrified_Assets/Items/");
+        std::string imagePath = "Horrified_Assets/Items/";
         
         // Determine color folder based on item name
         std::string colorFolder;
@@ -2989,19 +2963,8 @@ void GameScreen::loadItemImages() {
         }
         
         imagePath += colorFolder + fileName + ".png";
-        
-        std::cout << "Attempting to load item image: " << imagePath << " for " << codeName << std::endl;
-        
-        if (FileExists(imagePath.c_str())) {
-            itemImages[codeName] = LoadTexture(imagePath.c_str());
-            std::cout << "Successfully loaded item image: " << imagePath << " for " << codeName << std::endl;
-        } else {
-            std::cout << "FAILED to load item image: " << imagePath << " for " << codeName << std::endl;
-        }
+        assetLoader->request("item:" + codeName, imagePath);
     }
-    
-    itemImagesLoaded = !itemImages.empty();
-    std::cout << "Total item images loaded: " << itemImages.size() << std::endl;
 }
 
 void GameScreen::loadPerkCardImages() {
@@ -3011,37 +2974,136 @@ void GameScreen::loadPerkCardImages() {
     };
 
     for (const auto& perk : perkCardNames) {
-        std::string imagePath = getAssetPath("Horrified_Assets/Perk_Cards/" + perk);
-        if (FileExists(imagePath.c_str())) {
-            perkCardImages[perk] = LoadTexture(imagePath.c_str());
-            std::cout << "Loaded perk card image: " << imagePath << std::endl;
-        } else {
-            std::cout << "Failed to load perk card image: " << imagePath << std::endl;
-        }
+        assetLoader->request("perk:" + perk, "Horrified_Assets/Perk_Cards/" + perk);
+    }
+}
+
+void GameScreen::loadMonsterCardImages() {
+    std::vector<std::string> cardNames = {
+        "Form Of The Bat", "Sunrise", "Thief", "The Delivery", "Fortune Teller", "Former Employer",
+        "Hurried Assistant", "The Innocent", "Egyptian Expert", "The Ichthyologist", "Hypnotic Gaze", "On The Move"
+    };
+
+    for (const auto& cardName : cardNames) {
+        assetLoader->request("card:" + cardName, "Horrified_Assets/Monster_Cards/" + convertMonsterCardNameToImage(cardName));
     }
-    perkCardImagesLoaded = !perkCardImages.empty();
 }
 
 void GameScreen::loadCoffinImages() {
-    // Load coffin texture
-    std::string coffinPath = getAssetPath("Horrified_Assets/Items/Coffins/Coffin.png");
-    if (FileExists(coffinPath.c_str())) {
-        coffinTexture = LoadTexture(coffinPath.c_str());
-        std::cout << "Loaded coffin image: " << coffinPath << std::endl;
-    } else {
-        std::cout << "Failed to load coffin image: " << coffinPath << std::endl;
+    assetLoader->request("coffin:Coffin", "Horrified_Assets/Items/Coffins/Coffin.png");
+    assetLoader->request("coffin:SmashedCoffin", "Horrified_Assets/Items/Coffins/SmashedCoffin.png");
+}
+
+const Sprite* GameScreen::findCharacterSprite(const std::string& charName) const {
+    // Hero
+    for (const auto& [heroName, sprite] : heroImages) {
+        if (charName.find(heroName) != std::string::npos) return &sprite;
+    }
+    // Monster, "Invisible man" is stored as "InvisibleMan"
+    const std::string searchName = (charName == "Invisible man") ? std::string("InvisibleMan") : charName;
+    for (const auto& [monsterName, sprite] : monsterImages) {
+        if (searchName.find(monsterName) != std::string::npos) return &sprite;
+    }
+    // Villager
+    for (const auto& [villagerName, sprite] : villagerImages) {
+        if (charName.find(villagerName) != std::string::npos) return &sprite;
+    }
+    return nullptr;
+}
+
+CharacterVisual GameScreen::resolveCharacterVisual(const std::string& charName) const {
+    CharacterVisual visual;
+    visual.sprite = findCharacterSprite(charName);
+    if (charName.find("Dracula") != std::string::npos) {
+        visual.fallbackColor = RED;
+    } else if (charName.find("Invisible") != std::string::npos) {
+        visual.fallbackColor = PURPLE;
+    } else if (charName.find("Mayor") != std::string::npos || 
+               charName.find("Archeologist") != std::string::npos ||
+               charName.find("Courier") != std::string::npos ||
+               charName.find("Scientist") != std::string::npos) {
+        visual.fallbackColor = GREEN;
+    }
+    return visual;
+}
+
+void GameScreen::buildSpriteAtlas() {
+    // Upload every queued sprite as one texture, then point the lookups at their regions
+    spriteAtlas.build();
+    for (auto* images : {&heroImages, &monsterImages, &villagerImages, &itemImages}) {
+        for (auto& [name, sprite] : *images) {
+            sprite = spriteAtlas.getSprite(name);
+        }
+    }
+    coffinTexture = spriteAtlas.getSprite("Coffin");
+    smashedCoffinTexture = spriteAtlas.getSprite("SmashedCoffin");
+
+    heroImagesLoaded = !heroImages.empty() && spriteAtlas.size() > 0;
+    monsterImagesLoaded = !monsterImages.empty() && spriteAtlas.size() > 0;
+    villagerImagesLoaded = !villagerImages.empty() && spriteAtlas.size() > 0;
+    itemImagesLoaded = !itemImages.empty() && spriteAtlas.size() > 0;
+    coffinImagesLoaded = coffinTexture.isValid() && smashedCoffinTexture.isValid();
+}
+
+void GameScreen::updateAssetLoading() {
+    // A few uploads per frame keeps the loading screen responsive
+    for (auto& loaded : assetLoader->takeDecoded(4)) {
+        std::string::size_type colon = loaded.key.find(':');
+        std::string group = loaded.key.substr(0, colon);
+        std::string name = colon == std::string::npos ? loaded.key : loaded.key.substr(colon + 1);
+
+        if (!loaded.ok) {
+            std::cout << "Failed to load " << group << " image: " << loaded.path << std::endl;
+            continue;
+        }
+
+        if (group == "map" || group == "perk" || group == "card") {
+            // Full-size textures upload directly, packed pixels included (no copy)
+            Texture2D texture = LoadTextureFromImage(loaded.image);
+            if (!loaded.borrowed) UnloadImage(loaded.image);
+            if (group == "map") {
+                mapTexture = texture;
+                mapLoaded = mapTexture.id != 0;
+            } else if (group == "perk") {
+                perkCardImages[name] = texture;
+                perkCardImagesLoaded = true;
+            } else {
+                monsterCardImages[name] = texture;
+            }
+        } else {
+            // The atlas takes ownership (and resizes), so packed pixels are copied first
+            spriteAtlas.addImage(name, loaded.borrowed ? ImageCopy(loaded.image) : loaded.image);
+            if (group == "hero") heroImages[name] = Sprite();
+            else if (group == "monster") monsterImages[name] = Sprite();
+            else if (group == "villager") villagerImages[name] = Sprite();
+            else if (group == "item") itemImages[name] = Sprite();
+        }
+        std::cout << "Loaded " << group << " image: " << loaded.path << std::endl;
     }
-    
-    // Load smashed coffin texture
-    std::string smashedCoffinPath = getAssetPath("Horrified_Assets/Items/Coffins/SmashedCoffin.png");
-    if (FileExists(smashedCoffinPath.c_str())) {
-        smashedCoffinTexture = LoadTexture(smashedCoffinPath.c_str());
-        std::cout << "Loaded smashed coffin image: " << smashedCoffinPath << std::endl;
-    } else {
-        std::cout << "Failed to load smashed coffin image: " << smashedCoffinPath << std::endl;
+
+    if (assetLoader->isDone()) {
+        buildSpriteAtlas();
+        assetLoader.reset();
+        assetsReady = true;
+        // Character visuals were resolved before the atlas existed
+        initializeLocations();
     }
-    
-    coffinImagesLoaded = (coffinTexture.id != 0 && smashedCoffinTexture.id != 0);
+}
+
+void GameScreen::drawLoadingScreen() {
+    float progress = 1.0f;
+    if (assetLoader && assetLoader->getRequestedCount() > 0) {
+        progress = (float)assetLoader->getTakenCount() / assetLoader->getRequestedCount();
+    }
+
+    const char* title = "Loading...";
+    Vector2 titleSize = measureText(titleFont, title, titleFont.baseSize, 1);
+    drawText(titleFont, title, {(screenWidth - titleSize.x) / 2, screenHeight * 0.42f}, titleFont.baseSize, 1, RAYWHITE);
+
+    Rectangle bar = {screenWidth * 0.3f, screenHeight * 0.5f, screenWidth * 0.4f, screenHeight * 0.03f};
+    DrawRectangleRec(bar, DARKGRAY);
+    DrawRectangleRec({bar.x, bar.y, bar.width * progress, bar.height}, MAROON);
+    DrawRectangleLinesEx(bar, 2, LIGHTGRAY);
 }
 
 bool GameScreen::isCoffinLocation(const std::string& location) const {
@@ -3049,27 +3111,14 @@ bool GameScreen::isCoffinLocation(const std::string& location) const {
 }
 
 void GameScreen::unloadImages() {
-    for (auto& [name, texture] : heroImages) {
-        if (texture.id != 0) {
-            UnloadTexture(texture);
-        }
-    }
+    // Hero, monster, villager, item and coffin sprites share the atlas texture
+    spriteAtlas.unload();
     heroImages.clear();
-    
-    for (auto& [name, texture] : monsterImages) {
-        if (texture.id != 0) {
-            UnloadTexture(texture);
-        }
-    }
     monsterImages.clear();
-    
-    // Unload coffin textures
-    if (coffinTexture.id != 0) {
-        UnloadTexture(coffinTexture);
-    }
-    if (smashedCoffinTexture.id != 0) {
-        UnloadTexture(smashedCoffinTexture);
-    }
+    villagerImages.clear();
+    itemImages.clear();
+    coffinTexture = Sprite();
+    smashedCoffinTexture = Sprite();
     
     for (auto& [name, texture] : perkCardImages) {
         if (texture.id != 0) {
@@ -3077,39 +3126,48 @@ void GameScreen::unloadImages() {
         }
     }
     perkCardImages.clear();
-    
-    // Unload villager images
-    for (auto& [name, texture] : villagerImages) {
-        if (texture.id != 0) {
-            UnloadTexture(texture);
-        }
-    }
-    villagerImages.clear();
-    
-    // Unload item images
-    for (auto& [name, texture] : itemImages) {
+
+    for (auto& [name, texture] : monsterCardImages) {
         if (texture.id != 0) {
             UnloadTexture(texture);
         }
     }
-    itemImages.clear();
+    monsterCardImages.clear();
+}
+
+Vector2 GameScreen::measureText(const Font& font, std::string_view text, float fontSize, float spacing) {
+    return textLayoutCache.measure(font, text, fontSize, spacing);
+}
+
+void GameScreen::drawText(const Font& font, std::string_view text, Vector2 position, float fontSize, float spacing, Color tint) {
+    textLayoutCache.draw(font, text, position, fontSize, spacing, tint);
 }
 
 std::string GameScreen::getAssetPath(const std::string& relativePath) {
-    // Try different possible paths
-    std::vector<std::string> possiblePaths = {
-        relativePath,                    // Current directory
-        "../" + relativePath,           // Parent directory
-        "../../" + relativePath,        // Grandparent directory
-        "./" + relativePath             // Explicit current directory
-    };
-    
-    for (const auto& path : possiblePaths) {
-        if (FileExists(path.c_str())) {
-            return path;
-        }
+    return AssetLoader::resolvePath(relativePath);
+}
+
+Font GameScreen::loadFont(const std::string& relativePath, int fontSize) {
+    // Packed fonts are rasterized straight from the mapped bytes
+    size_t fileSize = 0;
+    const unsigned char* fileData = assetArchive ? assetArchive->findFile(relativePath, fileSize) : nullptr;
+    if (fileData != nullptr) {
+        std::string extension = relativePath.substr(relativePath.rfind('.'));
+        return LoadFontFromMemory(extension.c_str(), fileData, (int)fileSize, fontSize, 0, 0);
+    }
+    return LoadFontEx(getAssetPath(relativePath).c_str(), fontSize, 0, 0);
+}
+
+Texture2D GameScreen::loadTexture(const std::string& relativePath) {
+    Image packed{};
+    if (assetArchive && assetArchive->findImage(relativePath, packed)) {
+        return LoadTextureFromImage(packed);
+    }
+    std::string path = getAssetPath(relativePath);
+    if (!FileExists(path.c_str())) {
+        return Texture2D{};
     }
-    return relativePath; // Return original if none found
+    return LoadTexture(path.c_str());
 }
 
 std::string GameScreen::getPerkCardImageName(PerkType type) {
@@ -3131,7 +3189,7 @@ void GameScreen::drawHeroInventoryOverlay() {
 
     // --- 1. Define a unified structure for display entries ---
     struct DisplayEntry {
-        Texture2D* texture;
+        Sprite sprite;
         std::string line1; // Perk Name or Item Name
         std::string line2; // Perk Description or Item Color
         std::string line3; // Empty for Perks, Item Power for Items
@@ -3142,22 +3200,22 @@ void GameScreen::drawHeroInventoryOverlay() {
     // --- 2. Populate the entries vector with perks and items ---
     // Add Perks
     for (const auto& perk : hoveredHero->getPerkCards()) {
-        Texture2D* tex = nullptr;
+        Sprite sprite;
         auto it = perkCardImages.find(getPerkCardImageName(perk.getType()));
         if (it != perkCardImages.end()) {
-            tex = &it->second;
+            sprite = Sprite::fromTexture(it->second);
         }
-        entries.push_back({tex, PerkCard::perkTypeToString(perk.getType()), perk.getDescription(), ""});
+        entries.push_back({sprite, PerkCard::perkTypeToString(perk.getType()), perk.getDescription(), ""});
     }
 
     // Add Items
     for (const auto& item : hoveredHero->getItems()) {
-        Texture2D* tex = nullptr;
+        Sprite sprite;
         auto it = itemImages.find(item.getItemName());
         if (it != itemImages.end()) {
-            tex = &it->second;
+            sprite = it->second;
         }
-        entries.push_back({tex, item.getItemName(), "Color: " + itemColorToString(item.getColor()), "Power: " + std::to_string(item.getPower())});
+        entries.push_back({sprite, item.getItemName(), "Color: " + itemColorToString(item.getColor()), "Power: " + std::to_string(item.getPower())});
     }
 
     // --- 3. Draw the overlay background and main container ---
@@ -3174,8 +3232,8 @@ void GameScreen::drawHeroInventoryOverlay() {
 
     // Draw Title
     std::string title = hoveredHero->getHeroName() + "'s Inventory";
-    float titleX = boxX + (boxWidth - MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 2).x) / 2;
-    DrawTextEx(titleFont, title.c_str(), {titleX, boxY + 20}, titleFont.baseSize, 2, titleColor);
+    float titleX = boxX + (boxWidth - measureText(titleFont, title.c_str(), titleFont.baseSize, 2).x) / 2;
+    drawText(titleFont, title.c_str(), {titleX, boxY + 20}, titleFont.baseSize, 2, titleColor);
 
     // --- 4. Two-column layout with scroll if content exceeds available space ---
     float padding = 20.0f;
@@ -3208,9 +3266,9 @@ void GameScreen::drawHeroInventoryOverlay() {
         float imageSize = entryHeight * 0.8f;
         float imageX = currentX + padding * 0.5f;
         float imageY = currentY + (entryHeight - imageSize) / 2; // Vertically center image
-        if (entry.texture) {
-            DrawTexturePro(*entry.texture, 
-                         {0, 0, (float)entry.texture->width, (float)entry.texture->height},
+        if (entry.sprite.isValid()) {
+            DrawTexturePro(entry.sprite.texture, 
+                         entry.sprite.source,
                          {imageX, imageY, imageSize, imageSize}, 
                          {0, 0}, 0.0f, WHITE);
         }
@@ -3219,19 +3277,19 @@ void GameScreen::drawHeroInventoryOverlay() {
         float textX = imageX + imageSize + padding * 0.6f;
         float textY = currentY + padding * 0.5f;
         
-        DrawTextEx(gameFont, entry.line1.c_str(), {textX, textY}, gameFont.baseSize * 1.1f, 1, titleColor);
+        drawText(gameFont, entry.line1.c_str(), {textX, textY}, gameFont.baseSize * 1.1f, 1, titleColor);
         textY += gameFont.baseSize * 1.2f;
-        DrawTextEx(gameFont, entry.line2.c_str(), {textX, textY}, gameFont.baseSize * 0.9f, 1, textColor);
+        drawText(gameFont, entry.line2.c_str(), {textX, textY}, gameFont.baseSize * 0.9f, 1, textColor);
         textY += gameFont.baseSize * 1.0f;
         if (!entry.line3.empty()) {
-            DrawTextEx(gameFont, entry.line3.c_str(), {textX, textY}, gameFont.baseSize * 0.9f, 1, textColor);
+            drawText(gameFont, entry.line3.c_str(), {textX, textY}, gameFont.baseSize * 0.9f, 1, textColor);
         }
     }
     EndScissorMode();
      // Add a close instruction
     const char* closeText = "Move mouse away to close";
-    float closeTextWidth = MeasureTextEx(gameFont, closeText, gameFont.baseSize * 0.9f, 1).x;
-    DrawTextEx(gameFont, closeText, {boxX + (boxWidth - closeTextWidth) / 2, boxY + boxHeight - 25}, gameFont.baseSize * 0.9f, 1, GRAY);
+    float closeTextWidth = measureText(gameFont, closeText, gameFont.baseSize * 0.9f, 1).x;
+    drawText(gameFont, closeText, {boxX + (boxWidth - closeTextWidth) / 2, boxY + boxHeight - 25}, gameFont.baseSize * 0.9f, 1, GRAY);
 }
 
 void GameScreen::drawLocationDetailPopup() {
@@ -3251,8 +3309,8 @@ void GameScreen::drawLocationDetailPopup() {
 
     // Title
     std::string title = std::string("Location: ") + locationPopupLocationName;
-    float titleX = boxX + (boxWidth - MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 2).x) / 2;
-    DrawTextEx(titleFont, title.c_str(), {titleX, boxY + 20}, titleFont.baseSize, 2, titleColor);
+    float titleX = boxX + (boxWidth - measureText(titleFont, title.c_str(), titleFont.baseSize, 2).x) / 2;
+    drawText(titleFont, title.c_str(), {titleX, boxY + 20}, titleFont.baseSize, 2, titleColor);
 
     // Content layout
     float padding = screenWidth * 0.012f;
@@ -3266,67 +3324,32 @@ void GameScreen::drawLocationDetailPopup() {
     float imageSize = entryHeight * 0.8f;
 
     // Build entries
-    struct Entry { enum Kind { Character, Item, Coffin } kind; std::string name; const Texture2D* texture; std::string sub1; std::string sub2; };
+    struct Entry { enum Kind { Character, Item, Coffin } kind; std::string name; const Sprite* sprite; std::string sub1; std::string sub2; };
     std::vector<Entry> entries;
 
     // Characters
     auto itLoc = mapLocations.find(locationPopupLocationName);
     if (itLoc != mapLocations.end()) {
         for (const auto& charName : itLoc->second.characters) {
-            const Texture2D* tex = nullptr;
-            // Hero
-            for (const auto& kv : heroImages) {
-                if (charName.find(kv.first) != std::string::npos) { tex = &kv.second; break; }
-            }
-            // Monster
-            if (!tex) {
-                for (const auto& kv : monsterImages) {
-                    std::string searchName = (charName == "Invisible man") ? std::string("InvisibleMan") : charName;
-                    if (searchName.find(kv.first) != std::string::npos) { tex = &kv.second; break; }
-                }
-            }
-            // Villager
-            if (!tex) {
-                for (const auto& kv : villagerImages) {
-                    if (charName.find(kv.first) != std::string::npos) { tex = &kv.second; break; }
-                }
-            }
+            const Sprite* tex = findCharacterSprite(charName);
             
             // Add safe place information for villagers
             std::string sub1, sub2;
             if (charName != "Archeologist" && charName != "Mayor" && charName != "Scientist" && charName != "Courier" && 
                 charName != "Dracula" && charName != "Invisible man") {
-                try {
-                    auto villager = villagerManager.getVillager(charName);
-                    std::string villagerName = villager->getVillagerName();
-                    std::string safePlace;
-                    if (villagerName == "Dr.Cranley") {
-                        safePlace = "Precinct";
-                    } else if (villagerName == "Dr.Reed") {
-                        safePlace = "Camp";
-                    } else if (villagerName == "Prof.Pearson") {
-                        safePlace = "Museum";
-                    } else if (villagerName == "Maleva") {
-                        safePlace = "Shop";
-                    } else if (villagerName == "Fritz") {
-                        safePlace = "Institute";
-                    } else if (villagerName == "Wilbur And Chick") {
-                        safePlace = "Dungeon";
-                    } else if (villagerName == "Maria") {
-                        safePlace = "Camp";
-                    }
-                    sub1 = "Safe Place: " + safePlace;
-                } catch (const std::exception& e) {
-                    // Villager not found, leave sub1 empty
+                // Unknown villagers leave sub1 empty
+                size_t villagerId;
+                if (VillagerManager::findVillagerId(charName, villagerId) && villagerManager.findVillager(charName)) {
+                    sub1 = "Safe Place: " + VillagerManager::getSafePlace(villagerId);
                 }
             } else if (charName == "Dracula") {
                 // Show Dracula current damage progress
                 int dmg = taskBoard.getDraculaDefeatStrength();
-                sub1 = std::string("Damage: ") + std::to_string(dmg) + "/6";
+                sub1 = std::string("Damage: ") + std::to_string(dmg) + "/" + std::to_string(Rules::DRACULA_DEFEAT_STRENGTH);
             } else if (charName == "Invisible man") {
                 // Show Invisible Man current damage progress
                 int dmg = taskBoard.getInvisibleManDefeatStrength();
-                sub1 = std::string("Damage: ") + std::to_string(dmg) + "/9";
+                sub1 = std::string("Damage: ") + std::to_string(dmg) + "/" + std::to_string(Rules::INVISIBLE_MAN_DEFEAT_STRENGTH);
             }
             
             entries.push_back({Entry::Character, charName, tex, sub1, sub2});
@@ -3338,7 +3361,7 @@ void GameScreen::drawLocationDetailPopup() {
     if (locItForItems != gameMap->locations.end()) {
         const auto& itemsAtLoc = locItForItems->second->getItems();
         for (const auto& item : itemsAtLoc) {
-            const Texture2D* tex = nullptr;
+            const Sprite* tex = nullptr;
             auto itImg = itemImages.find(item.getItemName());
             if (itImg != itemImages.end()) tex = &itImg->second;
             std::string sub1 = std::string("Item Color: ") + itemColorToString(item.getColor());
@@ -3349,13 +3372,11 @@ void GameScreen::drawLocationDetailPopup() {
 
     // Coffin (Dracula)
     if (isCoffinLocation(locationPopupLocationName)) {
-        bool destroyed = taskBoard.isCoffinDestroyed(locationPopupLocationName);
-        const auto& coffins = taskBoard.getDraculaCoffins();
-        int current = 0;
-        auto itC = coffins.find(locationPopupLocationName);
-        if (itC != coffins.end()) current = itC->second.currentStrength;
-        const Texture2D* tex = destroyed ? &smashedCoffinTexture : &coffinTexture;
-        std::string sub1 = std::string("Damage: ") + std::to_string(current) + "/6";
+        size_t coffinId = TaskBoard::getCoffinId(locationPopupLocationName);
+        bool destroyed = taskBoard.isCoffinDestroyed(coffinId);
+        int current = taskBoard.getCoffinStrength(coffinId);
+        const Sprite* tex = destroyed ? &smashedCoffinTexture : &coffinTexture;
+        std::string sub1 = std::string("Damage: ") + std::to_string(current) + "/" + std::to_string(Rules::COFFIN_STRENGTH);
         entries.push_back({Entry::Coffin, destroyed ? std::string("Coffin (Destroyed)") : std::string("Coffin"), tex, sub1, std::string()});
     }
 
@@ -3376,9 +3397,9 @@ void GameScreen::drawLocationDetailPopup() {
         // Image
         float imgX = currentX + 12.0f;
         float imgY = currentY + (entryHeight - imageSize) / 2.0f;
-        if (entries[i].texture) {
-            DrawTexturePro(*entries[i].texture,
-                           {0, 0, (float)entries[i].texture->width, (float)entries[i].texture->height},
+        if (entries[i].sprite && entries[i].sprite->isValid()) {
+            DrawTexturePro(entries[i].sprite->texture,
+                           entries[i].sprite->source,
                            {imgX, imgY, imageSize, imageSize},
                            {0, 0}, 0.0f, WHITE);
         }
@@ -3386,21 +3407,21 @@ void GameScreen::drawLocationDetailPopup() {
         // Text
         float textX = imgX + imageSize + 12.0f;
         float textY = currentY + 10.0f;
-        DrawTextEx(gameFont, entries[i].name.c_str(), {textX, textY}, gameFont.baseSize * 1.1f, 1, titleColor);
+        drawText(gameFont, entries[i].name.c_str(), {textX, textY}, gameFont.baseSize * 1.1f, 1, titleColor);
         textY += gameFont.baseSize * 1.2f;
         if (!entries[i].sub1.empty()) {
-            DrawTextEx(gameFont, entries[i].sub1.c_str(), {textX, textY}, gameFont.baseSize * 0.95f, 1, textColor);
+            drawText(gameFont, entries[i].sub1.c_str(), {textX, textY}, gameFont.baseSize * 0.95f, 1, textColor);
             textY += gameFont.baseSize * 1.05f;
         }
         if (!entries[i].sub2.empty()) {
-            DrawTextEx(gameFont, entries[i].sub2.c_str(), {textX, textY}, gameFont.baseSize * 0.95f, 1, textColor);
+            drawText(gameFont, entries[i].sub2.c_str(), {textX, textY}, gameFont.baseSize * 0.95f, 1, textColor);
         }
     }
 
     // Footer note
     const char* note = "Right-click the same location to close this window.";
-    float noteW = MeasureTextEx(gameFont, note, gameFont.baseSize * 0.95f, 1).x;
-    DrawTextEx(gameFont, note, {boxX + (boxWidth - noteW) / 2, boxY + boxHeight - padding * 1.2f}, gameFont.baseSize * 0.95f, 1, GRAY);
+    float noteW = measureText(gameFont, note, gameFont.baseSize * 0.95f, 1).x;
+    drawText(gameFont, note, {boxX + (boxWidth - noteW) / 2, boxY + boxHeight - padding * 1.2f}, gameFont.baseSize * 0.95f, 1, GRAY);
 }
 
 // Add this helper function to game_screen.cpp
@@ -3450,9 +3471,9 @@ void GameScreen::drawHelpMenu() {
     
     // Draw title
     const char* title = "GAME HELP";
-    float titleX = helpMenuArea.x + (helpMenuArea.width - MeasureTextEx(titleFont, title, titleFont.baseSize * 1.5f, 2).x) / 2;
+    float titleX = helpMenuArea.x + (helpMenuArea.width - measureText(titleFont, title, titleFont.baseSize * 1.5f, 2).x) / 2;
     float titleY = helpMenuArea.y + screenHeight * 0.025f; // slightly more margin
-    DrawTextEx(titleFont, title, Vector2{titleX, titleY}, titleFont.baseSize * 1.5f, 2, titleColor);
+    drawText(titleFont, title, Vector2{titleX, titleY}, titleFont.baseSize * 1.5f, 2, titleColor);
     
     // Draw help content or images depending on page
     if (currentHelpPage == 1) {
@@ -3487,7 +3508,7 @@ void GameScreen::drawHelpMenu() {
             if (line.empty()) {
                 contentY += lineHeight / 2.0f;
             } else {
-                DrawTextEx(gameFont, line.c_str(), Vector2{contentX, contentY}, gameFont.baseSize, 1, textColor);
+                drawText(gameFont, line.c_str(), Vector2{contentX, contentY}, gameFont.baseSize, 1, textColor);
                 contentY += lineHeight;
             }
         }
@@ -3512,9 +3533,9 @@ void GameScreen::drawHelpMenu() {
         } else {
             // Fallback text
             const char* msg = "Image not available";
-            float mx = helpMenuArea.x + (helpMenuArea.width - MeasureTextEx(gameFont, msg, gameFont.baseSize, 1).x) / 2.0f;
+            float mx = helpMenuArea.x + (helpMenuArea.width - measureText(gameFont, msg, gameFont.baseSize, 1).x) / 2.0f;
             float my = helpMenuArea.y + helpMenuArea.height / 2.0f - gameFont.baseSize / 2.0f;
-            DrawTextEx(gameFont, msg, {mx, my}, gameFont.baseSize, 1, GRAY);
+            drawText(gameFont, msg, {mx, my}, gameFont.baseSize, 1, GRAY);
         }
     }
     // Draw navigation arrows
@@ -3543,15 +3564,15 @@ void GameScreen::drawHelpMenu() {
     DrawRectangleRec(helpCloseButton, buttonColor);
     DrawRectangleLinesEx(helpCloseButton, 2, WHITE);
     const char* closeText = "CLOSE";
-    float closeTextX = helpCloseButton.x + (helpCloseButton.width - MeasureTextEx(gameFont, closeText, gameFont.baseSize, 1).x) / 2;
+    float closeTextX = helpCloseButton.x + (helpCloseButton.width - measureText(gameFont, closeText, gameFont.baseSize, 1).x) / 2;
     float closeTextY = helpCloseButton.y + (helpCloseButton.height - gameFont.baseSize) / 2;
-    DrawTextEx(gameFont, closeText, Vector2{closeTextX, closeTextY}, gameFont.baseSize, 1, WHITE);
+    drawText(gameFont, closeText, Vector2{closeTextX, closeTextY}, gameFont.baseSize, 1, WHITE);
     // Page indicator
     char pageBuf[32];
     snprintf(pageBuf, sizeof(pageBuf), "Page %d of 4", currentHelpPage);
-    float piX = helpMenuArea.x + (helpMenuArea.width - MeasureTextEx(gameFont, pageBuf, gameFont.baseSize, 1).x) / 2.0f;
+    float piX = helpMenuArea.x + (helpMenuArea.width - measureText(gameFont, pageBuf, gameFont.baseSize, 1).x) / 2.0f;
     float piY = helpCloseButton.y - gameFont.baseSize - screenHeight * 0.012f;
-    DrawTextEx(gameFont, pageBuf, {piX, piY}, gameFont.baseSize, 1, GRAY);
+    drawText(gameFont, pageBuf, {piX, piY}, gameFont.baseSize, 1, GRAY);
 }
 
 void GameScreen::handleHelpMenuClick(Vector2 mousePos) {
@@ -3578,20 +3599,17 @@ void GameScreen::showHelpMenu() {
 void GameScreen::loadHelpImages() {
     if (helpImagesLoaded) return;
     std::vector<std::string> files = {
-        getAssetPath("Horrified_Assets/Monster_Mat/DraculaMat.png"),
-        getAssetPath("Horrified_Assets/Monster_Mat/InvisibleManMat.png"),
-        getAssetPath("Horrified_Assets/Monster_Mat/Precinct.png")
+        "Horrified_Assets/Monster_Mat/DraculaMat.png",
+        "Horrified_Assets/Monster_Mat/InvisibleManMat.png",
+        "Horrified_Assets/Monster_Mat/Precinct.png"
     };
     helpPageImages.clear();
     helpPageImages.reserve(files.size());
     for (const auto& f : files) {
-        Texture2D tex{};
-        if (FileExists(f.c_str())) {
-            tex = LoadTexture(f.c_str());
-            if (tex.id != 0) {
-                SetTextureFilter(tex, TEXTURE_FILTER_BILINEAR);
-                helpPageImages.push_back(tex);
-            }
+        Texture2D tex = loadTexture(f);
+        if (tex.id != 0) {
+            SetTextureFilter(tex, TEXTURE_FILTER_BILINEAR);
+            helpPageImages.push_back(tex);
         }
     }
     helpImagesLoaded = helpPageImages.size() == files.size();
@@ -3605,34 +3623,17 @@ void GameScreen::unloadHelpImages() {
     helpImagesLoaded = false;
 }
 
-void GameScreen::loadFrenziedMonsterTexture() {
-    if (currentFrenziedMonster.empty()) return;
-    
-    // Unload existing texture first
-    unloadFrenziedMonsterTexture();
-    
-    std::string monsterImagePath = "";
+const Sprite* GameScreen::findFrenziedMonsterSprite() const {
+    const char* key = nullptr;
     if (currentFrenziedMonster.find("Dracula") != std::string::npos) {
-        monsterImagePath = getAssetPath("Horrified_Assets/Monsters/Dracula.png");
+        key = "Dracula";
     } else if (currentFrenziedMonster.find("Invisible") != std::string::npos) {
-        monsterImagePath = getAssetPath("Horrified_Assets/Monsters/InvisibleMan.png");
+        key = "InvisibleMan";
     }
-    
-    if (!monsterImagePath.empty() && FileExists(monsterImagePath.c_str())) {
-        frenziedMonsterTexture = LoadTexture(monsterImagePath.c_str());
-        if (frenziedMonsterTexture.id != 0) {
-            frenziedMonsterTextureLoaded = true;
-            std::cout << "Loaded frenzied monster texture: " << monsterImagePath << std::endl;
-        }
-    }
-}
+    if (key == nullptr) return nullptr;
 
-void GameScreen::unloadFrenziedMonsterTexture() {
-    if (frenziedMonsterTextureLoaded && frenziedMonsterTexture.id != 0) {
-        UnloadTexture(frenziedMonsterTexture);
-        frenziedMonsterTextureLoaded = false;
-        std::cout << "Unloaded frenzied monster texture" << std::endl;
-    }
+    auto it = monsterImages.find(key);
+    return it != monsterImages.end() && it->second.isValid() ? &it->second : nullptr;
 }
 
 void GameScreen::showConfirmation(const std::string& question, std::function<void()> onYes, std::function<void()> onNo) {
@@ -3663,8 +3664,8 @@ void GameScreen::drawConfirmationPrompt() {
     DrawRectangleLinesEx({boxX, boxY, boxWidth, boxHeight}, 3, WHITE);
 
     // Draw the question using the stored text
-    Vector2 titleSize = MeasureTextEx(titleFont, confirmationPromptText.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, confirmationPromptText.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 40}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, confirmationPromptText.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, confirmationPromptText.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 40}, titleFont.baseSize, 1, WHITE);
 
     // "Yes" and "No" buttons
     float buttonWidth = boxWidth * 0.3f;
@@ -3684,15 +3685,15 @@ void GameScreen::drawConfirmationPrompt() {
     bool yesHover = CheckCollisionPointRec(mousePos, confirmYesButton);
     DrawRectangleRec(confirmYesButton, yesHover ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(confirmYesButton, 2, WHITE);
-    Vector2 yesTextSize = MeasureTextEx(gameFont, "Yes", gameFont.baseSize, 1);
-    DrawTextEx(gameFont, "Yes", {yesButtonX + (buttonWidth - yesTextSize.x) / 2, buttonY + (buttonHeight - yesTextSize.y) / 2}, gameFont.baseSize, 1, WHITE);
+    Vector2 yesTextSize = measureText(gameFont, "Yes", gameFont.baseSize, 1);
+    drawText(gameFont, "Yes", {yesButtonX + (buttonWidth - yesTextSize.x) / 2, buttonY + (buttonHeight - yesTextSize.y) / 2}, gameFont.baseSize, 1, WHITE);
 
     // Draw No button
     bool noHover = CheckCollisionPointRec(mousePos, confirmNoButton);
     DrawRectangleRec(confirmNoButton, noHover ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(confirmNoButton, 2, WHITE);
-    Vector2 noTextSize = MeasureTextEx(gameFont, "No", gameFont.baseSize, 1);
-    DrawTextEx(gameFont, "No", {noButtonX + (buttonWidth - noTextSize.x) / 2, buttonY + (buttonHeight - noTextSize.y) / 2}, gameFont.baseSize, 1, WHITE);
+    Vector2 noTextSize = measureText(gameFont, "No", gameFont.baseSize, 1);
+    drawText(gameFont, "No", {noButtonX + (buttonWidth - noTextSize.x) / 2, buttonY + (buttonHeight - noTextSize.y) / 2}, gameFont.baseSize, 1, WHITE);
 }
 
 void GameScreen::handleConfirmationPromptClick(Vector2 mousePos) {
@@ -3724,8 +3725,8 @@ void GameScreen::drawGuideVillagersOverlay() {
 
     // Title
     std::string title = "Choose a villager to guide:";
-    Vector2 titleSize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
 
     // Calculate grid layout
     int villagersPerRow = 4;
@@ -3735,7 +3736,7 @@ void GameScreen::drawGuideVillagersOverlay() {
     float startY = boxY + 80;
 
     // Draw villagers in a grid
-    for (size_t i = 0; i < guidableVillagers.size(); i++) {
+    for (size_t i = 0; i < guideOptions.size(); i++) {
         int row = i / villagersPerRow;
         int col = i % villagersPerRow;
         
@@ -3743,14 +3744,13 @@ void GameScreen::drawGuideVillagersOverlay() {
         float y = startY + row * (imageSize + spacing + 30); // Extra space for name
 
         // Draw villager image
-        std::string villagerName = guidableVillagers[i]->getVillagerName();
+        std::string villagerName = guideOptions[i].villager->getVillagerName();
         bool imageFound = false;
         
-        for (const auto& [name, texture] : villagerImages) {
+        for (const auto& [name, sprite] : villagerImages) {
             if (villagerName.find(name) != std::string::npos) {
-                Rectangle sourceRect = {0, 0, (float)texture.width, (float)texture.height};
                 Rectangle destRect = {x, y, imageSize, imageSize};
-                DrawTexturePro(texture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
+                DrawTexturePro(sprite.texture, sprite.source, destRect, Vector2{0, 0}, 0.0f, WHITE);
                 imageFound = true;
                 break;
             }
@@ -3762,22 +3762,22 @@ void GameScreen::drawGuideVillagersOverlay() {
         }
 
         // Draw villager name
-        Vector2 nameSize = MeasureTextEx(gameFont, villagerName.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, villagerName.c_str(), 
+        Vector2 nameSize = measureText(gameFont, villagerName.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, villagerName.c_str(), 
             {x + (imageSize - nameSize.x) / 2, y + imageSize + 5}, 
             gameFont.baseSize, 1, WHITE);
 
         // Draw location info
-        std::string locationInfo = "at " + guidableVillagers[i]->getCurrentLocation()->getName();
-        Vector2 locSize = MeasureTextEx(gameFont, locationInfo.c_str(), gameFont.baseSize * 0.8f, 1);
-        DrawTextEx(gameFont, locationInfo.c_str(), 
+        std::string locationInfo = "at " + guideOptions[i].villager->getCurrentLocation()->getName();
+        Vector2 locSize = measureText(gameFont, locationInfo.c_str(), gameFont.baseSize * 0.8f, 1);
+        drawText(gameFont, locationInfo.c_str(), 
             {x + (imageSize - locSize.x) / 2, y + imageSize + 25}, 
             gameFont.baseSize * 0.8f, 1, GRAY);
 
         // Draw selection number
         std::string number = std::to_string(i + 1);
-        Vector2 numSize = MeasureTextEx(gameFont, number.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, number.c_str(), 
+        Vector2 numSize = measureText(gameFont, number.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, number.c_str(), 
             {x + 5, y + 5}, 
             gameFont.baseSize, 1, YELLOW);
     }
@@ -3794,8 +3794,8 @@ void GameScreen::drawGuideVillagersOverlay() {
     
     DrawRectangleRec(cancelButton, cancelHover ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(cancelButton, 2, WHITE);
-    Vector2 cancelTextSize = MeasureTextEx(gameFont, "Cancel", gameFont.baseSize, 1);
-    DrawTextEx(gameFont, "Cancel", 
+    Vector2 cancelTextSize = measureText(gameFont, "Cancel", gameFont.baseSize, 1);
+    drawText(gameFont, "Cancel", 
         {cancelX + (cancelWidth - cancelTextSize.x) / 2, cancelY + (cancelHeight - cancelTextSize.y) / 2}, 
         gameFont.baseSize, 1, WHITE);
 }
@@ -3815,8 +3815,8 @@ void GameScreen::drawGuideLocationsOverlay() {
 
     // Title
     std::string title = "Where do you want to guide " + selectedVillager->getVillagerName() + "?";
-    Vector2 titleSize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
 
     // Draw location options
     float startY = boxY + 80;
@@ -3837,15 +3837,15 @@ void GameScreen::drawGuideLocationsOverlay() {
         DrawRectangleLinesEx(optionRect, 2, WHITE);
         
         // Draw location name
-        Vector2 textSize = MeasureTextEx(gameFont, locationName.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, locationName.c_str(), 
+        Vector2 textSize = measureText(gameFont, locationName.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, locationName.c_str(), 
             {boxX + 30, y + (optionHeight - textSize.y) / 2}, 
             gameFont.baseSize, 1, WHITE);
         
         // Draw selection number
         std::string number = std::to_string(i + 1);
-        Vector2 numSize = MeasureTextEx(gameFont, number.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, number.c_str(), 
+        Vector2 numSize = measureText(gameFont, number.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, number.c_str(), 
             {boxX + boxWidth - 50, y + (optionHeight - numSize.y) / 2}, 
             gameFont.baseSize, 1, YELLOW);
     }
@@ -3862,8 +3862,8 @@ void GameScreen::drawGuideLocationsOverlay() {
     
     DrawRectangleRec(cancelButton, cancelHover ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(cancelButton, 2, WHITE);
-    Vector2 cancelTextSize = MeasureTextEx(gameFont, "Cancel", gameFont.baseSize, 1);
-    DrawTextEx(gameFont, "Cancel", 
+    Vector2 cancelTextSize = measureText(gameFont, "Cancel", gameFont.baseSize, 1);
+    drawText(gameFont, "Cancel", 
         {cancelX + (cancelWidth - cancelTextSize.x) / 2, cancelY + (cancelHeight - cancelTextSize.y) / 2}, 
         gameFont.baseSize, 1, WHITE);
 }
@@ -3882,8 +3882,8 @@ void GameScreen::drawGuideMessage() {
     DrawRectangleLinesEx({boxX, boxY, boxWidth, boxHeight}, 3, WHITE);
 
     // Draw the message
-    Vector2 textSize = MeasureTextEx(titleFont, guideMessage.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, guideMessage.c_str(),
+    Vector2 textSize = measureText(titleFont, guideMessage.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, guideMessage.c_str(),
         {boxX + (boxWidth - textSize.x) / 2, boxY + (boxHeight - textSize.y) / 2},
         titleFont.baseSize, 1, WHITE);
 }
@@ -3913,7 +3913,7 @@ void GameScreen::handleGuideVillagersClick(Vector2 mousePos) {
     float startX = boxX + (boxWidth - (villagersPerRow * imageSize + (villagersPerRow - 1) * spacing)) / 2;
     float startY = boxY + 80;
 
-    for (size_t i = 0; i < guidableVillagers.size(); i++) {
+    for (size_t i = 0; i < guideOptions.size(); i++) {
         int row = i / villagersPerRow;
         int col = i % villagersPerRow;
         
@@ -3977,8 +3977,8 @@ void GameScreen::drawPickUpItemsOverlay() {
 
     // Title
     std::string title = "Pick up items from " + pickUpLocation + ":";
-    Vector2 titleSize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
 
     // Calculate grid layout
     int itemsPerRow = 4;
@@ -3999,11 +3999,10 @@ void GameScreen::drawPickUpItemsOverlay() {
         std::string itemName = availableItems[i].getItemName();
         bool imageFound = false;
         
-        for (const auto& [name, texture] : itemImages) {
+        for (const auto& [name, sprite] : itemImages) {
             if (itemName.find(name) != std::string::npos) {
-                Rectangle sourceRect = {0, 0, (float)texture.width, (float)texture.height};
                 Rectangle destRect = {x, y, imageSize, imageSize};
-                DrawTexturePro(texture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
+                DrawTexturePro(sprite.texture, sprite.source, destRect, Vector2{0, 0}, 0.0f, WHITE);
                 imageFound = true;
                 break;
             }
@@ -4022,29 +4021,29 @@ void GameScreen::drawPickUpItemsOverlay() {
         }
 
         // Draw item name
-        Vector2 nameSize = MeasureTextEx(gameFont, itemName.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, itemName.c_str(), 
+        Vector2 nameSize = measureText(gameFont, itemName.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, itemName.c_str(), 
             {x + (imageSize - nameSize.x) / 2, y + imageSize + 5}, 
             gameFont.baseSize, 1, WHITE);
 
         // Draw item color
         std::string colorInfo = "Color: " + itemColorToString(availableItems[i].getColor());
-        Vector2 colorSize = MeasureTextEx(gameFont, colorInfo.c_str(), gameFont.baseSize * 0.8f, 1);
-        DrawTextEx(gameFont, colorInfo.c_str(), 
+        Vector2 colorSize = measureText(gameFont, colorInfo.c_str(), gameFont.baseSize * 0.8f, 1);
+        drawText(gameFont, colorInfo.c_str(), 
             {x + (imageSize - colorSize.x) / 2, y + imageSize + 25}, 
             gameFont.baseSize * 0.8f, 1, GRAY);
 
         // Draw item power
         std::string powerInfo = "Power: " + std::to_string(availableItems[i].getPower());
-        Vector2 powerSize = MeasureTextEx(gameFont, powerInfo.c_str(), gameFont.baseSize * 0.8f, 1);
-        DrawTextEx(gameFont, powerInfo.c_str(), 
+        Vector2 powerSize = measureText(gameFont, powerInfo.c_str(), gameFont.baseSize * 0.8f, 1);
+        drawText(gameFont, powerInfo.c_str(), 
             {x + (imageSize - powerSize.x) / 2, y + imageSize + 45}, 
             gameFont.baseSize * 0.8f, 1, GRAY);
 
         // Draw selection number
         std::string number = std::to_string(i + 1);
-        Vector2 numSize = MeasureTextEx(gameFont, number.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, number.c_str(), 
+        Vector2 numSize = measureText(gameFont, number.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, number.c_str(), 
             {x + 5, y + 5}, 
             gameFont.baseSize, 1, YELLOW);
     }
@@ -4061,8 +4060,8 @@ void GameScreen::drawPickUpItemsOverlay() {
     
     DrawRectangleRec(closeButton, closeHover ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(closeButton, 2, WHITE);
-    Vector2 closeTextSize = MeasureTextEx(gameFont, "Close", gameFont.baseSize, 1);
-    DrawTextEx(gameFont, "Close", 
+    Vector2 closeTextSize = measureText(gameFont, "Close", gameFont.baseSize, 1);
+    drawText(gameFont, "Close", 
         {closeX + (closeWidth - closeTextSize.x) / 2, closeY + (closeHeight - closeTextSize.y) / 2}, 
         gameFont.baseSize, 1, WHITE);
 }
@@ -4081,8 +4080,8 @@ void GameScreen::drawPickUpMessage() {
     DrawRectangleLinesEx({boxX, boxY, boxWidth, boxHeight}, 3, WHITE);
 
     // Draw the message
-    Vector2 textSize = MeasureTextEx(titleFont, pickUpMessage.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, pickUpMessage.c_str(),
+    Vector2 textSize = measureText(titleFont, pickUpMessage.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, pickUpMessage.c_str(),
         {boxX + (boxWidth - textSize.x) / 2, boxY + (boxHeight - textSize.y) / 2},
         titleFont.baseSize, 1, WHITE);
 }
@@ -4156,6 +4155,7 @@ void GameScreen::addGameMessageWithAction(const std::string& message, std::funct
 }
 
 void GameScreen::processNextGameMessage() {
+    markBoardDirty();
     if (gameMessages.empty()) {
         showGameMessage = false;
         return;
@@ -4202,7 +4202,7 @@ void GameScreen::drawGameMessage() {
         if (c == ' ' || c == '\n') {
             if (!word.empty()) {
                 std::string testLine = currentLine.empty() ? word : currentLine + " " + word;
-                float lineWidth = MeasureTextEx(messageFont, testLine.c_str(), fontSize, 1).x;
+                float lineWidth = measureText(messageFont, testLine.c_str(), fontSize, 1).x;
                 if (lineWidth <= maxWidth) {
                     currentLine = testLine;
                 } else {
@@ -4224,7 +4224,7 @@ void GameScreen::drawGameMessage() {
     
     if (!word.empty()) {
         std::string testLine = currentLine.empty() ? word : currentLine + " " + word;
-        float lineWidth = MeasureTextEx(messageFont, testLine.c_str(), fontSize, 1).x;
+        float lineWidth = measureText(messageFont, testLine.c_str(), fontSize, 1).x;
         if (lineWidth <= maxWidth) {
             currentLine = testLine;
         } else {
@@ -4243,7 +4243,7 @@ void GameScreen::drawGameMessage() {
     // Draw lines
     float lineHeight = fontSize + 8;
     for (size_t i = 0; i < lines.size() && textY + i * lineHeight < boxY + boxHeight - padding - 50; i++) {
-        DrawTextEx(messageFont, lines[i].c_str(), {textX, textY + i * lineHeight}, fontSize, 1, WHITE);
+        drawText(messageFont, lines[i].c_str(), {textX, textY + i * lineHeight}, fontSize, 1, WHITE);
     }
 
     // Draw action buttons if required
@@ -4263,21 +4263,21 @@ void GameScreen::drawGameMessage() {
         bool yesHover = CheckCollisionPointRec(mousePos, yesButton);
         DrawRectangleRec(yesButton, yesHover ? buttonHoverColor : buttonColor);
         DrawRectangleLinesEx(yesButton, 2, WHITE);
-        Vector2 yesTextSize = MeasureTextEx(gameFont, "Yes", gameFont.baseSize, 1);
-        DrawTextEx(gameFont, "Yes", {yesButtonX + (buttonWidth - yesTextSize.x) / 2, buttonY + (buttonHeight - yesTextSize.y) / 2}, gameFont.baseSize, 1, WHITE);
+        Vector2 yesTextSize = measureText(gameFont, "Yes", gameFont.baseSize, 1);
+        drawText(gameFont, "Yes", {yesButtonX + (buttonWidth - yesTextSize.x) / 2, buttonY + (buttonHeight - yesTextSize.y) / 2}, gameFont.baseSize, 1, WHITE);
 
         // No button
         Rectangle noButton = {noButtonX, buttonY, buttonWidth, buttonHeight};
         bool noHover = CheckCollisionPointRec(mousePos, noButton);
         DrawRectangleRec(noButton, noHover ? buttonHoverColor : buttonColor);
         DrawRectangleLinesEx(noButton, 2, WHITE);
-        Vector2 noTextSize = MeasureTextEx(gameFont, "No", gameFont.baseSize, 1);
-        DrawTextEx(gameFont, "No", {noButtonX + (buttonWidth - noTextSize.x) / 2, buttonY + (buttonHeight - noTextSize.y) / 2}, gameFont.baseSize, 1, WHITE);
+        Vector2 noTextSize = measureText(gameFont, "No", gameFont.baseSize, 1);
+        drawText(gameFont, "No", {noButtonX + (buttonWidth - noTextSize.x) / 2, buttonY + (buttonHeight - noTextSize.y) / 2}, gameFont.baseSize, 1, WHITE);
     } else {
         // Draw close instruction for timed messages
         const char* closeText = "Click to continue";
-        float closeTextWidth = MeasureTextEx(gameFont, closeText, gameFont.baseSize * 0.9f, 1).x;
-        DrawTextEx(gameFont, closeText, {boxX + (boxWidth - closeTextWidth) / 2, boxY + boxHeight - 25}, gameFont.baseSize * 0.9f, 1, GRAY);
+        float closeTextWidth = measureText(gameFont, closeText, gameFont.baseSize * 0.9f, 1).x;
+        drawText(gameFont, closeText, {boxX + (boxWidth - closeTextWidth) / 2, boxY + boxHeight - 25}, gameFont.baseSize * 0.9f, 1, GRAY);
     }
 }
 
@@ -4327,7 +4327,7 @@ void GameScreen::addImportantGameMessages(int initialTerrorLevel, const std::str
             addGameMessage("Terror level increased to " + std::to_string(currentTerrorLevel) + "!");
             
             // Check if terror level reached maximum
-            if (currentTerrorLevel >= 5) {
+            if (currentTerrorLevel >= Rules::TERROR_LIMIT) {
                 addGameMessage("The terror has reached its peak! The monsters have won!");
             }
         }
@@ -4367,139 +4367,24 @@ void GameScreen::addImportantGameMessages(int initialTerrorLevel, const std::str
     }
 }
 
-void GameScreen::capturePreMonsterPhaseState() {
-    preMonsterPhaseState.heroLocations.clear();
-    preMonsterPhaseState.villagerLocations.clear();
-    preMonsterPhaseState.aliveVillagers.clear();
-    
-    // Capture hero locations
-    if (currentHero && currentHero->getCurrentLocation()) {
-        try {
-            std::string heroName = currentHero->getHeroName();
-            std::string locationName = currentHero->getCurrentLocation()->getName();
-            preMonsterPhaseState.heroLocations[heroName] = locationName;
-        } catch (const std::exception& e) {
-            std::cout << "Error capturing current hero location: " << e.what() << std::endl;
-        }
-    }
-    
-    if (otherHero && otherHero->getCurrentLocation()) {
-        try {
-            std::string heroName = otherHero->getHeroName();
-            std::string locationName = otherHero->getCurrentLocation()->getName();
-            preMonsterPhaseState.heroLocations[heroName] = locationName;
-        } catch (const std::exception& e) {
-            std::cout << "Error capturing other hero location: " << e.what() << std::endl;
-        }
-    }
-    
-    // Capture villager locations and alive villagers
-    try {
-        for (const auto& [locName, location] : gameMap->locations) {
-            if (location) {
-                for (const auto& character : location->getCharacters()) {
-                    // Check if it's a villager (not hero or monster)
-                    if (character != "Archeologist" && character != "Mayor" && character != "Scientist" && character != "Courier" && 
-                        character != "Dracula" && character != "Invisible man") {
-                        preMonsterPhaseState.villagerLocations[character] = locName;
-                        preMonsterPhaseState.aliveVillagers.push_back(character);
-                    }
-                }
-            }
-        }
-    } catch (const std::exception& e) {
-        std::cout << "Error capturing villager locations: " << e.what() << std::endl;
-    }
-}
+void GameScreen::showHeroDefenseChoice(const std::vector<Item>& items) {
+    heroDefenseItems = items;
 
-void GameScreen::compareAndAddStateChangeMessages() {
-    // Check for hero hospital movements
-    if (currentHero && currentHero->getCurrentLocation()) {
-        std::string currentLocation = currentHero->getCurrentLocation()->getName();
-        std::string heroName = currentHero->getHeroName();
-        
-        // Check if hero name exists in the map before accessing it
-        auto it = preMonsterPhaseState.heroLocations.find(heroName);
-        if (it != preMonsterPhaseState.heroLocations.end()) {
-            std::string previousLocation = it->second;
-            
-            if (currentLocation == "Hospital" && previousLocation != "Hospital") {
-                addGameMessage(heroName + " was moved to Hospital due to monster attack!");
-            }
-        }
-    }
-    
-    // Check for villager deaths
-    std::vector<std::string> currentAliveVillagers;
-    for (const auto& [locName, location] : gameMap->locations) {
-        for (const auto& character : location->getCharacters()) {
-            if (character != "Archeologist" && character != "Mayor" && character != "Scientist" && character != "Courier" && 
-                character != "Dracula" && character != "Invisible man") {
-                currentAliveVillagers.push_back(character);
+    // Store the actual hero item indices that correspond to these items
+    heroDefenseItemIndices.clear();
+    const auto& heroItems = defendingHero->getItems();
+    for (const auto& defenseItem : items) {
+        for (size_t i = 0; i < heroItems.size(); i++) {
+            if (heroItems[i].getItemName() == defenseItem.getItemName() && 
+                heroItems[i].getColor() == defenseItem.getColor() && 
+                heroItems[i].getPower() == defenseItem.getPower()) {
+                heroDefenseItemIndices.push_back(i);
+                break;
             }
         }
     }
-    
-    // Find villagers that were alive before but are now dead
-    for (const auto& villager : preMonsterPhaseState.aliveVillagers) {
-        if (std::find(currentAliveVillagers.begin(), currentAliveVillagers.end(), villager) == currentAliveVillagers.end()) {
-            addGameMessage(villager + " was killed by monster attack!");
-        }
-    }
-}
 
-void GameScreen::showHeroDefenseChoice(const std::vector<Item>& items, std::function<void(int)> onItemSelected, std::function<void()> onDefenseCanceled) {
-    try {
-        // Check if items vector is valid
-        if (items.empty()) {
-            std::cout << "Error: No items provided for hero defense choice!" << std::endl;
-            if (onDefenseCanceled) {
-                onDefenseCanceled();
-            }
-            return;
-        }
-        
-        // Check if callbacks are valid
-        if (!onItemSelected || !onDefenseCanceled) {
-            std::cout << "Error: Invalid callbacks for hero defense choice!" << std::endl;
-            return;
-        }
-        
-        // Check if currentHero is valid
-        if (!currentHero) {
-            std::cout << "Error: No current hero for defense choice!" << std::endl;
-            if (onDefenseCanceled) {
-                onDefenseCanceled();
-            }
-            return;
-        }
-        
-        // Store the items for display
-        heroDefenseItems = items;
-        
-        // Store the actual hero item indices that correspond to these items
-        heroDefenseItemIndices.clear();
-        const auto& heroItems = currentHero->getItems();
-        for (const auto& defenseItem : items) {
-            for (size_t i = 0; i < heroItems.size(); i++) {
-                if (heroItems[i].getItemName() == defenseItem.getItemName() && 
-                    heroItems[i].getColor() == defenseItem.getColor() && 
-                    heroItems[i].getPower() == defenseItem.getPower()) {
-                    heroDefenseItemIndices.push_back(i);
-                    break;
-                }
-            }
-        }
-        
-        this->onItemSelectedIndex = onItemSelected;
-        this->onDefenseCanceled = onDefenseCanceled;
-        showHeroDefense = true;
-    } catch (const std::exception& e) {
-        std::cout << "Error in showHeroDefenseChoice: " << e.what() << std::endl;
-        if (onDefenseCanceled) {
-            onDefenseCanceled();
-        }
-    }
+    showHeroDefense = true;
 }
 
 void GameScreen::cancelHeroDefense() {
@@ -4509,10 +4394,12 @@ void GameScreen::cancelHeroDefense() {
     heroDefenseItems.clear();
     heroDefenseItemIndices.clear();
 
-    // Clear the hero pointer and callbacks
     defendingHero = nullptr;
-    onItemSelectedCallback = nullptr;
-    onDefenseCanceledCallback = nullptr;
+}
+
+void GameScreen::answerDefense(int choice) {
+    cancelHeroDefense();
+    startMonsterWorker(GameAction::decide(choice));
 }
 
 void GameScreen::drawHeroDefenseOverlay() {
@@ -4535,8 +4422,8 @@ void GameScreen::drawHeroDefenseOverlay() {
 
     // Title
     std::string title = "Choose an item to defend yourself:";
-    Vector2 titleSize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
 
     // Calculate grid layout
     int itemsPerRow = 4;
@@ -4557,11 +4444,10 @@ void GameScreen::drawHeroDefenseOverlay() {
         std::string itemName = heroDefenseItems[i].getItemName();
         bool imageFound = false;
         
-        for (const auto& [name, texture] : itemImages) {
+        for (const auto& [name, sprite] : itemImages) {
             if (itemName.find(name) != std::string::npos) {
-                Rectangle sourceRect = {0, 0, (float)texture.width, (float)texture.height};
                 Rectangle destRect = {x, y, imageSize, imageSize};
-                DrawTexturePro(texture, sourceRect, destRect, Vector2{0, 0}, 0.0f, WHITE);
+                DrawTexturePro(sprite.texture, sprite.source, destRect, Vector2{0, 0}, 0.0f, WHITE);
                 imageFound = true;
                 break;
             }
@@ -4580,29 +4466,29 @@ void GameScreen::drawHeroDefenseOverlay() {
         }
 
         // Draw item name
-        Vector2 nameSize = MeasureTextEx(gameFont, itemName.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, itemName.c_str(), 
+        Vector2 nameSize = measureText(gameFont, itemName.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, itemName.c_str(), 
             {x + (imageSize - nameSize.x) / 2, y + imageSize + 5}, 
             gameFont.baseSize, 1, WHITE);
 
         // Draw item color
         std::string colorInfo = "Color: " + itemColorToString(heroDefenseItems[i].getColor());
-        Vector2 colorSize = MeasureTextEx(gameFont, colorInfo.c_str(), gameFont.baseSize * 0.8f, 1);
-        DrawTextEx(gameFont, colorInfo.c_str(), 
+        Vector2 colorSize = measureText(gameFont, colorInfo.c_str(), gameFont.baseSize * 0.8f, 1);
+        drawText(gameFont, colorInfo.c_str(), 
             {x + (imageSize - colorSize.x) / 2, y + imageSize + 25}, 
             gameFont.baseSize * 0.8f, 1, GRAY);
 
         // Draw item power
         std::string powerInfo = "Power: " + std::to_string(heroDefenseItems[i].getPower());
-        Vector2 powerSize = MeasureTextEx(gameFont, powerInfo.c_str(), gameFont.baseSize * 0.8f, 1);
-        DrawTextEx(gameFont, powerInfo.c_str(), 
+        Vector2 powerSize = measureText(gameFont, powerInfo.c_str(), gameFont.baseSize * 0.8f, 1);
+        drawText(gameFont, powerInfo.c_str(), 
             {x + (imageSize - powerSize.x) / 2, y + imageSize + 45}, 
             gameFont.baseSize * 0.8f, 1, GRAY);
 
         // Draw selection number
         std::string number = std::to_string(i + 1);
-        Vector2 numSize = MeasureTextEx(gameFont, number.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, number.c_str(), 
+        Vector2 numSize = measureText(gameFont, number.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, number.c_str(), 
             {x + 5, y + 5}, 
             gameFont.baseSize, 1, YELLOW);
     }
@@ -4619,8 +4505,8 @@ void GameScreen::drawHeroDefenseOverlay() {
     
     DrawRectangleRec(cancelButton, cancelHover ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(cancelButton, 2, WHITE);
-    Vector2 cancelTextSize = MeasureTextEx(gameFont, "Cancel", gameFont.baseSize, 1);
-    DrawTextEx(gameFont, "Cancel", 
+    Vector2 cancelTextSize = measureText(gameFont, "Cancel", gameFont.baseSize, 1);
+    drawText(gameFont, "Cancel", 
         {cancelX + (cancelWidth - cancelTextSize.x) / 2, cancelY + (cancelHeight - cancelTextSize.y) / 2}, 
         gameFont.baseSize, 1, WHITE);
 }
@@ -4644,7 +4530,7 @@ void GameScreen::handleHeroDefenseClick(Vector2 mousePos) {
     
     Rectangle cancelButton = {cancelX, cancelY, cancelWidth, cancelHeight};
     if (CheckCollisionPointRec(mousePos, cancelButton)) {
-        cancelHeroDefense();
+        answerDefense(Decision::DECLINE);
         return;
     }
 
@@ -4662,12 +4548,8 @@ void GameScreen::handleHeroDefenseClick(Vector2 mousePos) {
         float y = startY + row * (imageSize + spacing + 60);
 
         Rectangle itemRect = {x, y, imageSize, imageSize + 60};
-        if (CheckCollisionPointRec(mousePos, itemRect)) {
-            // Check if callback exists before calling it
-            if (onItemSelectedIndex && i < heroDefenseItemIndices.size()) {
-                onItemSelectedIndex(heroDefenseItemIndices[i]);
-            }
-            cancelHeroDefense();
+        if (CheckCollisionPointRec(mousePos, itemRect) && i < heroDefenseItemIndices.size()) {
+            answerDefense(heroDefenseItemIndices[i]);
             return;
         }
     }
@@ -4699,17 +4581,17 @@ void GameScreen::drawGameOverScreen() {
 
     // Draw the primary Game Over message (e.g., "VICTORY!")
     float titleFontSize = titleFont.baseSize * 2.0f;
-    Vector2 titleSize = MeasureTextEx(titleFont, gameOverMessage.c_str(), titleFontSize, 2);
+    Vector2 titleSize = measureText(titleFont, gameOverMessage.c_str(), titleFontSize, 2);
     float titleX = boxX + (boxWidth - titleSize.x) / 2;
     float titleY = boxY + screenHeight * 0.05f;
-    DrawTextEx(titleFont, gameOverMessage.c_str(), {titleX, titleY}, titleFontSize, 2, titleColor);
+    drawText(titleFont, gameOverMessage.c_str(), {titleX, titleY}, titleFontSize, 2, titleColor);
 
     // Draw the reason for the game ending
     float reasonFontSize = gameFont.baseSize * 1.2f;
-    Vector2 reasonSize = MeasureTextEx(gameFont, gameOverReason.c_str(), reasonFontSize, 1);
+    Vector2 reasonSize = measureText(gameFont, gameOverReason.c_str(), reasonFontSize, 1);
     float reasonX = boxX + (boxWidth - reasonSize.x) / 2;
     float reasonY = titleY + titleSize.y + screenHeight * 0.04f;
-    DrawTextEx(gameFont, gameOverReason.c_str(), {reasonX, reasonY}, reasonFontSize, 1, textColor);
+    drawText(gameFont, gameOverReason.c_str(), {reasonX, reasonY}, reasonFontSize, 1, textColor);
 
     // Define and draw the "Return to Main Menu" button
     float buttonWidth = screenWidth * 0.15f;
@@ -4725,10 +4607,10 @@ void GameScreen::drawGameOverScreen() {
 
     const char* closeText = "MAIN MENU";
     float closeTextFontSize = gameFont.baseSize * 1.2f;
-    Vector2 closeTextSize = MeasureTextEx(gameFont, closeText, closeTextFontSize, 1);
+    Vector2 closeTextSize = measureText(gameFont, closeText, closeTextFontSize, 1);
     float closeTextX = buttonX + (buttonWidth - closeTextSize.x) / 2;
     float closeTextY = buttonY + (buttonHeight - closeTextSize.y) / 2;
-    DrawTextEx(gameFont, closeText, {closeTextX, closeTextY}, closeTextFontSize, 1, textColor);
+    drawText(gameFont, closeText, {closeTextX, closeTextY}, closeTextFontSize, 1, textColor);
 }
 
 void GameScreen::handleGameOverClick(Vector2 mousePos) {
@@ -4751,12 +4633,12 @@ void GameScreen::drawVisitFromDetectiveSelectionOverlay() {
     DrawRectangleLinesEx({boxX, boxY, boxWidth, boxHeight}, 3, WHITE);
 
     std::string title = "Choose a location to place the Invisible Man";
-    Vector2 titleSize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2, boxY + 20}, titleFont.baseSize, 1, WHITE);
 
     std::string instruction = "Click on any location on the map";
-    Vector2 instructionSize = MeasureTextEx(gameFont, instruction.c_str(), gameFont.baseSize, 1);
-    DrawTextEx(gameFont, instruction.c_str(), {boxX + (boxWidth - instructionSize.x) / 2, boxY + 60}, gameFont.baseSize, 1, {230, 230, 230, 255});
+    Vector2 instructionSize = measureText(gameFont, instruction.c_str(), gameFont.baseSize, 1);
+    drawText(gameFont, instruction.c_str(), {boxX + (boxWidth - instructionSize.x) / 2, boxY + 60}, gameFont.baseSize, 1, {230, 230, 230, 255});
 
     // Cancel button
     float btnW = 140.0f, btnH = 44.0f;
@@ -4765,8 +4647,8 @@ void GameScreen::drawVisitFromDetectiveSelectionOverlay() {
     DrawRectangleRec(visitFromDetectiveCancelButton, hovered ? dangerColor : buttonColor);
     DrawRectangleLinesEx(visitFromDetectiveCancelButton, 2, WHITE);
     std::string cancel = "Cancel";
-    Vector2 csz = MeasureTextEx(gameFont, cancel.c_str(), gameFont.baseSize, 1);
-    DrawTextEx(gameFont, cancel.c_str(), {visitFromDetectiveCancelButton.x + (visitFromDetectiveCancelButton.width - csz.x) / 2.0f, visitFromDetectiveCancelButton.y + (visitFromDetectiveCancelButton.height - csz.y) / 2.0f}, gameFont.baseSize, 1, WHITE);
+    Vector2 csz = measureText(gameFont, cancel.c_str(), gameFont.baseSize, 1);
+    drawText(gameFont, cancel.c_str(), {visitFromDetectiveCancelButton.x + (visitFromDetectiveCancelButton.width - csz.x) / 2.0f, visitFromDetectiveCancelButton.y + (visitFromDetectiveCancelButton.height - csz.y) / 2.0f}, gameFont.baseSize, 1, WHITE);
 }
 
 void GameScreen::handleVisitFromDetectiveSelectionClick(Vector2 mousePos) {
@@ -4780,35 +4662,16 @@ void GameScreen::handleVisitFromDetectiveSelectionClick(Vector2 mousePos) {
     // Check if clicked on a map location
     for (const auto& [name, location] : mapLocations) {
         if (CheckCollisionPointCircle(mousePos, location.position, location.radius)) {
-            try {
-                // Use the perk card with the selected location
-                auto targetLocation = gameMap->getLocation(name);
-                if (taskBoard.isInvisibleManDefeated()) {
-                    addGameMessage("Invisible Man is already defeated. Perk has no effect.");
-                } else if (invisibleMan && invisibleMan->getCurrentLocation()) {
-                    auto currentLocation = invisibleMan->getCurrentLocation();
-                    currentLocation->removeCharacter("Invisible man");
-                    targetLocation->addCharacter("Invisible man");
-                    invisibleMan->setCurrentLocation(targetLocation);
-                    addGameMessage("Invisible Man moved to " + name);
-                } else {
-                    addGameMessage("Invisible Man is defeated.");
-                }
-                
-                // Remove the perk card
-                const auto& perks = currentHero->getPerkCards();
-                for (size_t i = 0; i < perks.size(); ++i) {
-                    if (perks[i].getType() == PerkType::VisitFromTheDetective) {
-                        currentHero->removePerkCard(i);
-                        break;
+            const auto& perks = currentHero->getPerkCards();
+            for (size_t i = 0; i < perks.size(); ++i) {
+                if (perks[i].getType() == PerkType::VisitFromTheDetective) {
+                    if (submitHeroAction(GameAction::usePerk(i, gameMap->findLocation(name)))) {
+                        addGameMessage("Invisible Man moved to " + name);
                     }
+                    break;
                 }
-                
-                showVisitFromDetectiveSelection = false;
-                initializeLocations();
-            } catch (const std::exception& e) {
-                addGameMessage(std::string("Error moving Invisible Man: ") + e.what());
             }
+            showVisitFromDetectiveSelection = false;
             break;
         }
     }
@@ -4833,8 +4696,8 @@ void GameScreen::drawAdvanceDefeatItemSelectionOverlay() {
     } else {
         title = (advanceDefeatTarget == "invisibleman") ? "Defeat Invisible Man (Use Red Item)" : "Defeat Dracula (Use Yellow Item)";
     }
-    Vector2 titleSize = MeasureTextEx(titleFont, title.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2.0f, boxY + 18.0f}, titleFont.baseSize, 1, WHITE);
+    Vector2 titleSize = measureText(titleFont, title.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, title.c_str(), {boxX + (boxWidth - titleSize.x) / 2.0f, boxY + 18.0f}, titleFont.baseSize, 1, WHITE);
 
     // Build eligible item list
     std::vector<Item> eligibleItems;
@@ -4852,54 +4715,23 @@ void GameScreen::drawAdvanceDefeatItemSelectionOverlay() {
         DrawRectangleLinesEx(r, 2, WHITE);
         // item name
         std::string name = item.getItemName();
-        Vector2 nsz = MeasureTextEx(gameFont, name.c_str(), gameFont.baseSize, 1);
-        DrawTextEx(gameFont, name.c_str(), {r.x + 12.0f, r.y + 10.0f}, gameFont.baseSize, 1, WHITE);
+        Vector2 nsz = measureText(gameFont, name.c_str(), gameFont.baseSize, 1);
+        drawText(gameFont, name.c_str(), {r.x + 12.0f, r.y + 10.0f}, gameFont.baseSize, 1, WHITE);
         // color/power
         std::string meta = std::string("Color: ") + itemColorToString(item.getColor()) + ", Power: " + std::to_string(item.getPower());
-        DrawTextEx(gameFont, meta.c_str(), {r.x + 12.0f, r.y + 12.0f + nsz.y}, gameFont.baseSize * 0.9f, 1, {230,230,230,255});
+        drawText(gameFont, meta.c_str(), {r.x + 12.0f, r.y + 12.0f + nsz.y}, gameFont.baseSize * 0.9f, 1, {230,230,230,255});
         // origin location (for evidences)
         if (item.getLocation()) {
             std::string src = std::string("From: ") + item.getLocation()->getName();
-            DrawTextEx(gameFont, src.c_str(), {r.x + 12.0f, r.y + 12.0f + nsz.y + gameFont.baseSize * 0.95f}, gameFont.baseSize * 0.85f, 1, GRAY);
+            drawText(gameFont, src.c_str(), {r.x + 12.0f, r.y + 12.0f + nsz.y + gameFont.baseSize * 0.95f}, gameFont.baseSize * 0.85f, 1, GRAY);
         }
     };
 
-    // Determine eligibility
-    std::vector<int> eligibleIndices; // indices in heroItems corresponding to buttons
-
-    if (advanceDefeatAction == "advance" && advanceDefeatTarget == "invisibleman") {
-        // Evidence delivery at Precinct: items whose original location is one of the five and not yet delivered
-        std::vector<std::string> clueLocations = {"Inn", "Mansion", "Barn", "Laboratory", "Institute"};
-        for (size_t i = 0; i < heroItems.size(); ++i) {
-            auto locPtr = heroItems[i].getLocation();
-            if (!locPtr) continue;
-            std::string locName = locPtr->getName();
-            if (std::find(clueLocations.begin(), clueLocations.end(), locName) != clueLocations.end()) {
-                if (!taskBoard.isClueDelivered(locName)) {
-                    eligibleIndices.push_back((int)i);
-                }
-            }
-        }
-    } else if (advanceDefeatAction == "advance" && advanceDefeatTarget == "coffin") {
-        for (size_t i = 0; i < heroItems.size(); ++i) {
-            if (heroItems[i].getColor() == ItemColor::Red) eligibleIndices.push_back((int)i);
-        }
-    } else if (advanceDefeatAction == "defeat" && advanceDefeatTarget == "invisibleman") {
-        if (taskBoard.allCluesDelivered()) {
-            for (size_t i = 0; i < heroItems.size(); ++i) {
-                if (heroItems[i].getColor() == ItemColor::Red) eligibleIndices.push_back((int)i);
-            }
-        }
-    } else if (advanceDefeatAction == "defeat" && advanceDefeatTarget == "dracula") {
-        if (taskBoard.allCoffinsDestroyed()) {
-            for (size_t i = 0; i < heroItems.size(); ++i) {
-                if (heroItems[i].getColor() == ItemColor::Yellow) eligibleIndices.push_back((int)i);
-            }
-        }
+    // The hero worked out which items fit when the overlay opened
+    for (size_t idx : advanceDefeatOptions) {
+        if (idx < heroItems.size()) eligibleItems.push_back(heroItems[idx]);
     }
 
-    for (int idx : eligibleIndices) eligibleItems.push_back(heroItems[idx]);
-
     // grid
     const int columns = 2;
     float padding = 20.0f;
@@ -4923,8 +4755,8 @@ void GameScreen::drawAdvanceDefeatItemSelectionOverlay() {
     DrawRectangleRec(itemSelectionCancelButton, hovered ? dangerColor : buttonColor);
     DrawRectangleLinesEx(itemSelectionCancelButton, 2, WHITE);
     std::string cancel = "Cancel";
-    Vector2 csz = MeasureTextEx(gameFont, cancel.c_str(), gameFont.baseSize, 1);
-    DrawTextEx(gameFont, cancel.c_str(), {itemSelectionCancelButton.x + (itemSelectionCancelButton.width - csz.x) / 2.0f, itemSelectionCancelButton.y + (itemSelectionCancelButton.height - csz.y) / 2.0f}, gameFont.baseSize, 1, WHITE);
+    Vector2 csz = measureText(gameFont, cancel.c_str(), gameFont.baseSize, 1);
+    drawText(gameFont, cancel.c_str(), {itemSelectionCancelButton.x + (itemSelectionCancelButton.width - csz.x) / 2.0f, itemSelectionCancelButton.y + (itemSelectionCancelButton.height - csz.y) / 2.0f}, gameFont.baseSize, 1, WHITE);
 }
 
 void GameScreen::handleAdvanceDefeatItemSelectionClick(Vector2 mousePos) {
@@ -4936,140 +4768,41 @@ void GameScreen::handleAdvanceDefeatItemSelectionClick(Vector2 mousePos) {
     }
 
     if (!currentHero) return;
-    auto heroItems = currentHero->getItems();
-
-    // Rebuild eligible indices in same order used in draw
-    std::vector<int> eligibleIndices;
-    if (advanceDefeatAction == "advance" && advanceDefeatTarget == "invisibleman") {
-        std::vector<std::string> clueLocations = {"Inn", "Mansion", "Barn", "Laboratory", "Institute"};
-        for (size_t i = 0; i < heroItems.size(); ++i) {
-            auto locPtr = heroItems[i].getLocation();
-            if (!locPtr) continue;
-            std::string locName = locPtr->getName();
-            if (std::find(clueLocations.begin(), clueLocations.end(), locName) != clueLocations.end()) {
-                if (!taskBoard.isClueDelivered(locName)) eligibleIndices.push_back((int)i);
-            }
-        }
-    } else if (advanceDefeatAction == "advance" && advanceDefeatTarget == "coffin") {
-        for (size_t i = 0; i < heroItems.size(); ++i) {
-            if (heroItems[i].getColor() == ItemColor::Red) eligibleIndices.push_back((int)i);
-        }
-    } else if (advanceDefeatAction == "defeat" && advanceDefeatTarget == "invisibleman") {
-        if (taskBoard.allCluesDelivered()) {
-            for (size_t i = 0; i < heroItems.size(); ++i) {
-                if (heroItems[i].getColor() == ItemColor::Red) eligibleIndices.push_back((int)i);
-            }
-        }
-    } else if (advanceDefeatAction == "defeat" && advanceDefeatTarget == "dracula") {
-        if (taskBoard.allCoffinsDestroyed()) {
-            for (size_t i = 0; i < heroItems.size(); ++i) {
-                if (heroItems[i].getColor() == ItemColor::Yellow) eligibleIndices.push_back((int)i);
-            }
-        }
-    }
 
     // Map click to selected item index
-    for (size_t i = 0; i < itemSelectionButtons.size() && i < eligibleIndices.size(); ++i) {
+    for (size_t i = 0; i < itemSelectionButtons.size() && i < advanceDefeatOptions.size(); ++i) {
         if (CheckCollisionPointRec(mousePos, itemSelectionButtons[i])) {
-            int invIndex = eligibleIndices[i];
-            // Scientist ability
-            if (currentHero->getHeroName() == "Scientist") {
-                try { currentHero->ability(invIndex); } catch (...) {}
-            }
-
-            Item selected = heroItems[invIndex];
-            try {
+            size_t itemIndex = advanceDefeatOptions[i];
+            Item selected = currentHero->getItems()[itemIndex];
+            // The Scientist's ability only adds power, so the GUI always uses it
+            bool useAbility = currentHero->getKind() == HeroKind::Scientist;
+            std::string power = std::to_string(selected.getPower() + (useAbility ? 1 : 0));
+            GameAction action = advanceDefeatAction == "advance" ? GameAction::advance(itemIndex, useAbility)
+                                                                 : GameAction::defeat(itemIndex, useAbility);
+            if (submitHeroAction(action)) {
                 if (advanceDefeatAction == "advance" && advanceDefeatTarget == "invisibleman") {
                     std::string srcLoc = selected.getLocation() ? selected.getLocation()->getName() : "";
-                    taskBoard.deliverClue(srcLoc);
                     addGameMessage(currentHero->getPlayerName() + std::string(" (") + currentHero->getHeroName() + ") delivered evidence from " + srcLoc + ".");
-                    currentHero->removeItem(invIndex);
-                    remainingActions--;
-                } else if (advanceDefeatAction == "advance" && advanceDefeatTarget == "coffin") {
-                    taskBoard.addStrengthToCoffin(currentHero->getCurrentLocation()->getName(), selected.getPower());
-                    addGameMessage("Coffin at " + currentHero->getCurrentLocation()->getName() + " damaged by " + std::to_string(selected.getPower()) + ".");
-                    currentHero->removeItem(invIndex);
-                    remainingActions--;
-                } else if (advanceDefeatAction == "defeat" && advanceDefeatTarget == "invisibleman") {
-                    if (!taskBoard.allCluesDelivered()) {
-                        addGameMessage("All evidences are not delivered yet.");
-                    } else {
-                        taskBoard.addStrengthToInvisibleMan(selected.getPower());
-                        addGameMessage("Invisible Man damaged by " + std::to_string(selected.getPower()) + ".");
-                        currentHero->removeItem(invIndex);
-                        remainingActions--;
-                        if (taskBoard.getInvisibleManDefeatStrength() >= 9) {
-                            taskBoard.defeatInvisibleMan();
-                            addGameMessage("Invisible Man has been defeated!");
-                            // Remove Invisible Man from the board and disable further actions
-                            try {
-                                if (invisibleMan && invisibleMan->getCurrentLocation()) {
-                                    invisibleMan->getCurrentLocation()->removeCharacter("Invisible man");
-                                }
-                            } catch (...) {}
-                            invisibleMan.reset();
-                            // Update frenzy marker if needed
-                            if (frenzyMarker) {
-                                if (dracula) {
-                                    frenzyMarker->setCurrentFrenzied(static_cast<Dracula*>(dracula.get()));
-                                } else {
-                                    frenzyMarker->setCurrentFrenzied(nullptr);
-                                    currentFrenziedMonster.clear();
-                                }
-                            }
-                        }
-                    }
-                } else if (advanceDefeatAction == "defeat" && advanceDefeatTarget == "dracula") {
-                    if (!taskBoard.allCoffinsDestroyed()) {
-                        addGameMessage("All coffins must be destroyed first.");
-                    } else {
-                        taskBoard.addStrengthToDracula(selected.getPower());
-                        addGameMessage("Dracula damaged by " + std::to_string(selected.getPower()) + ".");
-                        currentHero->removeItem(invIndex);
-                        remainingActions--;
-                        if (taskBoard.getDraculaDefeatStrength() >= 6) {
-                            addGameMessage("Dracula has been defeated!");
-                            // Remove Dracula from the board and disable further actions
-                            try {
-                                if (dracula && dracula->getCurrentLocation()) {
-                                    dracula->getCurrentLocation()->removeCharacter("Dracula");
-                                }
-                            } catch (...) {}
-                            dracula.reset();
-                            // Update frenzy marker if needed
-                            if (frenzyMarker) {
-                                if (invisibleMan) {
-                                    frenzyMarker->setCurrentFrenzied(static_cast<InvisibleMan*>(invisibleMan.get()));
-                                } else {
-                                    frenzyMarker->setCurrentFrenzied(nullptr);
-                                    currentFrenziedMonster.clear();
-                                }
-                            }
-                        }
-                    }
+                } else if (advanceDefeatAction == "advance") {
+                    addGameMessage("Coffin at " + currentHero->getCurrentLocation()->getName() + " damaged by " + power + ".");
+                } else if (advanceDefeatTarget == "invisibleman") {
+                    addGameMessage(taskBoard.isInvisibleManDefeated() ? "Invisible Man has been defeated!" : "Invisible Man damaged by " + power + ".");
+                } else {
+                    addGameMessage(taskBoard.isDraculaDefeated() ? "Dracula has been defeated!" : "Dracula damaged by " + power + ".");
                 }
-            } catch (const std::exception& e) {
-                addGameMessage(std::string("Error applying item: ") + e.what());
             }
 
             showAdvanceItemSelection = false;
             showDefeatItemSelection = false;
-            initializeLocations();
-            if (remainingActions <= 0) { showEndTurnPrompt = true; endTurnPromptTimer = 3.0f; }
+            advanceDefeatOptions.clear();
             return;
         }
     }
 }
 
-void GameScreen::showHeroDefenseYesNoChoice(Hero* hero, 
-                                            std::function<void(int)> onItemSelected, 
-                                            std::function<void()> onCanceled) {
-    if (!hero) return;
-
-    // Store the hero and the final callbacks
-    defendingHero = hero;
-    onItemSelectedCallback = onItemSelected;
-    onDefenseCanceledCallback = onCanceled;
+void GameScreen::showDefenseDecision(const Decision& decision) {
+    defendingHero = decision.hero;
+    heroDefenseItems = decision.options;
 
     // Activate the Yes/No overlay
     showHeroDefenseYesNoOverlay = true;
@@ -5092,8 +4825,8 @@ void GameScreen::drawHeroDefenseYesNoOverlay() {
 
     // Draw the question text
     std::string message = defendingHero->getHeroName() + " is under attack!\nUse an item to defend?";
-    Vector2 textSize = MeasureTextEx(titleFont, message.c_str(), titleFont.baseSize, 1);
-    DrawTextEx(titleFont, message.c_str(),
+    Vector2 textSize = measureText(titleFont, message.c_str(), titleFont.baseSize, 1);
+    drawText(titleFont, message.c_str(),
                {boxX + (boxWidth - textSize.x) / 2, boxY + 40},
                titleFont.baseSize, 1, WHITE);
 
@@ -5115,13 +4848,13 @@ void GameScreen::drawHeroDefenseYesNoOverlay() {
     bool yesHover = CheckCollisionPointRec(mousePos, defenseYesButton);
     DrawRectangleRec(defenseYesButton, yesHover ? buttonHoverColor : buttonColor);
     DrawRectangleLinesEx(defenseYesButton, 2, WHITE);
-    DrawTextEx(gameFont, "Yes", {yesButtonX + 60, buttonY + 15}, gameFont.baseSize, 1, WHITE);
+    drawText(gameFont, "Yes", {yesButtonX + 60, buttonY + 15}, gameFont.baseSize, 1, WHITE);
 
     // Draw No button
     bool noHover = CheckCollisionPointRec(mousePos, defenseNoButton);
     DrawRectangleRec(defenseNoButton, noHover ? dangerColor : buttonColor);
     DrawRectangleLinesEx(defenseNoButton, 2, WHITE);
-    DrawTextEx(gameFont, "No", {noButtonX + 70, buttonY + 15}, gameFont.baseSize, 1, WHITE);
+    drawText(gameFont, "No", {noButtonX + 70, buttonY + 15}, gameFont.baseSize, 1, WHITE);
 }
 
 void GameScreen::handleHeroDefenseYesNoClick(Vector2 mousePos) {
@@ -5138,14 +4871,9 @@ void GameScreen::handleHeroDefenseYesNoChoice(bool useItem) {
 
     if (useItem) {
         // Player chose YES. Now show the item selection grid.
-        // We pass the stored callbacks to the next stage.
-        showHeroDefenseChoice(defendingHero->getItems(), onItemSelectedCallback, onDefenseCanceledCallback);
+        showHeroDefenseChoice(heroDefenseItems);
     } else {
-        // Player chose NO. Execute the cancel/failure callback immediately.
-        if (onDefenseCanceledCallback) {
-            onDefenseCanceledCallback();
-        }
-        // Clean up the entire defense state
-        cancelHeroDefense();
+        // Player chose NO: the hero takes the hit
+        answerDefense(Decision::DECLINE);
     }
 }
\ No newline at end of file
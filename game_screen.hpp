@@ -19,6 +19,18 @@
 #include "gamestate.hpp"
 #include "savemanager.hpp"
 #include "villagermanager.hpp"
+#include "gamearena.hpp"
+#include "spriteatlas.hpp"
+#include "textlayoutcache.hpp"
+#include "framepacer.hpp"
+#include "assetloader.hpp"
+#include "assetarchive.hpp"
+#include "gameevents.hpp"
+#include "gameengine.hpp"
+#include <string_view>
+#include <atomic>
+#include <deque>
+#include <thread>
 
 struct PlayerInfo {
     std::string name;
@@ -38,12 +50,19 @@ class FrenzyMarker;
 class VillagerManager;
 class ItemBag;
 
+// What drawCharacters needs for one character, resolved when characters move
+struct CharacterVisual {
+    const Sprite* sprite = nullptr;
+    Color fallbackColor = BLUE;  // circle colour when there is no image
+};
+
 struct MapLocation {
     std::string name;
     Vector2 position;
     float radius;
     bool isClickable;
     std::vector<std::string> characters;
+    std::vector<CharacterVisual> characterVisuals;  // parallel to characters
     std::vector<Item> items;
     bool hasCoffin;
     bool hasEvidence;
@@ -79,6 +98,7 @@ class GameScreen {
 private:
     int screenWidth = 1400;
     int screenHeight = 900;
+    const AssetArchive* assetArchive = nullptr;  // owned by the main menu
     
     // Game state
     std::vector<PlayerInfo> players;
@@ -90,10 +110,11 @@ private:
     Hero* currentHero;
     Hero* otherHero;
     
-    // Game components
+    // Game components (the arena is declared first so it is released last)
+    GameArena gameArena;
     std::unique_ptr<Map> gameMap;
-    std::unique_ptr<Monster> dracula;
-    std::unique_ptr<Monster> invisibleMan;
+    ArenaPtr<Monster> dracula;
+    ArenaPtr<Monster> invisibleMan;
     VillagerManager villagerManager;
     ItemBag* itemBag;
     MonsterManager monsterManager;
@@ -101,9 +122,14 @@ private:
     TaskBoard taskBoard;
     std::unique_ptr<FrenzyMarker> frenzyMarker;
     std::unique_ptr<SaveManager> saveManager;
+    // Turn order, monster phase and end-of-game checks; hero actions still go
+    // through the overlays below
+    GameEngine engine;
     
     // Graphics & UI Colors
     Font gameFont, titleFont, largeFont;
+    TextLayoutCache textLayoutCache;
+    int textLayoutScreenWidth = 0, textLayoutScreenHeight = 0;
     Color backgroundColor = {20, 20, 20, 255};
     Color textColor = {255, 255, 255, 255};
     Color titleColor = {200, 50, 50, 255};
@@ -131,18 +157,23 @@ private:
     std::vector<Rectangle> terrorTrackers;
     int currentTerrorLevel;
     
-    // Monster phase elements
-    Texture2D monsterCardTexture, frenziedMonsterTexture;
-    bool monsterCardLoaded, frenziedMonsterTextureLoaded;
+    // Monster phase elements (card images are all loaded with the other assets)
+    std::unordered_map<std::string, Texture2D> monsterCardImages;
     std::string currentMonsterCard, diceResultText, drawnMonsterCardName, currentFrenziedMonster = "";
     bool showMonsterPhaseUI = false;
     std::vector<std::string> diceResults;
     Rectangle monsterCardBox, diceResultsBox, frenzyMarkerBox;
     
-    // Image Textures
-    std::unordered_map<std::string, Texture2D> heroImages, monsterImages, villagerImages, itemImages, perkCardImages;
+    // Image Textures (small sprites live in the atlas, perk cards are full-size textures)
+    SpriteAtlas spriteAtlas;
+    std::unordered_map<std::string, Sprite> heroImages, monsterImages, villagerImages, itemImages;
+    std::unordered_map<std::string, Texture2D> perkCardImages;
     bool heroImagesLoaded, monsterImagesLoaded, villagerImagesLoaded, itemImagesLoaded, perkCardImagesLoaded, coffinImagesLoaded;
-    Texture2D coffinTexture, smashedCoffinTexture;
+    Sprite coffinTexture, smashedCoffinTexture;
+
+    // Decodes the images above in the background; released once everything is uploaded
+    std::unique_ptr<AssetLoader> assetLoader;
+    bool assetsReady = false;
     std::vector<std::string> coffinLocations = {"Cave", "Dungeon", "Crypt", "Graveyard"};
     
     // Help Menu
@@ -177,17 +208,15 @@ private:
     Rectangle confirmYesButton;
     Rectangle confirmNoButton;
 
-    // These are still needed for the move action itself
+    // Where the hero goes once the villager question is answered
     std::string pendingMoveLocation;
-    std::vector<std::string> villagersToMove;
 
     // Guide action variables
     bool showGuideVillagers = false;
     bool showGuideLocations = false;
-    std::vector<std::shared_ptr<Villager>> guidableVillagers;
-    std::vector<std::vector<std::shared_ptr<Location>>> guidableMoves;
+    GuideOptions guideOptions;
     std::shared_ptr<Villager> selectedVillager;
-    std::vector<std::shared_ptr<Location>> availableGuideLocations;
+    SmallVector<std::shared_ptr<Location>, Location::MAX_NEIGHBORS> availableGuideLocations;
     std::string guideMessage;
     float guideMessageTimer = 0.0f;
 
@@ -197,19 +226,15 @@ private:
     std::string pickUpLocation;
     std::string pickUpMessage;
     float pickUpMessageTimer = 0.0f;
-    bool itemWasPickedUpThisTurn;
+    // Taken in one action when the overlay closes
+    std::vector<Item> pickedUpItems;
 
     // Hero defense system
     bool showHeroDefense = false;
-    bool isHeroDefenseChoiceActive = false; 
     std::vector<Item> heroDefenseItems;
     std::vector<int> heroDefenseItemIndices;
-    std::function<void(int)> onItemSelectedIndex;
-    std::function<void()> onDefenseCanceled;
     Hero* defendingHero = nullptr;
     bool showHeroDefenseYesNoOverlay;
-    std::function<void(int)> onItemSelectedCallback;
-    std::function<void()> onDefenseCanceledCallback;
     Rectangle defenseYesButton; 
     Rectangle defenseNoButton; 
     
@@ -225,13 +250,20 @@ private:
     bool showGameMessage = false;
     GameMessage currentGameMessage;
 
-    // Monster phase state tracking
-    struct MonsterPhaseState {
-        std::unordered_map<std::string, std::string> heroLocations; 
-        std::unordered_map<std::string, std::string> villagerLocations; 
-        std::vector<std::string> aliveVillagers;
-    };
-    MonsterPhaseState preMonsterPhaseState;
+    // Engine events raised on the UI thread (hero phase); the monster phase
+    // publishes through monsterEvents instead
+    GameEventBus gameEvents;
+
+    // The monster phase runs on monsterWorker; the UI only touches game state
+    // again once it has been joined. Its events are shown one at a time.
+    static constexpr float MONSTER_EVENT_INTERVAL = 0.6f;
+    std::thread monsterWorker;
+    std::atomic<bool> monsterWorkerDone{false};
+    std::string monsterWorkerError;
+    QueuedEventSink monsterEvents;
+    std::deque<GameEvent> pendingMonsterEvents;
+    float monsterEventTimer = 0.0f;
+    std::string lastMonsterEventText, monsterEventLocation;
 
     bool isGameOver = false;
     std::string gameOverMessage;
@@ -247,7 +279,8 @@ private:
     std::shared_ptr<Location> archeologistChosenLocation;
     std::vector<Rectangle> archeologistItemButtons;
     Rectangle archeologistDoneButton;
-    bool archeologistPickedUpItem;
+    std::vector<Item> archeologistAvailableItems;
+    std::vector<Item> archeologistPickedItems;
 
     // Perk selection overlay
     bool showPerkSelection = false;
@@ -266,6 +299,8 @@ private:
     Rectangle itemSelectionCancelButton;
     std::string advanceDefeatAction; 
     std::string advanceDefeatTarget; 
+    // Indices of the hero items the overlay offers
+    std::vector<std::size_t> advanceDefeatOptions;
 
     // Evidence display
     std::unordered_map<std::string, std::string> evidenceItems;
@@ -275,8 +310,24 @@ private:
     Rectangle saveBackToGameButton{};
     Rectangle saveGoToMenuButton{};
 
+    // Debug overlay
+    bool showDebugOverlay = false;
+
+    // Retained board layer (map, coffins, characters, items), redrawn only when boardVersion moves
+    RenderTexture2D boardTexture{};
+    bool boardTextureLoaded = false;
+    unsigned int boardVersion = 1;
+    unsigned int boardTextureVersion = 0;
+    unsigned int boardRebuilds = 0;
+
+    // Owned by the main loop, only read for the debug overlay
+    const FramePacer* framePacer = nullptr;
+    FrameTimeHistogram frameTimes, monsterPhaseFrameTimes;
+
 public:
-    GameScreen(const std::vector<PlayerInfo>& playerInfo, const std::string& startPlayer, int windowWidth = 1400, int windowHeight = 900);
+    // archive is optional and must outlive the screen; loose files are used for anything it lacks
+    GameScreen(const std::vector<PlayerInfo>& playerInfo, const std::string& startPlayer, int windowWidth = 1400, int windowHeight = 900,
+               const AssetArchive* archive = nullptr);
     ~GameScreen();
     
     void run();
@@ -284,14 +335,13 @@ public:
     void handleInput();
     void updateGame();
     bool shouldReturnToMenu() const { return returnToMenu; }
+    // True while timers or timed messages need frames even without input
+    bool isBusy() const;
+    void setFramePacer(const FramePacer* pacer) { framePacer = pacer; }
 
-    void startHeroDefense(Hero* hero,
-                          std::function<void(int)> onItemSelected,
-                          std::function<void()> onCanceled);
-    
-    void showHeroDefenseYesNoChoice(Hero* hero, 
-                                   std::function<void(int)> onItemSelected, 
-                                   std::function<void()> onCanceled);
+    // Asks the attacked hero whether to defend; the answer resumes the engine
+    void showDefenseDecision(const Decision& decision);
+    void answerDefense(int choice);
                                    void handleHeroDefenseYesNoChoice(bool useItem);
                                    void drawHeroDefenseYesNoOverlay();
                                    void handleHeroDefenseYesNoClick(Vector2 mousePos);
@@ -313,6 +363,8 @@ private:
     void drawLocations();
     void drawCharacters();
     void drawItems();
+    void drawBoardLayer();
+    void markBoardDirty();
     void drawCoffins();
     void drawTerrorTracker();
     void drawHeroInfoPanel();
@@ -340,6 +392,7 @@ private:
     void drawPerkSelectionOverlay(); 
     void drawVisitFromDetectiveSelectionOverlay(); 
     void drawAdvanceDefeatItemSelectionOverlay(); 
+    void drawDebugOverlay();
     
     // Input handling
     void handleMapClick(Vector2 mousePos);
@@ -371,10 +424,8 @@ private:
     void addGameMessageWithAction(const std::string& message, std::function<void()> onConfirm, std::function<void()> onCancel); // ADDED
     void processNextGameMessage(); // ADDED
     void addImportantGameMessages(int initialTerrorLevel, const std::string& initialFrenziedMonster); // ADDED
-    void showHeroDefenseChoice(const std::vector<Item>& items, std::function<void(int)> onItemSelected, std::function<void()> onDefenseCanceled); // ADDED
+    void showHeroDefenseChoice(const std::vector<Item>& items); // ADDED
     void cancelHeroDefense(); // ADDED
-    void capturePreMonsterPhaseState(); // ADDED
-    void compareAndAddStateChangeMessages(); // ADDED
     void pickUpItem(const std::string& location);
     void advanceMonster(const std::string& location);
     void defeatMonster(const std::string& location);
@@ -389,13 +440,27 @@ private:
     // Monster phase logic
     void startMonsterPhase();
     void executeMonsterTurn();
-    void useItemForDefense(const Item& item);
-    void useItemForDefenseByIndex(int itemIndex);
+    void updateMonsterTurn();
+    void finishMonsterTurn();
+    // Runs one engine step (EndTurn or a Decide) on monsterWorker
+    void startMonsterWorker(const GameAction& action);
+    void waitForMonsterWorker();
+    // Hero actions go through the engine; this also refreshes the board and the action count
+    bool submitHeroAction(const GameAction& action);
+    void refreshActionCount();
+    void presentMonsterEvent(const GameEvent& event);
+    void handleGameEvent(const GameEvent& event);
+    bool isMonsterTurnRunning() const { return monsterWorker.joinable(); }
     void showMonsterPhaseResults();
     void advanceMonsterPhase();
     
     // Utility functions
     std::string getAssetPath(const std::string& relativePath);
+    Font loadFont(const std::string& relativePath, int fontSize);
+    Texture2D loadTexture(const std::string& relativePath);
+    // Cached stand-ins for MeasureTextEx / DrawTextEx
+    Vector2 measureText(const Font& font, std::string_view text, float fontSize, float spacing);
+    void drawText(const Font& font, std::string_view text, Vector2 position, float fontSize, float spacing, Color tint);
     void updateItemTooltip(const std::string& locationName, const std::vector<Item>& items);
     void updateTerrorLevel(int level);
     
@@ -406,6 +471,12 @@ private:
     void loadItemImages();
     void loadPerkCardImages();
     void loadCoffinImages();
+    void loadMonsterCardImages();
+    void buildSpriteAtlas();
+    void updateAssetLoading();
+    void drawLoadingScreen();
+    const Sprite* findCharacterSprite(const std::string& charName) const;
+    CharacterVisual resolveCharacterVisual(const std::string& charName) const;
     void unloadImages();
     
     // Perk card & Item utilities
@@ -421,8 +492,7 @@ private:
     
     // Monster card & texture utilities
     std::string convertMonsterCardNameToImage(const std::string& cardName);
-    void loadFrenziedMonsterTexture();
-    void unloadFrenziedMonsterTexture();
+    const Sprite* findFrenziedMonsterSprite() const;
 
     void showConfirmation(const std::string& question, std::function<void()> onYes, std::function<void()> onNo);
     void drawConfirmationPrompt();
@@ -0,0 +1,21 @@
+#include "gamearena.hpp"
+
+using namespace std;
+
+GameArena::GameArena(size_t initialSize) : buffer(initialSize) {}
+
+GameArena::~GameArena() {
+    reset();
+}
+
+pmr::memory_resource* GameArena::resource() {
+    return &buffer;
+}
+
+void GameArena::reset() {
+    for (auto it = ownedObjects.rbegin(); it != ownedObjects.rend(); ++it) {
+        it->second(it->first);
+    }
+    ownedObjects.clear();
+    buffer.release();
+}
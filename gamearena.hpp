@@ -0,0 +1,63 @@
+#ifndef GAMEARENA_HPP
+#define GAMEARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Deleter for objects placed in a GameArena: it only runs the destructor,
+// the memory itself goes back when the arena is released.
+struct ArenaDelete {
+    template <typename T>
+    void operator()(T* object) const {
+        if (object) object->~T();
+    }
+};
+
+template <typename T>
+using ArenaPtr = std::unique_ptr<T, ArenaDelete>;
+
+// One monotonic arena per game. Everything carved from it must be gone
+// (or owned by the arena through create()) before reset() or destruction.
+class GameArena {
+private:
+    std::pmr::monotonic_buffer_resource buffer;
+    std::vector<std::pair<void*, void (*)(void*)>> ownedObjects;
+
+public:
+    static const std::size_t DEFAULT_SIZE = 64 * 1024;
+
+    explicit GameArena(std::size_t initialSize = DEFAULT_SIZE);
+    ~GameArena();
+
+    GameArena(const GameArena&) = delete;
+    GameArena& operator=(const GameArena&) = delete;
+
+    std::pmr::memory_resource* resource();
+    void reset();
+
+    template <typename T, typename... Args>
+    ArenaPtr<T> makeUnique(Args&&... args) {
+        void* memory = buffer.allocate(sizeof(T), alignof(T));
+        return ArenaPtr<T>(new (memory) T(std::forward<Args>(args)...));
+    }
+
+    template <typename T, typename... Args>
+    std::shared_ptr<T> makeShared(Args&&... args) {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(&buffer), std::forward<Args>(args)...);
+    }
+
+    // The arena owns the object and destroys it on reset()
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        void* memory = buffer.allocate(sizeof(T), alignof(T));
+        T* object = new (memory) T(std::forward<Args>(args)...);
+        ownedObjects.emplace_back(object, [](void* p) { static_cast<T*>(p)->~T(); });
+        return object;
+    }
+};
+
+#endif
@@ -0,0 +1,282 @@
+#include "gameengine.hpp"
+#include "map.hpp"
+#include "item.hpp"
+#include "villagermanager.hpp"
+#include "terrorteracker.hpp"
+#include "taskboard.hpp"
+#include "monstermanager.hpp"
+#include "perkdeck.hpp"
+#include "frenzymarker.hpp"
+#include "dracula.hpp"
+#include "invisibleman.hpp"
+#include "rules.hpp"
+#include "alloctracker.hpp"
+#include <exception>
+#include <stdexcept>
+
+using namespace std;
+
+GameAction GameAction::move(shared_ptr<Location> destination, bool withVillagers) {
+    GameAction action(GameActionType::Move);
+    action.destination = std::move(destination);
+    action.withVillagers = withVillagers;
+    return action;
+}
+
+GameAction GameAction::guide(shared_ptr<Villager> villager, shared_ptr<Location> destination) {
+    GameAction action(GameActionType::Guide);
+    action.villager = std::move(villager);
+    action.destination = std::move(destination);
+    return action;
+}
+
+GameAction GameAction::pickUp(vector<Item> items) {
+    GameAction action(GameActionType::PickUp);
+    action.items = std::move(items);
+    return action;
+}
+
+GameAction GameAction::advance(size_t itemIndex, bool useAbility) {
+    GameAction action(GameActionType::Advance);
+    action.index = itemIndex;
+    action.useAbility = useAbility;
+    return action;
+}
+
+GameAction GameAction::defeat(size_t itemIndex, bool useAbility) {
+    GameAction action(GameActionType::Defeat);
+    action.index = itemIndex;
+    action.useAbility = useAbility;
+    return action;
+}
+
+GameAction GameAction::specialAction(shared_ptr<Location> location, vector<Item> items) {
+    GameAction action(GameActionType::SpecialAction);
+    action.destination = std::move(location);
+    action.items = std::move(items);
+    return action;
+}
+
+GameAction GameAction::usePerk(size_t index, shared_ptr<Location> target) {
+    GameAction action(GameActionType::UsePerk);
+    action.index = index;
+    action.destination = std::move(target);
+    return action;
+}
+
+GameAction GameAction::decide(int choice) {
+    GameAction action(GameActionType::Decide);
+    action.choice = choice;
+    return action;
+}
+
+GameEngine::GameEngine(const GameTable& table) : table(table) {}
+
+void GameEngine::setTable(const GameTable& table) {
+    this->table = table;
+}
+
+void GameEngine::setEventSink(GameEventSink* sink) {
+    eventSink = sink;
+}
+
+void GameEngine::start(Hero* firstHero, Hero* secondHero, int turn) {
+    currentHero = firstHero;
+    otherHero = secondHero;
+    this->turn = turn;
+    phase = TurnPhase::Hero;
+    outcome = GameOutcome::None;
+    diceResults.clear();
+    monsterPhase = {};
+    checkOutcome();
+}
+
+void GameEngine::submitAction(const GameAction& action) {
+    if (phase == TurnPhase::Over) {
+        throw invalid_argument("The game is over.");
+    }
+
+    switch (action.type) {
+        case GameActionType::EndTurn:
+            if (phase != TurnPhase::Hero) {
+                throw invalid_argument("The monster phase has already been played.");
+            }
+            runMonsterPhase();
+            break;
+        case GameActionType::Decide:
+            if (!getPendingDecision()) {
+                throw invalid_argument("There is no decision to answer.");
+            }
+            answerDecision(action.choice);
+            break;
+        case GameActionType::NextTurn:
+            if (phase != TurnPhase::Monster) {
+                throw invalid_argument("End the hero phase first.");
+            }
+            if (getPendingDecision()) {
+                throw invalid_argument("Answer the pending decision first.");
+            }
+            startNextTurn();
+            break;
+        default:
+            if (phase != TurnPhase::Hero) {
+                throw invalid_argument("Heroes can only act in the hero phase.");
+            }
+            applyHeroAction(action);
+            break;
+    }
+}
+
+void GameEngine::applyHeroAction(const GameAction& action) {
+    switch (action.type) {
+        case GameActionType::Move:
+            currentHero->move(action.destination, *table.villagerManager, table.perkDeck, action.withVillagers);
+            break;
+        case GameActionType::Guide:
+            currentHero->guide(*table.villagerManager, action.villager, action.destination, table.perkDeck);
+            break;
+        case GameActionType::PickUp:
+            currentHero->pickUp(action.items);
+            break;
+        case GameActionType::Advance:
+            currentHero->advance(getDracula(), getInvisibleMan(), *table.taskBoard, action.index, action.useAbility);
+            break;
+        case GameActionType::Defeat:
+            currentHero->defeat(getDracula(), *table.taskBoard, action.index, action.useAbility);
+            retireDefeatedMonsters();
+            break;
+        case GameActionType::SpecialAction:
+            currentHero->setOtherHero(otherHero);
+            currentHero->specialAction(action.destination, action.items);
+            break;
+        case GameActionType::UsePerk:
+            currentHero->usePerkCard(action.index, *table.map, *table.villagerManager, table.perkDeck,
+                                     getInvisibleMan(), table.itemBag, otherHero, getDracula(), action.destination);
+            break;
+        default:
+            break;
+    }
+    checkOutcome();
+}
+
+void GameEngine::runMonsterPhase() {
+    phase = TurnPhase::Monster;
+    diceResults.clear();
+
+    if (currentHero->shouldSkipNextMonsterPhase()) {
+        currentHero->setSkipNextMonsterPhase(false);
+        publishEvent(GameEventType::MonsterPhaseSkipped, currentHero->getHeroName());
+    } else {
+        AllocPhaseScope allocScope(AllocPhase::MonsterPhase);
+        table.monsterManager->setEventSink(eventSink);
+        monsterPhase = table.monsterManager->MonsterPhase(*table.map, *table.itemBag, getDracula(), getInvisibleMan(),
+                                                          *table.frenzyMarker, currentHero, *table.terrorTracker,
+                                                          HeroRoster(currentHero, otherHero), *table.villagerManager,
+                                                          diceResults, table.perkDeck, currentHero, otherHero);
+        monsterPhase.start();
+        if (!monsterPhase.done()) return;
+    }
+    finishMonsterPhase();
+}
+
+void GameEngine::answerDecision(int choice) {
+    AllocPhaseScope allocScope(AllocPhase::MonsterPhase);
+    monsterPhase.resume(choice);
+    if (monsterPhase.done()) {
+        finishMonsterPhase();
+    }
+}
+
+void GameEngine::finishMonsterPhase() {
+    exception_ptr error;
+    if (monsterPhase) {
+        DecisionTask<void> finished = std::move(monsterPhase);
+        try {
+            finished.result();
+        } catch (...) {
+            error = current_exception();
+        }
+    }
+
+    // A phase that failed still ends the game if it drew the last card
+    checkOutcome();
+    bool bothDefeated = table.taskBoard->isDraculaDefeated() && table.taskBoard->isInvisibleManDefeated();
+    if (phase != TurnPhase::Over && table.monsterManager->isEmpty() && !bothDefeated) {
+        endGame(GameOutcome::DeckEmpty);
+    }
+
+    // Then rethrows whatever stopped the monster phase
+    if (error) {
+        rethrow_exception(error);
+    }
+}
+
+void GameEngine::startNextTurn() {
+    currentHero->resetActions();
+    otherHero->resetActions();
+    swap(currentHero, otherHero);
+    ++turn;
+    phase = TurnPhase::Hero;
+    checkOutcome();
+}
+
+void GameEngine::retireDefeatedMonsters() {
+    if (table.taskBoard->isDraculaDefeated()) {
+        retireMonster(*table.dracula);
+    }
+    if (table.taskBoard->isInvisibleManDefeated()) {
+        retireMonster(*table.invisibleMan);
+    }
+    checkOutcome();
+}
+
+void GameEngine::retireMonster(ArenaPtr<Monster>& monster) {
+    if (!monster) return;
+    string name = monster->getMonsterName();
+    if (monster->isOnBoard()) {
+        monster->getCurrentLocation()->tryRemoveCharacter(name);
+    }
+    monster->setCurrentLocation(nullptr);
+    monster.reset();
+    // The frenzy marker moves on to a monster still on the board
+    table.frenzyMarker->advance(table.dracula->get(), table.invisibleMan->get());
+    publishEvent(GameEventType::MonsterDefeated, name);
+}
+
+void GameEngine::checkOutcome() {
+    if (phase == TurnPhase::Over) return;
+    if (table.taskBoard->isDraculaDefeated() && table.taskBoard->isInvisibleManDefeated()) {
+        endGame(GameOutcome::HeroesWin);
+    } else if (table.terrorTracker->getLevel() >= Rules::TERROR_LIMIT) {
+        endGame(GameOutcome::Terror);
+    }
+}
+
+void GameEngine::endGame(GameOutcome result) {
+    outcome = result;
+    phase = TurnPhase::Over;
+}
+
+const char* GameEngine::getOutcomeName(GameOutcome outcome) {
+    switch (outcome) {
+        case GameOutcome::HeroesWin: return "heroes-win";
+        case GameOutcome::Terror: return "terror";
+        case GameOutcome::DeckEmpty: return "deck-empty";
+        case GameOutcome::None: break;
+    }
+    return "";
+}
+
+Dracula* GameEngine::getDracula() const {
+    return table.dracula ? static_cast<Dracula*>(table.dracula->get()) : nullptr;
+}
+
+InvisibleMan* GameEngine::getInvisibleMan() const {
+    return table.invisibleMan ? static_cast<InvisibleMan*>(table.invisibleMan->get()) : nullptr;
+}
+
+void GameEngine::publishEvent(GameEventType type, const string& actor, const string& detail) {
+    if (eventSink) {
+        eventSink->publish({type, actor, "", "", detail});
+    }
+}
@@ -0,0 +1,136 @@
+#ifndef GAMEENGINE_HPP
+#define GAMEENGINE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "gamearena.hpp"
+#include "gameevents.hpp"
+#include "decision.hpp"
+#include "hero.hpp"
+#include "monster.hpp"
+
+class Map;
+class ItemBag;
+class VillagerManager;
+class TerrorTracker;
+class TaskBoard;
+class MonsterManager;
+class PerkDeck;
+class FrenzyMarker;
+class Dracula;
+class InvisibleMan;
+
+enum class TurnPhase {
+    Hero,       // the current hero takes actions until EndTurn
+    Monster,    // the monster phase, possibly waiting on a Decision; then NextTurn moves on
+    Over
+};
+
+enum class GameOutcome { None, HeroesWin, Terror, DeckEmpty };
+
+enum class GameActionType { Move, Guide, PickUp, Advance, Defeat, SpecialAction, UsePerk, EndTurn, Decide, NextTurn };
+
+// A player's action with the choices the front end asked for
+struct GameAction {
+    GameActionType type = GameActionType::EndTurn;
+    std::shared_ptr<Location> destination;  // Move, Guide; UsePerk: where the Detective puts the Invisible man;
+                                            // SpecialAction: where the Archeologist takes items from
+    std::shared_ptr<Villager> villager;     // Guide
+    std::vector<Item> items;                // PickUp, SpecialAction: the items taken
+    std::size_t index = 0;                  // UsePerk: perk card index; Advance, Defeat: hero item index
+    bool withVillagers = false;             // Move: the villagers here come along
+    bool useAbility = false;                // Advance, Defeat: the Scientist's ability
+    int choice = Decision::DECLINE;         // Decide: index into the pending decision's options
+
+    GameAction() = default;
+    // For the actions that take no parameters
+    explicit GameAction(GameActionType type) : type(type) {}
+
+    static GameAction move(std::shared_ptr<Location> destination, bool withVillagers = false);
+    static GameAction guide(std::shared_ptr<Villager> villager, std::shared_ptr<Location> destination);
+    static GameAction pickUp(std::vector<Item> items);
+    static GameAction advance(std::size_t itemIndex, bool useAbility = false);
+    static GameAction defeat(std::size_t itemIndex, bool useAbility = false);
+    static GameAction specialAction(std::shared_ptr<Location> location = nullptr, std::vector<Item> items = {});
+    static GameAction usePerk(std::size_t index, std::shared_ptr<Location> target = nullptr);
+    static GameAction decide(int choice);
+};
+
+// The pieces of a running game. The front end owns them; the engine only
+// drives them. Monsters are held by reference so a defeated one can be freed.
+struct GameTable {
+    Map* map = nullptr;
+    ItemBag* itemBag = nullptr;
+    VillagerManager* villagerManager = nullptr;
+    TerrorTracker* terrorTracker = nullptr;
+    TaskBoard* taskBoard = nullptr;
+    MonsterManager* monsterManager = nullptr;
+    PerkDeck* perkDeck = nullptr;
+    FrenzyMarker* frenzyMarker = nullptr;
+    ArenaPtr<Monster>* dracula = nullptr;
+    ArenaPtr<Monster>* invisibleMan = nullptr;
+};
+
+// The turn flow and end-of-game rules, shared by the terminal game and the
+// GUI. Front ends turn player input into GameActions and show the results;
+// what happens on the board is published to the event sink.
+class GameEngine {
+public:
+    GameEngine() = default;
+    explicit GameEngine(const GameTable& table);
+
+    void setTable(const GameTable& table);
+    // Also used for the monster phase; may be null
+    void setEventSink(GameEventSink* sink);
+    void start(Hero* firstHero, Hero* secondHero, int turn = 1);
+
+    // Hero actions are only allowed in the hero phase and throw invalid_argument
+    // like the Hero calls they forward to. EndTurn runs the monster phase until
+    // it ends or waits on a Decision; Decide answers it and carries on.
+    // NextTurn hands play to the other hero. All but Decide may end the game.
+    void submitAction(const GameAction& action);
+
+    const GameTable& getTable() const { return table; }
+    TurnPhase getPhase() const { return phase; }
+    GameOutcome getOutcome() const { return outcome; }
+    bool isOver() const { return phase == TurnPhase::Over; }
+    // "heroes-win", "terror" or "deck-empty"; empty while the game runs
+    static const char* getOutcomeName(GameOutcome outcome);
+
+    Hero* getCurrentHero() const { return currentHero; }
+    Hero* getOtherHero() const { return otherHero; }
+    int getTurn() const { return turn; }
+    Dracula* getDracula() const;
+    InvisibleMan* getInvisibleMan() const;
+    // What the monster phase is waiting on, or null
+    const Decision* getPendingDecision() const { return monsterPhase.pendingDecision(); }
+    // Faces rolled in the last monster phase
+    const std::vector<std::string>& getDiceResults() const { return diceResults; }
+
+private:
+    GameTable table;
+    GameEventSink* eventSink = nullptr;
+    Hero* currentHero = nullptr;
+    Hero* otherHero = nullptr;
+    int turn = 1;
+    TurnPhase phase = TurnPhase::Hero;
+    GameOutcome outcome = GameOutcome::None;
+    std::vector<std::string> diceResults;
+    DecisionTask<void> monsterPhase;
+
+    void applyHeroAction(const GameAction& action);
+    void runMonsterPhase();
+    void answerDecision(int choice);
+    void finishMonsterPhase();
+    void startNextTurn();
+    void retireMonster(ArenaPtr<Monster>& monster);
+    // Takes defeated monsters off the board and checks whether the heroes have won
+    void retireDefeatedMonsters();
+    void checkOutcome();
+    void endGame(GameOutcome result);
+    void publishEvent(GameEventType type, const std::string& actor, const std::string& detail = "");
+};
+
+#endif
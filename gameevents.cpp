@@ -0,0 +1,63 @@
+#include "gameevents.hpp"
+#include <thread>
+
+using namespace std;
+
+string GameEvent::describe() const {
+    switch (type) {
+        case GameEventType::CardDrawn:
+            return "Monster card drawn: " + detail;
+        case GameEventType::ItemPlaced:
+            return target + " was placed in " + location + ".";
+        case GameEventType::VillagerPlaced:
+            return actor + " was placed in " + location + "!";
+        case GameEventType::MonsterMoved:
+            return actor + " moved to " + location + ".";
+        case GameEventType::FrenzyChanged:
+            return actor.empty() ? "No monster is frenzied." : "Frenzy marker given to " + actor + "!";
+        case GameEventType::DiceRolled:
+            return actor + " rolled " + detail;
+        case GameEventType::MonsterPower:
+            return target.empty() ? actor + " used its power at " + location + "!"
+                                  : actor + " pulled " + target + " to " + location + "!";
+        case GameEventType::MonsterAttack:
+            return actor + " is attacking " + target + "!";
+        case GameEventType::DefenseRequested:
+            return target + " is under attack by " + actor + "!";
+        case GameEventType::HeroDefended:
+            return target + " used a " + detail + " to fend off " + actor + "!";
+        case GameEventType::HeroHospitalized:
+            return target + " was sent to the Hospital!";
+        case GameEventType::VillagerKilled:
+            return target + " was killed by " + actor + "!";
+        case GameEventType::VillagerRescued:
+            return target + " has reached their safe place and left the game!";
+        case GameEventType::ItemsStolen:
+            return actor + " stole " + detail + " items from " + location + "!";
+        case GameEventType::MonsterPhaseSkipped:
+            return "Monster phase skipped due to Break of Dawn perk card!";
+        case GameEventType::MonsterDefeated:
+            return actor + " has been defeated!";
+    }
+    return "";
+}
+
+void GameEventBus::subscribe(Handler handler) {
+    handlers.push_back(move(handler));
+}
+
+void GameEventBus::publish(const GameEvent& event) {
+    for (const auto& handler : handlers) {
+        handler(event);
+    }
+}
+
+void QueuedEventSink::publish(const GameEvent& event) {
+    while (!queue.push(event)) {
+        this_thread::yield();
+    }
+}
+
+bool QueuedEventSink::tryPop(GameEvent& event) {
+    return queue.pop(event);
+}
@@ -0,0 +1,74 @@
+#ifndef GAMEEVENTS_HPP
+#define GAMEEVENTS_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "spscqueue.hpp"
+
+enum class GameEventType {
+    CardDrawn,          // detail = card name
+    ItemPlaced,         // target = item, location
+    VillagerPlaced,     // actor = villager, location
+    MonsterMoved,       // actor = monster, location = destination
+    FrenzyChanged,      // actor = frenzied monster (empty for none)
+    DiceRolled,         // actor = monster, detail = faces, e.g. "[*] [!] [ ]"
+    MonsterPower,       // actor = monster, target = pulled hero (if any), location
+    MonsterAttack,      // actor = monster, target = hero or villager, location
+    DefenseRequested,   // actor = monster, target = hero; the engine then waits on a Decision
+    HeroDefended,       // actor = monster, target = hero, location, detail = item used
+    HeroHospitalized,   // target = hero
+    VillagerKilled,     // actor = monster, target = villager, location
+    VillagerRescued,    // target = villager, location = safe place
+    ItemsStolen,        // actor = monster, location, detail = item count
+    MonsterPhaseSkipped, // actor = hero whose perk skipped it
+    MonsterDefeated      // actor = monster, now off the board
+};
+
+// One thing that happened on the board, in the order it happened.
+// Only names are carried, so an event stays valid after the state changes.
+struct GameEvent {
+    GameEventType type = GameEventType::CardDrawn;
+    std::string actor;
+    std::string target;
+    std::string location;
+    std::string detail;
+
+    // Player-facing sentence, shared by the frontends
+    std::string describe() const;
+};
+
+class GameEventSink {
+public:
+    virtual ~GameEventSink() = default;
+    virtual void publish(const GameEvent& event) = 0;
+};
+
+// Calls every subscriber in turn, on the publishing thread.
+// Frontends subscribe here instead of diffing the board before and after a turn.
+class GameEventBus : public GameEventSink {
+public:
+    using Handler = std::function<void(const GameEvent&)>;
+
+    void subscribe(Handler handler);
+    void publish(const GameEvent& event) override;
+
+private:
+    std::vector<Handler> handlers;
+};
+
+// Hands events from the engine thread to the UI thread without locking.
+// publish() waits for room if the UI falls behind, so no event is dropped.
+class QueuedEventSink : public GameEventSink {
+public:
+    static const std::size_t CAPACITY = 256;
+
+    void publish(const GameEvent& event) override;
+    bool tryPop(GameEvent& event);
+    bool empty() const { return queue.empty(); }
+
+private:
+    SpscQueue<GameEvent, CAPACITY> queue;
+};
+
+#endif
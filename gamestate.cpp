@@ -10,6 +10,7 @@
 #include "frenzymarker.hpp"
 #include "perkcard.hpp"
 #include "monstercard.hpp"
+#include "alloctracker.hpp"
 #include <iostream>
 #include <fstream>
 #include <chrono>
@@ -27,6 +28,7 @@ GameState::GameState() : saveVersion(1) {
 }
 
 void GameState::saveToFile(const string& filename) {
+    AllocPhaseScope allocScope(AllocPhase::Save);
     ofstream file(filename, ios::binary);
     if (!file.is_open()) {
         throw runtime_error("Could not open file for writing: " + filename);
@@ -314,6 +316,7 @@ void GameState::saveToFile(const string& filename) {
 }
 
 bool GameState::loadFromFile(const string& filename) {
+    AllocPhaseScope allocScope(AllocPhase::Save);
     ifstream file(filename, ios::binary);
     if (!file.is_open()) {
         return false;
@@ -746,10 +749,11 @@ void GameState::setMonsterState(const Monster* monster, bool isDracula) {
 void GameState::setVillagerStates(const VillagerManager& villagerManager) {
     villagerStates.clear();
     const auto& villagers = villagerManager.getAllVillagers();
-    for (const auto& [name, villager] : villagers) {
+    for (const auto& villager : villagers) {
+        if (!villager) continue;
         VillagerState state;
-        state.villagerName = name;
-        if (villager && villager->getCurrentLocation()) {
+        state.villagerName = villager->getVillagerName();
+        if (villager->getCurrentLocation()) {
             state.currentLocationName = villager->getCurrentLocation()->getName();
         } else {
             state.currentLocationName = "";
@@ -67,7 +67,9 @@ private:
     std::string secondPlayerHero;
     bool heroSelectionComplete = false;
     
+    AssetArchive assetArchive;  // optional packed assets; declared first so it outlives the game screen
     std::unique_ptr<GameScreen> gameScreen;
+    std::unique_ptr<FramePacer> framePacer;
     
     std::string nameError = "";
     std::string garlicError = "";
@@ -77,7 +79,8 @@ private:
 public:
     GraphicalMainMenu() {
         InitWindow(screenWidth, screenHeight, "Horrified");
-        SetTargetFPS(60);
+        framePacer = std::make_unique<FramePacer>();
+        assetArchive.open(getAssetPath(AssetArchive::DEFAULT_FILE));
         
         buttonWidth = screenWidth * 0.2; 
         buttonHeight = screenHeight * 0.06;  
@@ -89,8 +92,8 @@ public:
         int titleFontSize = screenHeight * 0.08;  
         int menuFontSize = screenHeight * 0.025;  
         
-        titleFont = LoadFontEx(titleFontPath.c_str(), titleFontSize, 0, 0);
-        menuFont = LoadFontEx(menuFontPath.c_str(), menuFontSize, 0, 0);
+        titleFont = loadFont("fonts/Creepster-Regular.ttf", titleFontSize);
+        menuFont = loadFont("fonts/Rubik-Regular.ttf", menuFontSize);
         
         if (titleFont.texture.id == 0) {
             std::cout << "Failed to load title font: " << titleFontPath << std::endl;
@@ -106,7 +109,12 @@ public:
         }
         
         std::string backgroundPath = getAssetPath("images/background.jpg");
-        if (FileExists(backgroundPath.c_str())) {
+        Image packedBackground{};
+        if (assetArchive.findImage("images/background.jpg", packedBackground)) {
+            backgroundTexture = LoadTextureFromImage(packedBackground);
+            backgroundLoaded = true;
+            std::cout << "Background image loaded from asset archive" << std::endl;
+        } else if (FileExists(backgroundPath.c_str())) {
             backgroundTexture = LoadTexture(backgroundPath.c_str());
             backgroundLoaded = true;
             std::cout << "Background image loaded successfully from: " << backgroundPath << std::endl;
@@ -160,19 +168,16 @@ public:
     }
     
     std::string getAssetPath(const std::string& relativePath) {
-        std::vector<std::string> possiblePaths = {
-            relativePath,                  
-            "../" + relativePath,           
-            "../../" + relativePath,     
-            "./" + relativePath           
-        };
-        
-        for (const auto& path : possiblePaths) {
-            if (FileExists(path.c_str())) {
-                return path;
-            }
+        return AssetLoader::resolvePath(relativePath);
+    }
+    
+    Font loadFont(const std::string& relativePath, int fontSize) {
+        size_t fileSize = 0;
+        const unsigned char* fileData = assetArchive.findFile(relativePath, fileSize);
+        if (fileData != nullptr) {
+            return LoadFontFromMemory(".ttf", fileData, (int)fileSize, fontSize, 0, 0);
         }
-        return relativePath; 
+        return LoadFontEx(getAssetPath(relativePath).c_str(), fontSize, 0, 0);
     }
     
     bool validateGarlicTime(const std::string& garlicTime) {
@@ -528,7 +533,8 @@ public:
                     gamePlayers.push_back(PlayerInfo(p1Name, startPlayer == p1Name ? startHero : otherHero, std::to_string(p1Garlic)));
                     gamePlayers.push_back(PlayerInfo(p2Name, startPlayer == p2Name ? startHero : otherHero, std::to_string(p2Garlic)));
 
-                    gameScreen = std::make_unique<GameScreen>(gamePlayers, startPlayer, screenWidth, screenHeight);
+                    gameScreen = std::make_unique<GameScreen>(gamePlayers, startPlayer, screenWidth, screenHeight, &assetArchive);
+                    gameScreen->setFramePacer(framePacer.get());
                     gameScreen->run();
                     gameScreen->restoreFromGameState(loaded);
                     currentState = GAME_SCREEN;
@@ -655,7 +661,8 @@ public:
             gamePlayers.push_back(gamePlayer);
         }
         
-        gameScreen = std::make_unique<GameScreen>(gamePlayers, startingPlayerName, screenWidth, screenHeight);
+        gameScreen = std::make_unique<GameScreen>(gamePlayers, startingPlayerName, screenWidth, screenHeight, &assetArchive);
+        gameScreen->setFramePacer(framePacer.get());
         gameScreen->run();
         
         currentState = GAME_SCREEN;
@@ -664,6 +671,7 @@ public:
     void run() {
         while (!WindowShouldClose()) {
             BeginDrawing();
+            bool busy = false;
             
             switch (currentState) {
                 case MAIN_MENU:
@@ -693,6 +701,7 @@ public:
                         gameScreen->handleInput();
                         gameScreen->updateGame();
                         gameScreen->draw();
+                        busy = gameScreen->isBusy();
                         
                         if (gameScreen->shouldReturnToMenu()) {
                             gameScreen.reset();
@@ -705,6 +714,7 @@ public:
                     return;
             }
             
+            framePacer->endFrame(busy);
             EndDrawing();
         }
     }
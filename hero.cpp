@@ -1,8 +1,14 @@
 #include "hero.hpp"
+#include "archeologist.hpp"
+#include "mayor.hpp"
+#include "courier.hpp"
+#include "scientist.hpp"
 #include "villagermanager.hpp"
 #include "perkdeck.hpp"
 #include "invisibleman.hpp"
 #include "dracula.hpp"
+#include "alloctracker.hpp"
+#include "rules.hpp"
 #include <iostream>
 #include <stdexcept>
 #include <algorithm>
@@ -36,9 +42,11 @@ string toSentenceCase(string name) {
     return name;
 }
 
-Hero::Hero(const string& playerName, const string& heroName, int maxActions, shared_ptr<Location> startingLocation) {
+static const char* const HERO_KIND_NAMES[HERO_KIND_COUNT] = {"Archeologist", "Mayor", "Courier", "Scientist"};
+
+Hero::Hero(const string& playerName, HeroKind kind, int maxActions, shared_ptr<Location> startingLocation) : kind(kind) {
     setPlayerName(playerName);
-    setHeroName(heroName);
+    setHeroName(getKindName(kind));
     setMaxActions(maxActions);
     setRemainingActions(maxActions);
     setCurrentLocation(startingLocation);
@@ -46,6 +54,45 @@ Hero::Hero(const string& playerName, const string& heroName, int maxActions, sha
     currentLocation->addCharacter(heroName);
 }
 
+const char* Hero::getKindName(HeroKind kind) {
+    return HERO_KIND_NAMES[static_cast<size_t>(kind)];
+}
+
+bool Hero::getKindByName(const string& characterName, HeroKind& kind) {
+    for (size_t i = 0; i < HERO_KIND_COUNT; ++i) {
+        if (characterName == HERO_KIND_NAMES[i]) {
+            kind = static_cast<HeroKind>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void Hero::specialAction(shared_ptr<Location> location, const vector<Item>& chosenItems) {
+    switch (kind) {
+        case HeroKind::Archeologist: static_cast<Archeologist*>(this)->specialAction(location, chosenItems); break;
+        case HeroKind::Mayor: static_cast<Mayor*>(this)->specialAction(); break;
+        case HeroKind::Courier: static_cast<Courier*>(this)->specialAction(); break;
+        case HeroKind::Scientist: static_cast<Scientist*>(this)->specialAction(); break;
+    }
+}
+
+void Hero::ability(size_t index) {
+    switch (kind) {
+        case HeroKind::Archeologist: static_cast<Archeologist*>(this)->ability(index); break;
+        case HeroKind::Mayor: static_cast<Mayor*>(this)->ability(index); break;
+        case HeroKind::Courier: static_cast<Courier*>(this)->ability(index); break;
+        case HeroKind::Scientist: static_cast<Scientist*>(this)->ability(index); break;
+    }
+}
+
+void Hero::setOtherHero(Hero* otherHero) {
+    // Only the Courier's special action needs the other hero
+    if (kind == HeroKind::Courier) {
+        static_cast<Courier*>(this)->setOtherHero(otherHero);
+    }
+}
+
 void Hero::setHeroName(string heroName) {
     this->heroName = heroName;
 }
@@ -97,65 +144,41 @@ vector<Item> Hero::getItems() const {
     return items;
 }
 
-void Hero::move(shared_ptr<Location> newLocation, VillagerManager& villagerManager, PerkDeck* perkDeck) {
+void Hero::checkMove(const shared_ptr<Location>& newLocation) const {
     if (remainingActions <= 0) {
         throw invalid_argument("No remaining actions.");
     }
 
-    if (currentLocation == newLocation) {
-        throw invalid_argument(playerName + " (" + heroName + ") is already in " + currentLocation->getName());
+    if (!newLocation) {
+        throw invalid_argument("There is no such location.");
     }
 
-    if (!newLocation) {
-        throw invalid_argument("There is no location called " + newLocation->getName());
+    if (currentLocation == newLocation) {
+        throw invalid_argument(playerName + " (" + heroName + ") is already in " + currentLocation->getName());
     }
 
     const auto& neighbors = currentLocation->getNeighbors();
-
-    bool isNeighbor = false;
-    for (const auto& neighbor : neighbors) {
-        if (neighbor && neighbor->getName() == newLocation->getName()) {
-            isNeighbor = true;
-            break;
-        }
-    }
-    if (!isNeighbor) {
+    if (find(neighbors.begin(), neighbors.end(), newLocation) == neighbors.end()) {
         throw invalid_argument(playerName + " (" + heroName + ") can't move to " + newLocation->getName() + " - not a neighbor.");
     }
+}
 
-    auto characters = currentLocation->getCharacters();
-    bool characterExists = false;
-    if (!characters.empty()) {
-        for (const auto& character : characters) {
-            if (character == "Archeologist" || character == "Mayor" || character == "Scientist" || character == "Courier" || character == "Dracula" || character == "Invisible man") {
-                continue;
-            }
-            characterExists = true;
-        }
-    }
-    
-    string answer;
-    if (characterExists) {
-        while (true) {
-            cout << "Do you want to move villager(s) with yourself(Yes or No)? ";
-            getline(cin, answer);
-            answer = toSentenceCase(answer);
-            if (answer == "No") break;
-            if (answer == "Yes") {
-                for (const auto& character : characters) {
-                    if (character == "Archeologist" || character == "Mayor" || character == "Scientist" || character == "Courier" || character == "Dracula" || character == "Invisible man") {
-                        continue;
-                    }
-                    try {
-                        auto villager = villagerManager.getVillager(character);
-                        villager->move(newLocation, this, perkDeck);
-                    } catch (const exception& e) {
-                        cout << e.what() << endl;
-                    }
-                }
-                break;
+void Hero::move(shared_ptr<Location> newLocation, VillagerManager& villagerManager, PerkDeck* perkDeck, bool withVillagers) {
+    AllocPhaseScope allocScope(AllocPhase::HeroAction);
+    checkMove(newLocation);
+
+    if (withVillagers) {
+        // Copied, the villagers leave the location as they move
+        Location::VillagerSet present = currentLocation->getVillagers();
+        const auto& villagers = villagerManager.getAllVillagers();
+        for (size_t id = 0; id < villagers.size(); ++id) {
+            if (!present.test(id) || !villagers[id]) continue;
+            try {
+                villagers[id]->move(newLocation, this, perkDeck);
+                villagerManager.refreshVillager(villagers[id]->getVillagerName());
+            } catch (const exception& e) {
+                cout << e.what() << endl;
             }
-            cout << "Invalid answer. Please try again" << endl;
         }
     }
 
@@ -172,172 +195,74 @@ void Hero::move(shared_ptr<Location> newLocation, VillagerManager& villagerManag
     remainingActions--;
 }
 
-void Hero::guide(VillagerManager& villagerManager, Map& map, PerkDeck* perkDeck) {
+void Hero::guide(VillagerManager& villagerManager, shared_ptr<Villager> villager, shared_ptr<Location> destination, PerkDeck* perkDeck) {
+    AllocPhaseScope allocScope(AllocPhase::HeroAction);
     if (remainingActions <= 0) {
         throw invalid_argument("No remaining actions.");
     }
 
-    vector<shared_ptr<Villager>> guidableVillagers;
-    vector<vector<shared_ptr<Location>>> guidableMoves;
-    auto heroLoc = currentLocation;
-    const auto& heroNeighbors = heroLoc->getNeighbors();
-
-    for (const auto& locPair : map.locations) {
-        auto loc = locPair.second;
-        const auto& characters = loc->getCharacters();
-        for (const auto& character : characters) {
-            if (character == "Archeologist" || character == "Mayor" || character == "Scientist" || character == "Courier" || character == "Dracula" || character == "Invisible man") continue;
-
-            vector<shared_ptr<Location>> possibleMoves;
-
-            if (loc->getName() == heroLoc->getName()) {
-                for (const auto& neighbor : heroNeighbors) {
-                    possibleMoves.push_back(neighbor);
-                }
-            } else {
-                const auto& vNeighbors = loc->getNeighbors();
-                for (const auto& vNeighbor : vNeighbors) {
-                    if (vNeighbor->getName() == heroLoc->getName()) {
-                        possibleMoves.push_back(heroLoc);
-                        break;
-                    }
-                }
-            }
-
-            if (!possibleMoves.empty()) {
-                try {
-                    auto villager = villagerManager.getVillager(character);
-                    guidableVillagers.push_back(villager);
-                    guidableMoves.push_back(possibleMoves);
-                } catch (const exception& e) {
-                    cout << e.what() << endl;
-                }
-            }
-        }
-    }
-
-    if (guidableVillagers.empty()) {
-        cout << "There are no villagers on the map that you can guide right now.\n";
-        return;
-    }
-
-    cout << "Villagers you can guide:\n";
-    for (size_t i = 0; i < guidableVillagers.size(); ++i) {
-        cout << i + 1 << ". " << guidableVillagers[i]->getVillagerName()
-             << " (at " << guidableVillagers[i]->getCurrentLocation()->getName() << ")\n";
-    }
-
-    int villagerIndex;
-    while (true) {
-        cout << "Choose a villager to guide (1-" << guidableVillagers.size() << "): ";
-        cin >> villagerIndex;
-        if (cin.fail()) {
-            cout << "Invalid input. Please enter a number.\n";
-            cin.clear(); 
-            cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-            continue;
+    bool allowed = false;
+    for (const auto& option : getGuideOptions(villagerManager)) {
+        if (option.villager == villager &&
+            find(option.destinations.begin(), option.destinations.end(), destination) != option.destinations.end()) {
+            allowed = true;
         }
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        break;
     }
-
-    if (villagerIndex < 1 || villagerIndex > static_cast<int>(guidableVillagers.size())) {
-        cout << "Invalid choice.\n";
-        return;
+    if (!allowed) {
+        throw invalid_argument("You can't guide that villager there.");
     }
 
-    auto chosenVillager = guidableVillagers[villagerIndex - 1];
-    auto& possibleLocations = guidableMoves[villagerIndex - 1];
-    shared_ptr<Location> chosenLocation;
-
-    if (possibleLocations.size() == 1) {
-        chosenLocation = possibleLocations[0];
-    } else {
-        cout << "Where do you want to take " << chosenVillager->getVillagerName() << "?\n";
-        for (size_t i = 0; i < possibleLocations.size(); ++i) {
-            cout << i + 1 << ". " << possibleLocations[i]->getName() << "\n";
-        }
-        int locationIndex;
-        while (true) {
-            cout << "Choose location (1-" << possibleLocations.size() << "): ";
-            cin >> locationIndex;
-            if (cin.fail()) {
-                cout << "Invalid input. Please enter a number.\n";
-                cin.clear(); 
-                cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-                continue;
-            }
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            break;
-        }
-
-        if (locationIndex < 1 || locationIndex > static_cast<int>(possibleLocations.size())) {
-            cout << "Invalid choice.\n";
-            return;
-        }
+    villager->move(destination, this, perkDeck);
+    villagerManager.refreshVillager(villager->getVillagerName());
+    remainingActions--;
+}
 
-        chosenLocation = possibleLocations[locationIndex - 1];
-    }
+GuideOptions Hero::getGuideOptions(const VillagerManager& villagerManager) const {
+    GuideOptions options;
+    if (!currentLocation) return options;
 
-    try {
-        chosenVillager->move(chosenLocation, this, perkDeck);
-    } catch (const exception& e) {
-        cout << e.what() << endl;
-        return;
+    const auto& villagers = villagerManager.getAllVillagers();
+    const auto& neighbors = currentLocation->getNeighbors();
+    auto addOptions = [&](const Location& location, auto&& fillDestinations) {
+        const auto& present = location.getVillagers();
+        for (size_t id = 0; id < villagers.size(); ++id) {
+            if (!present.test(id) || !villagers[id]) continue;
+            GuideOption option;
+            option.villager = villagers[id];
+            fillDestinations(option);
+            options.push_back(std::move(option));
+        }
+    };
+
+    addOptions(*currentLocation, [&](GuideOption& option) {
+        for (const auto& neighbor : neighbors) option.destinations.push_back(neighbor);
+    });
+    for (const auto& neighbor : neighbors) {
+        if (!neighbor->hasVillagers()) continue;
+        addOptions(*neighbor, [&](GuideOption& option) { option.destinations.push_back(currentLocation); });
     }
-
-    remainingActions--;
+    return options;
 }
 
-void Hero::pickUp() {
+void Hero::pickUp(const vector<Item>& chosenItems) {
+    AllocPhaseScope allocScope(AllocPhase::HeroAction);
     if (remainingActions <= 0) {
         throw invalid_argument("No remaining actions.");
     }
 
-    const auto locationItems = currentLocation->getItems();
-    if (locationItems.empty()) {
+    if (currentLocation->getItems().empty()) {
         throw invalid_argument("No items to pick up in " + currentLocation->getName() + ".\n");
     }
-
-    cout << "Items in " << currentLocation->getName() << ":\n";
-    for (size_t i = 0; i < static_cast<int>(locationItems.size()); ++i) {
-        const auto& item = locationItems[i];
-        cout << i + 1 << ". " << item.getItemName() << " (" 
-             << Item::colorToString(item.getColor()) << ", Power: " 
-             << item.getPower() << ")\n";
-    }
-
-    int choice;
-    bool itemWasPickedUp = false;
-    int exitChoice = static_cast<int>(locationItems.size()) + 1;
-    while (true) {
-        cout << "Enter the number of the item to pick up (" << exitChoice << " to exit): ";
-        cin >> choice;
-        if (cin.fail()) {
-            cout << "Invalid input. Please enter a number.\n";
-            cin.clear(); 
-            cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-            continue;
-        }
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        
-        if (choice > exitChoice || choice <= 0) {
-            cout << "Invalid answer. Please try again." << endl;
-            continue;
-        }
-        else if (choice == exitChoice) {
-            break;
-        }
-        const auto& selectedItem = locationItems[choice - 1];
-        items.push_back(selectedItem);
-        currentLocation->removeItem(selectedItem);
-        cout << playerName << " (" << heroName << ") picked up " << selectedItem.getItemName() << ".\n";
-        itemWasPickedUp = true;
+    if (chosenItems.empty()) {
+        throw invalid_argument("Choose at least one item to pick up.");
     }
 
-    if (itemWasPickedUp) {
-        remainingActions--;
+    for (const auto& item : chosenItems) {
+        currentLocation->removeItem(item);
+        items.push_back(item);
+        cout << playerName << " (" << heroName << ") picked up " << item.getItemName() << ".\n";
     }
+    remainingActions--;
 }
 
 void Hero::addPerkCard(const PerkCard& card) {
@@ -348,7 +273,8 @@ const vector<PerkCard>& Hero::getPerkCards() const {
     return perkCards;
 }
 
-void Hero::usePerkCard(size_t index, Map& map, VillagerManager& villagerManager, PerkDeck* perkDeck, InvisibleMan* invisibleMan, ItemBag* itemBag, Hero* otherHero, Dracula* dracula) {
+void Hero::usePerkCard(size_t index, Map& map, VillagerManager& villagerManager, PerkDeck* perkDeck, InvisibleMan* invisibleMan, ItemBag* itemBag, Hero* otherHero, Dracula* dracula, shared_ptr<Location> target) {
+    AllocPhaseScope allocScope(AllocPhase::HeroAction);
     if (index >= perkCards.size()) {
         cout << "Invalid perk card index.\n";
         return;
@@ -356,39 +282,24 @@ void Hero::usePerkCard(size_t index, Map& map, VillagerManager& villagerManager,
 
     PerkCard card = perkCards[index];
     PerkType type = card.getType();
+    bool invisibleManOnBoard = invisibleMan != nullptr && invisibleMan->getCurrentLocation() != nullptr;
+    if (type == PerkType::VisitFromTheDetective && invisibleManOnBoard && !target) {
+        throw invalid_argument("Choose a location to place the Invisible Man.");
+    }
     
     cout << playerName << " (" << heroName << ") uses " << PerkCard::perkTypeToString(type) << "!\n";
     
     switch (type) {
         case PerkType::VisitFromTheDetective: {
-#ifndef TERMINAL
-            // In graphical mode, this will be handled by the UI
-            break;
-#else
-            cout << "Choose a location to place the Invisible Man: ";
-            string locationName;
-            getline(cin, locationName);
-            locationName = toSentenceCase(locationName);
-            
-            try {
-                auto targetLocation = map.getLocation(locationName);
-                
-                if (invisibleMan != nullptr) {
-                    auto currentLocation = invisibleMan->getCurrentLocation();
-                    currentLocation->removeCharacter("Invisible man");
-                    targetLocation->addCharacter("Invisible man");
-                    invisibleMan->setCurrentLocation(targetLocation);
-                    cout << "Invisible man moved to " << targetLocation->getName() << ".\n";
-                } else {
-                    cout << "Invisible man is defeated.\n";
-                    break;
-                }
-            } catch (const exception& e) {
-                cout << "Invalid location: " << e.what() << "\n";
-                return;
+            if (!invisibleManOnBoard) {
+                cout << "Invisible man is defeated.\n";
+                break;
             }
+            invisibleMan->getCurrentLocation()->removeCharacter("Invisible man");
+            target->addCharacter("Invisible man");
+            invisibleMan->setCurrentLocation(target);
+            cout << "Invisible man moved to " << target->getName() << ".\n";
             break;
-#endif
         }
         
         case PerkType::BreakOfDawn: {
@@ -481,247 +392,134 @@ void Hero::setSkipNextMonsterPhase(bool skip) {
     skipNextMonsterPhase = skip;
 }
 
-void Hero::advance(Dracula& dracula, InvisibleMan& invisibleMan, TaskBoard& taskBoard) {
-    if (remainingActions <= 0) {
-        throw invalid_argument("No remaining actions.");
-    }
-
+vector<size_t> Hero::getAdvanceOptions(Dracula* dracula, InvisibleMan* invisibleMan, const TaskBoard& taskBoard) const {
+    vector<size_t> options;
     if (currentLocation->getName() == "Precinct") {
-#ifndef TERMINAL
-        // In graphical mode, this will be handled by the UI
-        return;
-#else
-        if (invisibleMan.getCurrentLocation() == nullptr) {
-            cout << "Invisible man is defeated.\n";
-            return;
+        if (!invisibleMan || invisibleMan->getCurrentLocation() == nullptr) {
+            throw invalid_argument("Invisible man is defeated.");
         }
-        vector<string> clueLocations = {"Inn", "Barn", "Institute", "Laboratory", "Mansion"};
-        vector<pair<size_t, Item>> eligibleClues;
+        // Evidence from a clue location that hasn't been delivered yet
         for (size_t i = 0; i < items.size(); ++i) {
-            string itemLoc = items[i].getLocation() ? items[i].getLocation()->getName() : "";
-            for (const auto& clueLoc : clueLocations) {
-                if (itemLoc == clueLoc && !taskBoard.isClueDelivered(clueLoc)) {
-                    eligibleClues.push_back({i, items[i]});
-                }
+            size_t clueId = items[i].getLocation() ? TaskBoard::getClueId(items[i].getLocation()->getName()) : TaskBoard::NO_TASK;
+            if (clueId != TaskBoard::NO_TASK && !taskBoard.isClueDelivered(clueId)) {
+                options.push_back(i);
             }
         }
-        if (eligibleClues.empty()) {
+        if (options.empty()) {
             throw invalid_argument("You have no eligible evidence items to deliver at the Precinct.");
         }
-        cout << "Choose an item to use against Invisible man:\n";
-        for (size_t i = 0; i < eligibleClues.size(); ++i) {
-            cout << i + 1 << ". " << eligibleClues[i].second.getItemName() << " (from " << eligibleClues[i].second.getLocation()->getName() << ")\n";
-        }
-        int choice;
-        while (true) {
-            cout << "Enter your choice: ";
-            cin >> choice;
-            if (cin.fail()) {
-                cout << "Invalid input. Please enter a number.\n";
-                cin.clear(); 
-                cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-                continue;
-            }
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            break;
-        }
-        if (choice > 0 && choice <= static_cast<int>(eligibleClues.size())) {
-            const auto& selected = eligibleClues[choice - 1];
-            if (heroName == "Scientist") {
-                ability(selected.first);
-            }
-            taskBoard.deliverClue(selected.second.getLocation()->getName());
-            cout << playerName << "(" << heroName << ") used " << selected.second.getItemName() << " from " << selected.second.getLocation()->getName() << " on Invisible Man.\n";
-            removeItem(selected.first);
-            remainingActions--;
-            return;
-        } else {
-            cout << "Invalid choice.\n";
-            return;
-        }
-#endif
+        return options;
     }
 
     if (!taskBoard.isCoffinLocation(currentLocation->getName())) {
         throw invalid_argument("You cannot use advance in " + currentLocation->getName() + ".");
     }
-
-    if (dracula.getCurrentLocation() == nullptr) {
-            cout << "Dracula is defeated.\n";
-            return;
+    if (!dracula || dracula->getCurrentLocation() == nullptr) {
+        throw invalid_argument("Dracula is defeated.");
     }
-
     if (taskBoard.isCoffinDestroyed(currentLocation->getName())) {
         throw invalid_argument("The coffin at this location has already been destroyed.");
     }
-#ifndef TERMINAL
-    // In graphical mode, this will be handled by the UI
-    return;
-#else
-    vector<pair<size_t, Item>> redItems;
     for (size_t i = 0; i < items.size(); ++i) {
         if (items[i].getColor() == ItemColor::Red) {
-            redItems.push_back({i, items[i]});
+            options.push_back(i);
         }
     }
-    if (redItems.empty()) {
+    if (options.empty()) {
         throw invalid_argument("You have no red items to use.");
     }
-    cout << "Choose a red item to use:\n";
-    for (size_t i = 0; i < redItems.size(); ++i) {
-        cout << i + 1 << ". " << redItems[i].second.getItemName() << " (Power: " << redItems[i].second.getPower() << ")\n";
-    }
-    int choice;
-    while (true) {
-        cout << "Enter your choice: ";
-        cin >> choice;
-        if (cin.fail()) {
-            cout << "Invalid input. Please enter a number.\n";
-            cin.clear(); 
-            cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-            continue;
-        }
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        break;
-    }
-    if (choice > 0 && choice <= static_cast<int>(redItems.size())) {
-        const auto& selectedItem = redItems[choice - 1];
-        if (heroName == "Scientist") {
-            ability(selectedItem.first);
-        }
-        taskBoard.addStrengthToCoffin(currentLocation->getName(), selectedItem.second.getPower());
-        cout << playerName << "(" << heroName << ") used " << selectedItem.second.getItemName() << " on the coffin at " << currentLocation->getName() << ".\n";
-        removeItem(selectedItem.first);
-        remainingActions--;
-        return;
-    } else {
-        cout << "Invalid choice.\n";
-        return;
-    }
-#endif
+    return options;
 }
 
-void Hero::defeat(Dracula& dracula, TaskBoard& taskBoard) {
+void Hero::advance(Dracula* dracula, InvisibleMan* invisibleMan, TaskBoard& taskBoard, size_t itemIndex, bool useAbility) {
+    AllocPhaseScope allocScope(AllocPhase::HeroAction);
     if (remainingActions <= 0) {
         throw invalid_argument("No remaining actions.");
     }
 
-    bool atInvisibleMan = false;
-    for (const auto& c : currentLocation->getCharacters()) {
-        if (c == "Invisible man") atInvisibleMan = true;
+    auto options = getAdvanceOptions(dracula, invisibleMan, taskBoard);
+    if (find(options.begin(), options.end(), itemIndex) == options.end()) {
+        throw invalid_argument("That item can't be used to advance here.");
+    }
+    if (useAbility) {
+        ability(itemIndex);
     }
 
-    if (!atInvisibleMan && currentLocation != dracula.getCurrentLocation()) {
+    const Item item = items[itemIndex];
+    if (currentLocation->getName() == "Precinct") {
+        taskBoard.deliverClue(item.getLocation()->getName());
+        cout << playerName << "(" << heroName << ") used " << item.getItemName() << " from " << item.getLocation()->getName() << " on Invisible Man.\n";
+    } else {
+        taskBoard.addStrengthToCoffin(currentLocation->getName(), item.getPower());
+        cout << playerName << "(" << heroName << ") used " << item.getItemName() << " on the coffin at " << currentLocation->getName() << ".\n";
+    }
+    removeItem(itemIndex);
+    remainingActions--;
+}
+
+vector<size_t> Hero::getDefeatOptions(Dracula* dracula, const TaskBoard& taskBoard) const {
+    bool atInvisibleMan = currentLocation->hasCharacter("Invisible man");
+    auto draculaLocation = dracula ? dracula->getCurrentLocation() : nullptr;
+    if (!atInvisibleMan && (!draculaLocation || currentLocation != draculaLocation)) {
         throw invalid_argument("Defeat action cannot be used when there is no monster in your location.");
     }
 
+    ItemColor color = ItemColor::Red;
     if (atInvisibleMan) {
-#ifndef TERMINAL
-        // In graphical mode, this will be handled by the UI
-        return;
-#else
         if (!taskBoard.allCluesDelivered()) {
             throw invalid_argument("Not all items have been delivered. You cannot defeat the Invisible man yet.");
         }
-        vector<pair<size_t, Item>> redItems;
-        for (size_t i = 0; i < items.size(); ++i) {
-            if (items[i].getColor() == ItemColor::Red) {
-                redItems.push_back({i, items[i]});
-            }
-        }
-        if (redItems.empty()) {
-            throw invalid_argument("You have no red items to use against the Invisible man.");
-        }
-        cout << "Choose a red item to use against the Invisible man (" << taskBoard.getInvisibleManDefeatStrength() << "/9 so far):\n";
-        for (size_t i = 0; i < redItems.size(); ++i) {
-            cout << i + 1 << ". " << redItems[i].second.getItemName() << " (Power: " << redItems[i].second.getPower() << ")\n";
-        }
-        int choice;
-        while (true) {
-            cout << "Enter your choice: ";
-            cin >> choice;
-            if (cin.fail()) {
-                cout << "Invalid input. Please enter a number.\n";
-                cin.clear(); 
-                cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-                continue;
-            }
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            break;
-        }
-        if (choice > 0 && choice <= static_cast<int>(redItems.size())) {
-            const auto& selectedItem = redItems[choice - 1];
-            if (heroName == "Scientist") {
-                ability(selectedItem.first);
-            }
-            taskBoard.addStrengthToInvisibleMan(selectedItem.second.getPower());
-            cout << playerName << "(" << heroName << ") used " << selectedItem.second.getItemName() << " against the Invisible man.\n";
-            removeItem(selectedItem.first);
-            remainingActions--;
-            if (taskBoard.getInvisibleManDefeatStrength() == 9) {
-                taskBoard.defeatInvisibleMan();
-                cout << playerName << "(" << heroName << ") has defeated the Invisible man!\n";
-            }
-            return;
-        } else {
-            cout << "Invalid choice.\n";
-            return;
+    } else {
+        if (!taskBoard.allCoffinsDestroyed()) {
+            throw invalid_argument("Not all coffins have been destroyed. You cannot defeat Dracula yet.");
         }
-#endif
+        color = ItemColor::Yellow;
     }
 
-    if (!taskBoard.allCoffinsDestroyed()) {
-        throw invalid_argument("Not all coffins have been destroyed. You cannot defeat Dracula yet.");
-    }
-    if (currentLocation != dracula.getCurrentLocation()) {
-        throw invalid_argument("You are not at the same location as Dracula.");
-    }
-#ifndef TERMINAL
-    // In graphical mode, this will be handled by the UI
-    return;
-#else
-    vector<pair<size_t, Item>> yellowItems;
+    vector<size_t> options;
     for (size_t i = 0; i < items.size(); ++i) {
-        if (items[i].getColor() == ItemColor::Yellow) {
-            yellowItems.push_back({i, items[i]});
+        if (items[i].getColor() == color) {
+            options.push_back(i);
         }
     }
-    if (yellowItems.empty()) {
-        throw invalid_argument("You have no yellow items to use against Dracula.");
-    }
-    cout << "Choose a yellow item to use against Dracula (" << taskBoard.getDraculaDefeatStrength() << "/6 so far):\n";
-    for (size_t i = 0; i < yellowItems.size(); ++i) {
-        cout << i + 1 << ". " << yellowItems[i].second.getItemName() << " (Power: " << yellowItems[i].second.getPower() << ")\n";
-    }
-    int choice;
-    while (true) {
-        cout << "Enter your choice: ";
-        cin >> choice;
-        if (cin.fail()) {
-            cout << "Invalid input. Please enter a number.\n";
-            cin.clear(); 
-            cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
-            continue;
-        }
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        break;
+    if (options.empty()) {
+        throw invalid_argument(atInvisibleMan ? "You have no red items to use against the Invisible man."
+                                              : "You have no yellow items to use against Dracula.");
+    }
+    return options;
+}
+
+void Hero::defeat(Dracula* dracula, TaskBoard& taskBoard, size_t itemIndex, bool useAbility) {
+    AllocPhaseScope allocScope(AllocPhase::HeroAction);
+    if (remainingActions <= 0) {
+        throw invalid_argument("No remaining actions.");
+    }
+
+    auto options = getDefeatOptions(dracula, taskBoard);
+    if (find(options.begin(), options.end(), itemIndex) == options.end()) {
+        throw invalid_argument("That item can't be used against this monster.");
     }
-    if (choice > 0 && choice <= static_cast<int>(yellowItems.size())) {
-        const auto& selectedItem = yellowItems[choice - 1];
-        if (heroName == "Scientist") {
-            ability(selectedItem.first);
+    if (useAbility) {
+        ability(itemIndex);
+    }
+
+    const Item item = items[itemIndex];
+    if (currentLocation->hasCharacter("Invisible man")) {
+        taskBoard.addStrengthToInvisibleMan(item.getPower());
+        cout << playerName << "(" << heroName << ") used " << item.getItemName() << " against the Invisible man.\n";
+        if (taskBoard.getInvisibleManDefeatStrength() >= Rules::INVISIBLE_MAN_DEFEAT_STRENGTH) {
+            taskBoard.defeatInvisibleMan();
+            cout << playerName << "(" << heroName << ") has defeated the Invisible man!\n";
         }
-        taskBoard.addStrengthToDracula(selectedItem.second.getPower());
-        cout << heroName << " used " << selectedItem.second.getItemName() << " against Dracula.\n";
-        removeItem(selectedItem.first);
-        remainingActions--;
-        if (taskBoard.getDraculaDefeatStrength() == 6) {
+    } else {
+        taskBoard.addStrengthToDracula(item.getPower());
+        cout << heroName << " used " << item.getItemName() << " against Dracula.\n";
+        if (taskBoard.getDraculaDefeatStrength() >= Rules::DRACULA_DEFEAT_STRENGTH) {
             cout << playerName << "(" << heroName << ") has defeated the Dracula!\n";
         }
-    } else {
-        cout << "Invalid choice.\n";
     }
-#endif
+    removeItem(itemIndex);
+    remainingActions--;
 }
 
 void Hero::moveTwoSteps() {
@@ -735,4 +533,20 @@ void Hero::moveTwoSteps() {
         setCurrentLocation(nextLoc);
         loc = nextLoc;
     }
-}
\ No newline at end of file
+}
+HeroRoster::HeroRoster(Hero* first, Hero* second) {
+    add(first);
+    add(second);
+}
+
+void HeroRoster::add(Hero* hero) {
+    if (hero) {
+        heroes[static_cast<size_t>(hero->getKind())] = hero;
+    }
+}
+
+Hero* HeroRoster::find(const string& characterName) const {
+    HeroKind kind;
+    if (!Hero::getKindByName(characterName, kind)) return nullptr;
+    return get(kind);
+}
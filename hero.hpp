@@ -1,6 +1,9 @@
 #ifndef HERO_HPP
 #define HERO_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -10,6 +13,7 @@
 #include "item.hpp"
 #include "perkcard.hpp"
 #include "taskboard.hpp"
+#include "smallvector.hpp"
 
 class PerkDeck;
 class InvisibleMan;
@@ -17,21 +21,54 @@ class Dracula;
 
 std::string toSentenceCase(std::string name);
 
+// The heroes are a closed set. Hero-specific behavior is picked with a switch
+// on the kind, so the engine never needs a virtual call or a dynamic_cast.
+enum class HeroKind : std::uint8_t { Archeologist, Mayor, Courier, Scientist };
+constexpr std::size_t HERO_KIND_COUNT = 4;
+
+// A villager the hero can guide this action and where it may be taken
+struct GuideOption {
+    std::shared_ptr<Villager> villager;
+    SmallVector<std::shared_ptr<Location>, Location::MAX_NEIGHBORS> destinations;
+};
+using GuideOptions = SmallVector<GuideOption, VillagerManager::VILLAGER_COUNT>;
+
 class Hero {
 public:
-    Hero(const std::string& playerName, const std::string& heroName, int maxActions, std::shared_ptr<Location> startingLocation);
+    Hero(const std::string& playerName, HeroKind kind, int maxActions, std::shared_ptr<Location> startingLocation);
     virtual ~Hero() = default;
 
-    virtual void move(std::shared_ptr<Location> newLocation, VillagerManager& villagerManager, PerkDeck* perkDeck = nullptr);
-    virtual void guide(VillagerManager& villagerManager, Map& map, PerkDeck* perkDeck = nullptr);
-    virtual void pickUp();
-    virtual void advance(Dracula& dracula, InvisibleMan& invisibleMan, TaskBoard& taskBoard);
-    virtual void defeat(Dracula& dracula, TaskBoard& taskBoard);
-    virtual void specialAction() = 0; 
-    virtual void ability(size_t index) = 0; 
+    static const char* getKindName(HeroKind kind);
+    // Returns false when the character is not a hero
+    static bool getKindByName(const std::string& characterName, HeroKind& kind);
 
-    virtual void setOtherHero(Hero* otherHero) {}
+    // The actions take the player's choices as arguments; the front end asks for
+    // them. A choice the rules don't allow throws invalid_argument.
+    void move(std::shared_ptr<Location> newLocation, VillagerManager& villagerManager, PerkDeck* perkDeck = nullptr,
+              bool withVillagers = false);
+    // Throws like move() does when the hero can't go there
+    void checkMove(const std::shared_ptr<Location>& newLocation) const;
+    void guide(VillagerManager& villagerManager, std::shared_ptr<Villager> villager,
+               std::shared_ptr<Location> destination, PerkDeck* perkDeck = nullptr);
+    // Villagers here can go to any neighbor, villagers on a neighbor can come here.
+    // Only looks at the hero's location and its neighbors.
+    GuideOptions getGuideOptions(const VillagerManager& villagerManager) const;
+    // Any number of items from the hero's location for one action
+    void pickUp(const std::vector<Item>& chosenItems);
+    // A defeated monster may be passed as null. The options are indices of the
+    // items the hero can use; they throw when the action can't be taken here.
+    std::vector<std::size_t> getAdvanceOptions(Dracula* dracula, InvisibleMan* invisibleMan, const TaskBoard& taskBoard) const;
+    void advance(Dracula* dracula, InvisibleMan* invisibleMan, TaskBoard& taskBoard, std::size_t itemIndex,
+                 bool useAbility = false);
+    std::vector<std::size_t> getDefeatOptions(Dracula* dracula, const TaskBoard& taskBoard) const;
+    void defeat(Dracula* dracula, TaskBoard& taskBoard, std::size_t itemIndex, bool useAbility = false);
+    // Forwarded to the hero's own class by kind. Only the Archeologist uses the
+    // location and items it takes from there.
+    void specialAction(std::shared_ptr<Location> location = nullptr, const std::vector<Item>& chosenItems = {});
+    void ability(size_t index);
+    void setOtherHero(Hero* otherHero);
 
+    HeroKind getKind() const { return kind; }
     const std::string& getHeroName() const;
     const std::string& getPlayerName() const;
 
@@ -45,7 +82,8 @@ public:
 
     void addPerkCard(const PerkCard& card);
     const std::vector<PerkCard>& getPerkCards() const;
-    void usePerkCard(size_t index, Map& map, VillagerManager& villagerManager, PerkDeck* perkDeck = nullptr, InvisibleMan* invisibleMan = nullptr, ItemBag* itemBag = nullptr, Hero* otherHero = nullptr, Dracula* dracula = nullptr);
+    // target is where Visit from the Detective puts the Invisible man
+    void usePerkCard(size_t index, Map& map, VillagerManager& villagerManager, PerkDeck* perkDeck = nullptr, InvisibleMan* invisibleMan = nullptr, ItemBag* itemBag = nullptr, Hero* otherHero = nullptr, Dracula* dracula = nullptr, std::shared_ptr<Location> target = nullptr);
     void removePerkCard(size_t index);
     bool shouldSkipNextMonsterPhase() const;
     void setSkipNextMonsterPhase(bool skip);
@@ -60,6 +98,7 @@ protected:
     std::vector<Item> items;
     std::vector<PerkCard> perkCards;
     std::shared_ptr<Location> currentLocation;
+    HeroKind kind;
     std::string heroName;
     std::string playerName;
     int maxActions;
@@ -71,4 +110,20 @@ protected:
     void moveTwoSteps();
 };
 
+// The heroes in play, looked up by kind or by board character name. Kinds
+// that are not in this game stay null.
+class HeroRoster {
+public:
+    HeroRoster() = default;
+    HeroRoster(Hero* first, Hero* second);
+
+    void add(Hero* hero);
+    Hero* get(HeroKind kind) const { return heroes[static_cast<std::size_t>(kind)]; }
+    // Null when the character is not a hero in this game
+    Hero* find(const std::string& characterName) const;
+
+private:
+    std::array<Hero*, HERO_KIND_COUNT> heroes{};
+};
+
 #endif
\ No newline at end of file
@@ -9,7 +9,7 @@
 
 using namespace std;
 
-InvisibleMan::InvisibleMan(shared_ptr<Location> startingLocation) : Monster("Invisible man", startingLocation) {
+InvisibleMan::InvisibleMan(shared_ptr<Location> startingLocation) : Monster(MonsterKind::InvisibleMan, startingLocation) {
     powerName = "Stalk Unseen";
 }
 
@@ -19,8 +19,7 @@ void InvisibleMan::power(Hero* hero, TerrorTracker& terrorTracker, VillagerManag
         for (const auto& c : currentLocationCharacterExistence) {
             if (c == "Archeologist" || c == "Mayor" || c == "Scientist" || c == "Courier" || c == "Dracula" || c == "Invisible man") continue;
             currentLocation->removeCharacter(c);
-            auto villager = villagerManager.getVillager(c);
-            villager->setCurrentLocation(nullptr);
+            villagerManager.killVillager(c, monsterName);
             cout << c << " was killed by Invisible man.\n";
             terrorTracker.increase();
             cout << "Terror level increased to " << terrorTracker.getLevel() << " due to villager death.\n";
@@ -1,6 +1,8 @@
 #include "item.hpp"
+#include "rules.hpp"
 #include "location.hpp"
 #include "map.hpp"
+#include "alloctracker.hpp"
 #include <random>
 #include <algorithm>
 #include <stdexcept>
@@ -129,11 +131,17 @@ ItemBag::ItemBag(Map& map) {
     
     shuffleItems();
 
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < Rules::STARTING_ITEMS; ++i) {
         drawRandomItem(map);
     }
 }
 
+void ItemBag::seed(unsigned int seedValue) {
+    rng.seed(seedValue);
+    items = initialItems;
+    shuffleItems();
+}
+
 void ItemBag::shuffleItems() {
     shuffle(items.begin(), items.end(), rng);
 }
@@ -165,6 +173,7 @@ void ItemBag::refillItems(Map& map) {
 }
 
 Item ItemBag::drawRandomItem(Map& map) {
+    AllocPhaseScope allocScope(AllocPhase::Draw);
     if (items.empty()) {
         refillItems(map);
     }
@@ -42,6 +42,7 @@ class ItemBag {
 public:
     explicit ItemBag(Map& map);
 
+    void seed(unsigned int seedValue);
     void shuffleItems();
     void refillItems(Map& map);
     Item drawRandomItem(Map& map);
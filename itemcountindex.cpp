@@ -0,0 +1,37 @@
+#include "itemcountindex.hpp"
+#include <bit>
+#include <stdexcept>
+
+using namespace std;
+
+void ItemCountIndex::addLocation(size_t locationIndex) {
+    if (locationIndex >= MAX_LOCATIONS) {
+        throw out_of_range("Too many locations for the item count index");
+    }
+    countChanged(locationIndex, 0, 0);
+}
+
+void ItemCountIndex::countChanged(size_t locationIndex, size_t oldCount, size_t newCount) {
+    uint64_t bit = uint64_t(1) << locationIndex;
+    if (newCount >= buckets.size()) {
+        buckets.resize(newCount + 1, 0);
+    }
+    if (oldCount < buckets.size()) {
+        buckets[oldCount] &= ~bit;
+    }
+    buckets[newCount] |= bit;
+
+    if (newCount > maxCount) {
+        maxCount = newCount;
+    }
+    // Counts only fall by one item or to zero, so this walks few buckets
+    while (maxCount > 0 && buckets[maxCount] == 0) {
+        --maxCount;
+    }
+}
+
+bool ItemCountIndex::mostItems(size_t& locationIndex) const {
+    if (maxCount == 0) return false;
+    locationIndex = (size_t)countr_zero(buckets[maxCount]);
+    return true;
+}
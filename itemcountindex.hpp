@@ -0,0 +1,28 @@
+#ifndef ITEMCOUNTINDEX_HPP
+#define ITEMCOUNTINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Tracks how many items lie on each location of a Map. Locations report
+// every change, so the location with the most items is known without a scan.
+// bucket[n] holds the locations with exactly n items as a bit mask; ties go to
+// the location added to the map first (lowest index).
+class ItemCountIndex {
+public:
+    static const std::size_t MAX_LOCATIONS = 64;
+
+    void addLocation(std::size_t locationIndex);
+    void countChanged(std::size_t locationIndex, std::size_t oldCount, std::size_t newCount);
+
+    // Returns false when no location has any items
+    bool mostItems(std::size_t& locationIndex) const;
+    std::size_t getMaxCount() const { return maxCount; }
+
+private:
+    std::vector<std::uint64_t> buckets;
+    std::size_t maxCount = 0;
+};
+
+#endif
@@ -1,16 +1,31 @@
 #include "location.hpp"
 #include "item.hpp"
+#include "villagermanager.hpp"
+#include "itemcountindex.hpp"
 #include <stdexcept>
 #include <algorithm>
 
 using namespace std;
 
-Location::Location(const string& locationName) : name(locationName) {}
+static_assert(VillagerManager::VILLAGER_COUNT <= Location::VillagerSet().size(), "VillagerSet too small for every villager");
+static_assert(VillagerManager::VILLAGER_COUNT + 4 <= Location::MAX_CHARACTERS, "MAX_CHARACTERS too small for a full location");
+
+Location::Location(const string& locationName) : name(locationName), index(0) {
+    characters.reserve(MAX_CHARACTERS);
+}
 
 string Location::getName() const {
     return name;
 }
 
+size_t Location::getIndex() const {
+    return index;
+}
+
+void Location::setIndex(size_t index) {
+    this->index = index;
+}
+
 const vector<shared_ptr<Location>>& Location::getNeighbors() const {
     return neighbors;
 }
@@ -19,6 +34,14 @@ const vector<string>& Location::getCharacters() const {
     return characters;
 }
 
+const Location::VillagerSet& Location::getVillagers() const {
+    return villagers;
+}
+
+bool Location::hasVillagers() const {
+    return villagers.any();
+}
+
 const std::vector<Item>& Location::getItems() const {
     return items;
 }
@@ -30,6 +53,9 @@ void Location::addNeighbor(shared_ptr<Location> neighbor) {
     if (find(neighbors.begin(), neighbors.end(), neighbor) != neighbors.end()) {
         throw invalid_argument("Location is already a neighbor");
     }
+    if (neighbors.size() == MAX_NEIGHBORS) {
+        throw length_error("Location has too many neighbors");
+    }
     if (neighbor) {
         neighbors.push_back(neighbor);
     }
@@ -39,22 +65,46 @@ void Location::addNeighbor(shared_ptr<Location> neighbor) {
 }
 
 void Location::addCharacter(const string& character) {
-    if (find(characters.begin(), characters.end(), character) != characters.end()) {
+    if (!tryAddCharacter(character)) {
         throw invalid_argument("Character is already present in this location.");
     }
-    characters.push_back(character);
 }
 
 void Location::removeCharacter(const string& character) {
-    auto it = find(characters.begin(), characters.end(), character);
-    if (it == characters.end()) {
+    if (!tryRemoveCharacter(character)) {
         throw invalid_argument("Character not found in this location.");
     }
+}
+
+bool Location::tryAddCharacter(const string& character) {
+    if (hasCharacter(character)) return false;
+    characters.push_back(character);
+    size_t villagerId;
+    if (VillagerManager::findVillagerId(character, villagerId)) {
+        villagers.set(villagerId);
+    }
+    return true;
+}
+
+bool Location::tryRemoveCharacter(const string& character) {
+    auto it = find(characters.begin(), characters.end(), character);
+    if (it == characters.end()) return false;
     characters.erase(it);
+    size_t villagerId;
+    if (VillagerManager::findVillagerId(character, villagerId)) {
+        villagers.reset(villagerId);
+    }
+    return true;
+}
+
+bool Location::hasCharacter(const string& character) const {
+    return find(characters.begin(), characters.end(), character) != characters.end();
 }
 
 void Location::addItem(const Item& item) {
     items.push_back(item);
+    colorCounts[(size_t)item.getColor()]++;
+    itemsChanged(items.size() - 1);
 }
 
 void Location::removeItem(const Item& item) {
@@ -69,13 +119,37 @@ void Location::removeItem(const Item& item) {
         throw std::invalid_argument("Item not found in this location to remove.");
     }
 
+    colorCounts[(size_t)it->getColor()]--;
     items.erase(it);
+    itemsChanged(items.size() + 1);
 }
 
 void Location::clearItems() {
+    size_t oldCount = items.size();
     items.clear();
+    colorCounts.fill(0);
+    itemsChanged(oldCount);
+}
+
+size_t Location::getItemCount() const {
+    return items.size();
+}
+
+size_t Location::getItemCount(ItemColor color) const {
+    return colorCounts[(size_t)color];
+}
+
+void Location::setItemIndex(ItemCountIndex* index) {
+    itemIndex = index;
+}
+
+void Location::itemsChanged(size_t oldCount) {
+    if (itemIndex && oldCount != items.size()) {
+        itemIndex->countChanged(this->index, oldCount, items.size());
+    }
 }
 
 void Location::clearCharacters() {
     characters.clear();
+    villagers.reset();
 }
\ No newline at end of file
@@ -1,34 +1,68 @@
 #ifndef LOCATION_HPP
 #define LOCATION_HPP
 
+#include <array>
+#include <bitset>
+#include <cstddef>
 #include <string>
 #include <vector>
 #include <memory>
 #include <stdexcept>
 #include "item.hpp"
 
+class ItemCountIndex;
+
 class Location {
+public:
+    // No board location has more neighbors than this; guide options rely on it
+    static const std::size_t MAX_NEIGHBORS = 12;
+    // Both heroes, both monsters and every villager; the character list is
+    // reserved to this, so moving characters around never allocates
+    static const std::size_t MAX_CHARACTERS = 11;
+    // Villagers standing here, indexed by VillagerManager villager id
+    using VillagerSet = std::bitset<8>;
+
 private:
     std::string name;
+    std::size_t index;
     std::vector<std::shared_ptr<Location>> neighbors;
     std::vector<std::string> characters;
+    VillagerSet villagers;
     std::vector<Item> items;
+    std::array<std::size_t, 3> colorCounts{};  // indexed by ItemColor
+    ItemCountIndex* itemIndex = nullptr;
+
+    void itemsChanged(std::size_t oldCount);
     
 public:
     Location(const std::string& name);
     
     std::string getName() const;
+    // Position of the location in its Map, used to index the route tables
+    std::size_t getIndex() const;
+    void setIndex(std::size_t index);
 
     void addNeighbor(std::shared_ptr<Location> neighbor);
     const std::vector<std::shared_ptr<Location>>& getNeighbors() const;
     void addCharacter(const std::string& character);
     void removeCharacter(const std::string& character);
+    // Same as above, but a duplicate or missing character returns false instead of throwing
+    bool tryAddCharacter(const std::string& character);
+    bool tryRemoveCharacter(const std::string& character);
+    bool hasCharacter(const std::string& character) const;
     const std::vector<std::string>& getCharacters() const;
+    // Kept in step with the characters list
+    const VillagerSet& getVillagers() const;
+    bool hasVillagers() const;
 
     void addItem(const Item& item);
     void removeItem(const Item& item);
     const std::vector<Item>& getItems() const;
     void clearItems();
+    std::size_t getItemCount() const;
+    std::size_t getItemCount(ItemColor color) const;
+    // The owning Map's index, told about every change in the item count
+    void setItemIndex(ItemCountIndex* index);
     void clearCharacters();
 };
 
@@ -1,7 +1,22 @@
 #include "game.hpp"
+#include <iostream>
+
+int main(int argc, char** argv){
+    BatchOptions batchOptions;
+    if (!BatchOptions::parse(argc, argv, batchOptions)) {
+        std::cerr << "Usage: horrified [--batch] [--script=FILE] [--jsonl]" << std::endl;
+        return 1;
+    }
 
-int main(){
     Game game;
+    if (batchOptions.enabled) {
+        try {
+            game.enableBatchMode(batchOptions);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
     game.runMainMenu();
     
     return 0;
@@ -7,26 +7,39 @@
 
 using namespace std;
 
-Map::Map() {
-    shared_ptr<Location> Cave = make_shared<Location>("Cave");
-    shared_ptr<Location> Camp = make_shared<Location>("Camp");
-    shared_ptr<Location> Precinct = make_shared<Location>("Precinct");
-    shared_ptr<Location> Inn = make_shared<Location>("Inn");
-    shared_ptr<Location> Barn = make_shared<Location>("Barn");
-    shared_ptr<Location> Dungeon = make_shared<Location>("Dungeon");
-    shared_ptr<Location> Theatre = make_shared<Location>("Theatre");
-    shared_ptr<Location> Tower = make_shared<Location>("Tower");
-    shared_ptr<Location> Docks = make_shared<Location>("Docks");
-    shared_ptr<Location> Mansion = make_shared<Location>("Mansion");
-    shared_ptr<Location> Abbey = make_shared<Location>("Abbey");
-    shared_ptr<Location> Shop = make_shared<Location>("Shop");
-    shared_ptr<Location> Crypt = make_shared<Location>("Crypt");
-    shared_ptr<Location> Museum = make_shared<Location>("Museum");
-    shared_ptr<Location> Church = make_shared<Location>("Church");
-    shared_ptr<Location> Laboratory = make_shared<Location>("Laboratory");
-    shared_ptr<Location> Hospital = make_shared<Location>("Hospital");
-    shared_ptr<Location> Graveyard = make_shared<Location>("Graveyard");
-    shared_ptr<Location> Institute = make_shared<Location>("Institute");
+Map::Map() : Map(pmr::get_default_resource()) {}
+
+Map::~Map() {
+    // Locations can outlive the map through items and characters
+    for (const auto& location : locationList) {
+        location->setItemIndex(nullptr);
+    }
+}
+
+Map::Map(pmr::memory_resource* resource) : itemIndex(make_unique<ItemCountIndex>()) {
+    auto makeLocation = [resource](const string& name) {
+        return allocate_shared<Location>(pmr::polymorphic_allocator<Location>(resource), name);
+    };
+
+    shared_ptr<Location> Cave = makeLocation("Cave");
+    shared_ptr<Location> Camp = makeLocation("Camp");
+    shared_ptr<Location> Precinct = makeLocation("Precinct");
+    shared_ptr<Location> Inn = makeLocation("Inn");
+    shared_ptr<Location> Barn = makeLocation("Barn");
+    shared_ptr<Location> Dungeon = makeLocation("Dungeon");
+    shared_ptr<Location> Theatre = makeLocation("Theatre");
+    shared_ptr<Location> Tower = makeLocation("Tower");
+    shared_ptr<Location> Docks = makeLocation("Docks");
+    shared_ptr<Location> Mansion = makeLocation("Mansion");
+    shared_ptr<Location> Abbey = makeLocation("Abbey");
+    shared_ptr<Location> Shop = makeLocation("Shop");
+    shared_ptr<Location> Crypt = makeLocation("Crypt");
+    shared_ptr<Location> Museum = makeLocation("Museum");
+    shared_ptr<Location> Church = makeLocation("Church");
+    shared_ptr<Location> Laboratory = makeLocation("Laboratory");
+    shared_ptr<Location> Hospital = makeLocation("Hospital");
+    shared_ptr<Location> Graveyard = makeLocation("Graveyard");
+    shared_ptr<Location> Institute = makeLocation("Institute");
 
     addLocation(Cave);
     addLocation(Camp);
@@ -76,6 +89,8 @@ Map::Map() {
     addNeighbor("Church", "Hospital"); 
     addNeighbor("Church", "Graveyard"); 
     addNeighbor("Laboratory", "Institute"); 
+
+    buildRoutes();
 }
 
 void Map::addLocation(shared_ptr<Location> location) {
@@ -83,7 +98,15 @@ void Map::addLocation(shared_ptr<Location> location) {
             throw invalid_argument("Location '" + location->getName() + "' already exists in map.");
     }
     if (location) {
+        itemIndex->addLocation(locationList.size());
+        location->setIndex(locationList.size());
         locations[location->getName()] = location;
+        locationList.push_back(location);
+        location->setItemIndex(itemIndex.get());
+        if (location->getItemCount() > 0) {
+            itemIndex->countChanged(location->getIndex(), 0, location->getItemCount());
+        }
+        if (routesBuilt) buildRoutes();
     } 
     else {
         throw invalid_argument("Invalid location.");
@@ -97,6 +120,7 @@ void Map::addNeighbor(const string& locationName1, const string& locationName2)
     if (it1 != locations.end() && it2 != locations.end()) {
         it1->second->addNeighbor(it2->second);
         it2->second->addNeighbor(it1->second);
+        if (routesBuilt) buildRoutes();
     } 
     else {
         throw invalid_argument("Couldn't find one or both locations to set as neighbors.");
@@ -104,30 +128,81 @@ void Map::addNeighbor(const string& locationName1, const string& locationName2)
 }
 
 shared_ptr<Location> Map::getLocation(const std::string& locationName) const {
-    auto it = locations.find(locationName);
-    if (it != locations.end()) {
-        return it->second;
+    auto location = findLocation(locationName);
+    if (!location) {
+        throw invalid_argument(locationName + " doesn't exist.");
     }
-    throw invalid_argument(locationName + " doesn't exist.");
+    return location;
+}
+
+shared_ptr<Location> Map::findLocation(const std::string& locationName) const {
+    auto it = locations.find(locationName);
+    return it != locations.end() ? it->second : nullptr;
 }
 
 shared_ptr<Location> Map::getLocationWithMostItems() const {
-    shared_ptr<Location> locationWithMostItems = nullptr;
-    size_t maxItemCount = 0;
-    
-    for (const auto& [name, location] : locations) {
-        size_t currentItemCount = location->getItems().size();
-        if (currentItemCount > maxItemCount) {
-            maxItemCount = currentItemCount;
-            locationWithMostItems = location;
+    size_t index = 0;
+    if (!itemIndex->mostItems(index)) return nullptr;
+    return locationList[index];
+}
+
+// The board never changes during a game, so distances and the first step
+// towards every location are worked out once instead of a BFS per query.
+void Map::buildRoutes() {
+    size_t count = locationList.size();
+    distances.assign(count * count, 50);
+    nextHops.assign(count * count, nullptr);
+
+    vector<size_t> q;
+    q.reserve(count);
+    for (size_t to = 0; to < count; ++to) {
+        q.clear();
+        distances[to * count + to] = 0;
+        q.push_back(to);
+        for (size_t head = 0; head < q.size(); ++head) {
+            size_t current = q[head];
+            for (const auto& neighbor : locationList[current]->getNeighbors()) {
+                size_t next = neighbor->getIndex();
+                if (distances[next * count + to] == 50 && next != to) {
+                    distances[next * count + to] = distances[current * count + to] + 1;
+                    q.push_back(next);
+                }
+            }
         }
     }
-    
-    return locationWithMostItems;
+
+    for (size_t from = 0; from < count; ++from) {
+        for (size_t to = 0; to < count; ++to) {
+            if (from == to) continue;
+            int bestDistance = distances[from * count + to];
+            for (const auto& neighbor : locationList[from]->getNeighbors()) {
+                int neighborDistance = distances[neighbor->getIndex() * count + to];
+                if (neighborDistance < bestDistance) {
+                    bestDistance = neighborDistance;
+                    nextHops[from * count + to] = neighbor;
+                }
+            }
+        }
+    }
+
+    routesBuilt = true;
+}
+
+bool Map::hasRoutes(const shared_ptr<Location>& location) const {
+    return routesBuilt && location && location->getIndex() < locationList.size()
+        && locationList[location->getIndex()] == location;
 }
 
 int Map::calculateDistance(shared_ptr<Location> from, shared_ptr<Location> to) const {
     if (from == to) return 0;
+    if (hasRoutes(from) && hasRoutes(to)) {
+        return distances[from->getIndex() * locationList.size() + to->getIndex()];
+    }
+    return searchDistance(from, to);
+}
+
+int Map::searchDistance(shared_ptr<Location> from, shared_ptr<Location> to) const {
+    if (from == to) return 0;
     
     queue<pair<shared_ptr<Location>, int>> q;
     unordered_set<string> visited;
@@ -156,6 +231,9 @@ int Map::calculateDistance(shared_ptr<Location> from, shared_ptr<Location> to) c
 
 shared_ptr<Location> Map::findCloserLocation(shared_ptr<Location> current, shared_ptr<Location> target) const {
     if (current == target) return nullptr;
+    if (hasRoutes(current) && hasRoutes(target)) {
+        return nextHops[current->getIndex() * locationList.size() + target->getIndex()];
+    }
     
     int currentDistance = calculateDistance(current, target);
     shared_ptr<Location> bestLocation = nullptr;
@@ -2,24 +2,45 @@
 #define MAP_HPP
 
 #include "location.hpp"
+#include "itemcountindex.hpp"
 #include <unordered_map>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <functional>
+#include <vector>
 
 class Map {
 public:
     std::unordered_map<std::string, std::shared_ptr<Location>> locations;
 
     Map();
+    explicit Map(std::pmr::memory_resource* resource);
+    ~Map();
 
     std::shared_ptr<Location> getLocation(const std::string& locationName) const;
+    // Null instead of throwing when there is no such location
+    std::shared_ptr<Location> findLocation(const std::string& locationName) const;
+    // Ties go to the location added first; null when no location has items
     std::shared_ptr<Location> getLocationWithMostItems() const;
     int calculateDistance(std::shared_ptr<Location> from, std::shared_ptr<Location> to) const;
     std::shared_ptr<Location> findCloserLocation(std::shared_ptr<Location> current, std::shared_ptr<Location> target) const;
     
     void addLocation(std::shared_ptr<Location> location);
     void addNeighbor(const std::string& locationName1, const std::string& locationName2);
+
+private:
+    // All-pairs distance and next-hop tables, indexed by Location::getIndex()
+    std::vector<std::shared_ptr<Location>> locationList;
+    std::vector<int> distances;
+    std::vector<std::shared_ptr<Location>> nextHops;
+    bool routesBuilt = false;
+    // Heap allocated so the pointer handed to each Location stays valid
+    std::unique_ptr<ItemCountIndex> itemIndex;
+
+    void buildRoutes();
+    bool hasRoutes(const std::shared_ptr<Location>& location) const;
+    int searchDistance(std::shared_ptr<Location> from, std::shared_ptr<Location> to) const;
 };
 
 #endif
\ No newline at end of file
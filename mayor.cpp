@@ -1,11 +1,12 @@
 #include "mayor.hpp"
+#include "rules.hpp"
 #include "map.hpp"
 #include <iostream>
 #include <stdexcept>
 
 using namespace std;
 
-Mayor::Mayor(const string& playerName, shared_ptr<Location> startingLocation) : Hero(playerName, "Mayor", 5, startingLocation) {}
+Mayor::Mayor(const string& playerName, shared_ptr<Location> startingLocation) : Hero(playerName, HeroKind::Mayor, Rules::MAYOR_ACTIONS, startingLocation) {}
 
 void Mayor::specialAction() {
     cout << "Mayor has no special action." << endl;
@@ -1,21 +1,18 @@
 #include "monster.hpp"
+#include "dracula.hpp"
+#include "invisibleman.hpp"
 #include "terrorteracker.hpp"
 #include "map.hpp"
-#include "archeologist.hpp"
-#include "mayor.hpp"
 #include <iostream>
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
 #include <stdexcept>
-#ifndef TERMINAL
-#include "game_screen.hpp"
-#endif
 
 using namespace std;
 
-Monster::Monster(const string& monsterName, shared_ptr<Location> startingLocation) {
-    this->monsterName = monsterName;
+Monster::Monster(MonsterKind kind, shared_ptr<Location> startingLocation) : kind(kind) {
+    this->monsterName = getKindName(kind);
     setCurrentLocation(startingLocation);
     try {
         currentLocation->addCharacter(monsterName);
@@ -24,6 +21,33 @@ Monster::Monster(const string& monsterName, shared_ptr<Location> startingLocatio
     }
 }
 
+const char* Monster::getKindName(MonsterKind kind) {
+    return kind == MonsterKind::Dracula ? "Dracula" : "Invisible man";
+}
+
+void Monster::power(Hero* hero, TerrorTracker& terrorTracker, VillagerManager& villagerManager) {
+    switch (kind) {
+        case MonsterKind::Dracula: static_cast<Dracula*>(this)->power(hero, terrorTracker, villagerManager); break;
+        case MonsterKind::InvisibleMan: static_cast<InvisibleMan*>(this)->power(hero, terrorTracker, villagerManager); break;
+    }
+}
+
+void Monster::setEventSink(GameEventSink* sink) {
+    eventSink = sink;
+}
+
+void Monster::publishEvent(GameEventType type, const string& target, const string& location, const string& detail) {
+    if (eventSink) {
+        GameEvent event;
+        event.type = type;
+        event.actor = monsterName;
+        event.target = target;
+        event.location = location;
+        event.detail = detail;
+        eventSink->publish(event);
+    }
+}
+
 string Monster::getMonsterName() const {
     return monsterName;
 }
@@ -111,27 +135,15 @@ void Monster::moveToNearestCharacter(const string& targetCharacter, int stepNumb
     cout << monsterName << " moved to " << newLocation->getName() << ".\n";
 }
 
-bool Monster::attack(Hero* archeologist, Hero* mayor, Courier* courier, Scientist* scientist, TerrorTracker& terrorTracker, Map& map, VillagerManager& villagerManager
-        #ifndef TERMINAL
-                , GameScreen* gameScreen
-        #endif
-) {
+DecisionTask<bool> Monster::attack(const HeroRoster& heroes, TerrorTracker& terrorTracker, Map& map, VillagerManager& villagerManager) {
     auto currentLocationCharacters = currentLocation->getCharacters();
     Hero* targetHero = nullptr;
     string targetVillager = "";
     
     for (const auto& character : currentLocationCharacters) {
-        if (character == "Archeologist") {
-            targetHero = archeologist;
-            break;
-        } else if (character == "Mayor") {
-            targetHero = mayor;
-            break;
-        } else if (character == "Courier") {
-            targetHero = courier;
-            break;
-        } else if (character == "Scientist") {
-            targetHero = scientist;
+        HeroKind heroKind;
+        if (Hero::getKindByName(character, heroKind)) {
+            targetHero = heroes.get(heroKind);
             break;
         }
     }
@@ -148,100 +160,58 @@ bool Monster::attack(Hero* archeologist, Hero* mayor, Courier* courier, Scientis
     }
     
     if (!targetHero && targetVillager.empty()) {
-        return false;
+        co_return false;
     }
     
     cout << monsterName << " attacks "; 
     
     if (targetHero) {
         cout << targetHero->getPlayerName() << " (" << targetHero->getHeroName() << ")!\n";
-        #ifndef TERMINAL
-            if (gameScreen) {
-                gameScreen->addGameMessage(monsterName + " is attacking " + targetHero->getHeroName() + "!");
-            }
-        #endif
+        publishEvent(GameEventType::MonsterAttack, targetHero->getHeroName(), currentLocation->getName());
 
         auto items = targetHero->getItems();
-
         if (!items.empty()) {
-            #ifdef TERMINAL
-                string answer;
-            #else
-                if (gameScreen) {
-                    gameScreen->showHeroDefenseYesNoChoice(
-                        targetHero,
-                        [targetHero, gameScreen](int itemIndex) {
-                            if (targetHero->getHeroName() == "Scientist") {
-                                targetHero->ability(itemIndex);
-                            }
-                            std::string itemName = targetHero->getItems()[itemIndex].getItemName();
-                            targetHero->removeItem(itemIndex);
-                            if (gameScreen) {
-                                gameScreen->addGameMessage(targetHero->getHeroName() + " used a " + itemName + " to fend off the attack!");
-                            }
-                        },
-                        [targetHero, &map, &terrorTracker, gameScreen]() {
-                            try {
-                                auto hospital = map.getLocation("Hospital");
-                                targetHero->getCurrentLocation()->removeCharacter(targetHero->getHeroName());
-                                hospital->addCharacter(targetHero->getHeroName());
-                                targetHero->setCurrentLocation(hospital);
-                                if (gameScreen) {
-                                    gameScreen->addGameMessage(targetHero->getHeroName() + " did not use an item and was sent to the Hospital!");
-                                }
-                                terrorTracker.increase();
-                            } catch (const std::exception& e) {
-                                std::cout << e.what() << std::endl;
-                            }
-                        }
-                    );
-                    return false;
-                }
-            #endif
+            publishEvent(GameEventType::DefenseRequested, targetHero->getHeroName());
+            Decision defend{DecisionType::Defend, targetHero, items};
+            int choice = co_await ask(std::move(defend));
+            if (choice >= 0 && choice < static_cast<int>(items.size())) {
+                string itemName = items[choice].getItemName();
+                targetHero->removeItem(choice);
+                cout << targetHero->getHeroName() << " used a " << itemName << " to fend off the attack!\n";
+                publishEvent(GameEventType::HeroDefended, targetHero->getHeroName(), currentLocation->getName(), itemName);
+                co_return false;
+            }
+            cout << targetHero->getHeroName() << " did not use an item!\n";
         } else {
             cout << "You have no items to use!\n";
-            try {
-                auto hospital = map.getLocation("Hospital");
-                currentLocation->removeCharacter(targetHero->getHeroName());
-                hospital->addCharacter(targetHero->getHeroName());
-                targetHero->setCurrentLocation(hospital);
-                
-                #ifndef TERMINAL
-                    if (gameScreen) {
-                        gameScreen->addGameMessage(targetHero->getHeroName() + " had no items to defend with and was sent to the Hospital!");
-                    }
-                #endif
-                
-                terrorTracker.increase();
-                return true;
-            } catch (const exception& e) {
-                cout << e.what() << endl;
-            }
+        }
+
+        auto hospital = map.findLocation("Hospital");
+        if (hospital && currentLocation->tryRemoveCharacter(targetHero->getHeroName())) {
+            hospital->tryAddCharacter(targetHero->getHeroName());
+            targetHero->setCurrentLocation(hospital);
+            publishEvent(GameEventType::HeroHospitalized, targetHero->getHeroName(), "Hospital");
+            terrorTracker.increase();
+            co_return true;
         }
     } 
     else if (!targetVillager.empty()) {
-        currentLocation->removeCharacter(targetVillager);
+        publishEvent(GameEventType::MonsterAttack, targetVillager, currentLocation->getName());
+        currentLocation->tryRemoveCharacter(targetVillager);
         
-        try {
-            auto villager = villagerManager.getVillager(targetVillager);
-            villager->setCurrentLocation(nullptr);
-        } catch (const exception& e) {
-            cout << "Error removing villager from manager: " << e.what() << endl;
+        if (VillagerManager::isVillagerName(targetVillager)) {
+            villagerManager.killVillager(targetVillager, monsterName);
+        } else {
+            cout << "Error removing villager from manager: " << targetVillager << " is not a villager" << endl;
         }
         
-        #ifndef TERMINAL
-            if (gameScreen) {
-                gameScreen->addGameMessage(targetVillager + " was killed by " + monsterName + "!");
-            }
-        #endif
-        
         cout << targetVillager << " was killed by " << monsterName << "!\n";
         terrorTracker.increase();
         
-        return true;
+        co_return true;
     }
     
-    return false;
+    co_return false;
 }
 
 void Monster::moveTwoSteps() {
@@ -255,4 +225,4 @@ void Monster::moveTwoSteps() {
         setCurrentLocation(nextLoc);
         loc = nextLoc;
     }
-}
\ No newline at end of file
+}
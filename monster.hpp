@@ -1,6 +1,7 @@
 #ifndef MONSTER_HPP
 #define MONSTER_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -9,42 +10,51 @@
 #include <unordered_map>
 #include "location.hpp"
 #include "hero.hpp"
-#include "archeologist.hpp"
-#include "mayor.hpp"
-#include "courier.hpp"
-#include "scientist.hpp"
+#include "gameevents.hpp"
+#include "decision.hpp"
 
 class TerrorTracker;
 class Map;
 class VillagerManager;
 
-#ifndef TERMINAL
-class GameScreen;
-#endif
+// Like the heroes, the monsters are a closed set dispatched by kind
+enum class MonsterKind : std::uint8_t { Dracula, InvisibleMan };
 
 class Monster {
 public:
-    Monster(const std::string& monsterName, std::shared_ptr<Location> startingLocation);
+    Monster(MonsterKind kind, std::shared_ptr<Location> startingLocation);
     virtual ~Monster() = default;
 
-    virtual void power(Hero* hero, TerrorTracker& terrorTracker, VillagerManager& villagerManager) = 0;
-    bool attack(Hero* archeologist, Hero* mayor, Courier* courier, Scientist* scientist,
-                TerrorTracker& terrorTracker, Map& map, VillagerManager& villagerManager
-        #ifndef TERMINAL
-                , GameScreen* gameScreen
-        #endif
-    );
+    static const char* getKindName(MonsterKind kind);
 
+    // Forwarded to the monster's own power by kind
+    void power(Hero* hero, TerrorTracker& terrorTracker, VillagerManager& villagerManager);
+    // Returns true when the attack ends the monster phase. A hero with items
+    // is asked whether to defend, so this may suspend on a Decision.
+    DecisionTask<bool> attack(const HeroRoster& heroes, TerrorTracker& terrorTracker, Map& map, VillagerManager& villagerManager);
+
+    MonsterKind getKind() const { return kind; }
     std::string getMonsterName() const;
     std::shared_ptr<Location> getCurrentLocation() const;
+    // False once the monster has been taken off the board
+    bool isOnBoard() const { return currentLocation != nullptr; }
 
     void setCurrentLocation(std::shared_ptr<Location> currentLocation);
 
     void moveToNearestCharacter(const std::string& targetCharacter, int stepNumber);
     void moveTwoSteps();
+
+    // Attack and power outcomes are published here when set
+    void setEventSink(GameEventSink* sink);
+
 protected:
+    MonsterKind kind;
     std::string monsterName;
     std::shared_ptr<Location> currentLocation;
+    GameEventSink* eventSink = nullptr;
+
+    void publishEvent(GameEventType type, const std::string& target = "", const std::string& location = "",
+                      const std::string& detail = "");
 
     void setMonsterName(std::string monsterName);
 };
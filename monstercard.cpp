@@ -2,6 +2,8 @@
 
 using namespace std;
 
+MonsterCard::MonsterCard() : itemCount(0) {}
+
 MonsterCard::MonsterCard(const std::string& name, int itemCount, const string& eventText, const vector<Strike>& strikeList) : name(name), itemCount(itemCount), eventText(eventText), strikeList(strikeList) {}
 
 string MonsterCard::getName() const { return name; }
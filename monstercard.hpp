@@ -24,6 +24,7 @@ private:
     std::vector<Strike> strikeList;
 
 public:
+    MonsterCard();
     MonsterCard(const std::string& name, int itemCount, const std::string& eventText, const std::vector<Strike>& strikeList);
 
     std::string getName() const;
@@ -3,6 +3,7 @@
 #include "dice.hpp"
 #include "frenzymarker.hpp"
 #include "terrorteracker.hpp"
+#include "alloctracker.hpp"
 #include <algorithm>
 #include <iostream>
 
@@ -15,6 +16,28 @@ MonsterManager::MonsterManager() {
     shuffle();
 }
 
+void MonsterManager::setEventSink(GameEventSink* sink) {
+    eventSink = sink;
+}
+
+void MonsterManager::publishEvent(GameEventType type, const string& actor, const string& target, const string& location, const string& detail) {
+    if (eventSink) {
+        GameEvent event;
+        event.type = type;
+        event.actor = actor;
+        event.target = target;
+        event.location = location;
+        event.detail = detail;
+        eventSink->publish(event);
+    }
+}
+
+void MonsterManager::publishMove(Monster* monster, const shared_ptr<Location>& before) {
+    if (eventSink && monster && monster->getCurrentLocation() && monster->getCurrentLocation() != before) {
+        publishEvent(GameEventType::MonsterMoved, monster->getMonsterName(), "", monster->getCurrentLocation()->getName());
+    }
+}
+
 void MonsterManager::initializeDefaultCards() {
     cards.emplace_back(MonsterCard("Form Of The Bat", 2, "Move Dracula to hero location.", {
         {MonsterType::InvisibleMan, 1, 2}
@@ -95,11 +118,19 @@ void MonsterManager::initializeDefaultCards() {
     }));
 }
 
+void MonsterManager::seed(unsigned int seedValue) {
+    rng.seed(seedValue);
+    cards.clear();
+    initializeDefaultCards();
+    shuffle();
+}
+
 void MonsterManager::shuffle() {
     std::shuffle(cards.begin(), cards.end(), rng);
 }
 
 MonsterCard MonsterManager::drawCard() {
+    AllocPhaseScope allocScope(AllocPhase::Draw);
     if (isEmpty()) {
         throw runtime_error("No monster cards left!");
     }
@@ -117,17 +148,30 @@ bool MonsterManager::isEmpty() const {
     return cards.empty();
 }
 
-void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula, InvisibleMan* invisibleMan, FrenzyMarker& frenzyMarker, Hero* currentHero, TerrorTracker& terrorTracker, Archeologist* archeologist, Mayor* mayor, Courier* courier, Scientist* scientist, VillagerManager& villagerManager, std::vector<std::string>& diceResults
-    , PerkDeck* perkDeck, Hero* hero1, Hero* hero2
-    #ifndef TERMINAL
-        , GameScreen* gameScreen
-    #endif
-) {
+DecisionTask<void> MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula, InvisibleMan* invisibleMan, FrenzyMarker& frenzyMarker, Hero* currentHero, TerrorTracker& terrorTracker, HeroRoster heroes, VillagerManager& villagerManager, std::vector<std::string>& diceResults
+    , PerkDeck* perkDeck, Hero* hero1, Hero* hero2) {
+    // The caller sets the allocation phase: the task may be resumed on another thread
     diceResults.clear();
+    if (dracula) dracula->setEventSink(eventSink);
+    if (invisibleMan) invisibleMan->setEventSink(eventSink);
+
+    // Villager deaths and rescues during this phase go to the same sink as the
+    // monster events, so they reach the frontend in order; restored on exit.
+    struct VillagerSinkScope {
+        VillagerManager& manager;
+        GameEventSink* previous;
+        ~VillagerSinkScope() { manager.setEventSink(previous); }
+    } villagerSinkScope{villagerManager, villagerManager.getEventSink()};
+    villagerManager.setEventSink(eventSink);
+
     auto monsterCard = drawCard();
+    publishEvent(GameEventType::CardDrawn, "", "", "", monsterCard.getName());
 
     for (size_t i = 0; i < monsterCard.getItemCount(); ++i) {
-        itemBag.drawRandomItem(map);
+        Item placed = itemBag.drawRandomItem(map);
+        if (eventSink && placed.getLocation()) {
+            publishEvent(GameEventType::ItemPlaced, "", placed.getItemName(), placed.getLocation()->getName());
+        }
     }
 
     cout << monsterCard.getName() << endl;
@@ -142,11 +186,12 @@ void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula,
     }
 
     if (monsterCard.getName() == "Form Of The Bat") {
-        if (dracula != nullptr && archeologist && mayor && courier && scientist) {
+        if (dracula != nullptr) {
             auto currentHeroLocation = currentHero->getCurrentLocation();
             dracula->getCurrentLocation()->removeCharacter("Dracula");
             currentHeroLocation->addCharacter("Dracula");
             dracula->setCurrentLocation(currentHeroLocation);
+            publishEvent(GameEventType::MonsterMoved, "Dracula", "", currentHeroLocation->getName());
             cout << "Dracula moved to " << currentHeroLocation->getName() << "!\n";
         } else {
             cout << "Dracula is defeated.\n";
@@ -158,6 +203,7 @@ void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula,
             dracula->getCurrentLocation()->removeCharacter("Dracula");
             cryptLocation->addCharacter("Dracula");
             dracula->setCurrentLocation(cryptLocation);
+            publishEvent(GameEventType::MonsterMoved, "Dracula", "", "Crypt");
             cout << "Dracula moved to Crypt!\n";
         } else {
             cout << "Dracula is defeated.\n";
@@ -170,7 +216,10 @@ void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula,
                 invisibleMan->getCurrentLocation()->removeCharacter("Invisible man");
                 locationWithMostItems->addCharacter("Invisible man");
                 invisibleMan->setCurrentLocation(locationWithMostItems);
+                size_t stolenItems = locationWithMostItems->getItems().size();
                 locationWithMostItems->clearItems();
+                publishEvent(GameEventType::MonsterMoved, "Invisible man", "", locationWithMostItems->getName());
+                publishEvent(GameEventType::ItemsStolen, "Invisible man", "", locationWithMostItems->getName(), to_string(stolenItems));
                 cout << "Invisible man moved to " << locationWithMostItems->getName() << "!\n";
             } else {
                 cout << "No items found anywhere. Invisible man stays in place.\n";
@@ -183,42 +232,49 @@ void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula,
         auto docksLocation = map.getLocation("Docks");
         docksLocation->addCharacter("Wilbur And Chick");
         villagerManager.addVillager("Wilbur And Chick", docksLocation);
+        publishEvent(GameEventType::VillagerPlaced, "Wilbur And Chick", "", "Docks");
         cout << "Wilbur And Chick was placed in Docks!\n";
     }
     else if (monsterCard.getName() == "Fortune Teller") {
         auto campLocation = map.getLocation("Camp");
         campLocation->addCharacter("Maleva");
         villagerManager.addVillager("Maleva", campLocation);
+        publishEvent(GameEventType::VillagerPlaced, "Maleva", "", "Camp");
         cout << "Maleva was placed in Camp!\n";
     }
     else if (monsterCard.getName() == "Former Employer") {
         auto laboratoryLocation = map.getLocation("Laboratory");
         laboratoryLocation->addCharacter("Dr.Cranley");
         villagerManager.addVillager("Dr.Cranley", laboratoryLocation);
+        publishEvent(GameEventType::VillagerPlaced, "Dr.Cranley", "", "Laboratory");
         cout << "Dr.Cranley was placed in Laboratory!\n";
     }
     else if (monsterCard.getName() == "Hurried Assistant") {
         auto towerLocation = map.getLocation("Tower");
         towerLocation->addCharacter("Fritz");
         villagerManager.addVillager("Fritz", towerLocation);
+        publishEvent(GameEventType::VillagerPlaced, "Fritz", "", "Tower");
         cout << "Fritz was placed in Tower!\n";
     }
     else if (monsterCard.getName() == "The Innocent") {
         auto barnLocation = map.getLocation("Barn");
         barnLocation->addCharacter("Maria");
         villagerManager.addVillager("Maria", barnLocation);
+        publishEvent(GameEventType::VillagerPlaced, "Maria", "", "Barn");
         cout << "Maria was placed in Barn!\n";
     }
     else if (monsterCard.getName() == "Egyptian Expert") {
         auto caveLocation = map.getLocation("Cave");
         caveLocation->addCharacter("Prof.Pearson");
         villagerManager.addVillager("Prof.Pearson", caveLocation);
+        publishEvent(GameEventType::VillagerPlaced, "Prof.Pearson", "", "Cave");
         cout << "Prof.Pearson was placed in Cave!\n";
     }
     else if (monsterCard.getName() == "The Ichthyologist") {
         auto instituteLocation = map.getLocation("Institute");
         instituteLocation->addCharacter("Dr.Reed");
         villagerManager.addVillager("Dr.Reed", instituteLocation);
+        publishEvent(GameEventType::VillagerPlaced, "Dr.Reed", "", "Institute");
         cout << "Dr.Reed was placed in Institute!\n";
     }
     else if (monsterCard.getName() == "Hypnotic Gaze") {
@@ -245,33 +301,16 @@ void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula,
             if (closestLocation != nullptr && shortestDistance > 0) {
                 auto closerLocation = map.findCloserLocation(closestLocation, draculaLocation);
                 if (closerLocation != nullptr) {
-                    try {
-                        if (closestCharacter == "Archeologist" && archeologist) {
-                            archeologist->getCurrentLocation()->removeCharacter("Archeologist");
-                            closerLocation->addCharacter("Archeologist");
-                            archeologist->setCurrentLocation(closerLocation);
-                            cout << archeologist->getPlayerName() << " (Archeologist) moved to " << closerLocation->getName() << ".\n";
-                        } else if (closestCharacter == "Mayor" && mayor) {
-                            mayor->getCurrentLocation()->removeCharacter("Mayor");
-                            closerLocation->addCharacter("Mayor");
-                            mayor->setCurrentLocation(closerLocation);
-                            cout << mayor->getPlayerName() << " (Mayor) moved to " << closerLocation->getName() << ".\n";
-                        } else if (closestCharacter == "Courier" && courier) {
-                            courier->getCurrentLocation()->removeCharacter("Courier");
-                            closerLocation->addCharacter("Courier");
-                            courier->setCurrentLocation(closerLocation);
-                            cout << courier->getPlayerName() << " (Courier) moved to " << closerLocation->getName() << ".\n";
-                        } else if (closestCharacter == "Scientist" && scientist) {
-                            scientist->getCurrentLocation()->removeCharacter("Scientist");
-                            closerLocation->addCharacter("Scientist");
-                            scientist->setCurrentLocation(closerLocation);
-                            cout << scientist->getPlayerName() << " (Scientist) moved to " << closerLocation->getName() << ".\n";
-                        } else {
-                            auto villager = villagerManager.getVillager(closestCharacter);
-                            villager->moveByMonster(closerLocation, perkDeck, hero1, hero2);
+                    if (Hero* hero = heroes.find(closestCharacter)) {
+                        if (hero->getCurrentLocation()->tryRemoveCharacter(hero->getHeroName())) {
+                            closerLocation->tryAddCharacter(hero->getHeroName());
+                            hero->setCurrentLocation(closerLocation);
+                            cout << hero->getPlayerName() << " (" << hero->getHeroName() << ") moved to " << closerLocation->getName() << ".\n";
+                        }
+                    } else if (auto villager = villagerManager.findVillager(closestCharacter)) {
+                        if (villager->tryMoveByMonster(closerLocation, perkDeck, hero1, hero2)) {
+                            villagerManager.refreshVillager(closestCharacter);
                         }
-                    } catch (const exception& e) {
-                        cout << e.what() << endl;
                     }
                 }
             }
@@ -283,6 +322,7 @@ void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula,
         frenzyMarker.advance(dracula, invisibleMan);
         {
             Monster* fr = frenzyMarker.getCurrentFrenzied();
+            publishEvent(GameEventType::FrenzyChanged, fr ? fr->getMonsterName() : "");
             if (fr != nullptr) {
                 cout << "Frenzy marker was given to " << fr->getMonsterName() << "!\n";
             } else {
@@ -314,7 +354,9 @@ void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula,
         }
 
         if (monster != nullptr) {
+            auto before = monster->getCurrentLocation();
             monster->moveToNearestCharacter("*", strike.moveCount);
+            publishMove(monster, before);
         } else {
             continue;
         }
@@ -327,12 +369,17 @@ void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula,
             diceResults.push_back(face);
             dices.push_back(face);
         }
+        if (eventSink) {
+            string faces;
+            for (const auto& face : dices) faces += (faces.empty() ? "[" : " [") + face + "]";
+            publishEvent(GameEventType::DiceRolled, monster->getMonsterName(), "", "", faces);
+        }
 
         while (!dices.empty()) {
             auto attack = std::find(dices.begin(), dices.end(), "*");
             if (attack != dices.end()) {
                 if (monster != nullptr) {
-                    if (monster->attack(archeologist, mayor, courier, scientist, terrorTracker, map, villagerManager, gameScreen)) {
+                    if (co_await monster->attack(heroes, terrorTracker, map, villagerManager)) {
                         monsterPhaseEnding = true;
                         break;
                     }   
@@ -384,53 +431,35 @@ void MonsterManager::MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula,
     if (invisibleMan != nullptr) {
         if (invisibleManPowerDice > 0) {
             int totalSteps = invisibleManPowerDice * 2;
+            auto before = invisibleMan->getCurrentLocation();
             invisibleMan->moveTowardsVillager(totalSteps);
+            publishMove(invisibleMan, before);
         }
     } 
 } 
 
 void MonsterManager::moveVillagersCloserToSafePlaces(Map& map, VillagerManager& villagerManager, PerkDeck* perkDeck, Hero* hero1, Hero* hero2) {
-    unordered_map<string, string> safePlaces = {
-        {"Dr.Cranley", "Precinct"},
-        {"Dr.Reed", "Camp"},
-        {"Prof.Pearson", "Museum"},
-        {"Maleva", "Shop"},
-        {"Fritz", "Institute"},
-        {"Wilbur And Chick", "Dungeon"},
-        {"Maria", "Camp"}
-    };
-
-    unordered_set<string> movedVillagers;
-
-    for (const auto& [locName, location] : map.locations) {
-        auto chars = location->getCharacters();
+    const auto& villagers = villagerManager.getAllVillagers();
+    const auto& onBoard = villagerManager.getOnBoard();
 
-        for (const auto& character : chars) {
-            if (movedVillagers.find(character) != movedVillagers.end()) continue;
+    for (size_t id = 0; id < villagers.size(); ++id) {
+        if (!onBoard.test(id)) continue;
+        const auto& villager = villagers[id];
+        const string& character = VillagerManager::getVillagerName(id);
 
-            auto it = safePlaces.find(character);
-            if (it == safePlaces.end()) continue;
+        auto currentLocation = villager->getCurrentLocation();
+        if (!currentLocation) continue;
 
-            const string& safePlace = it->second;
+        auto safeLocation = map.findLocation(VillagerManager::getSafePlace(id));
+        if (!safeLocation || currentLocation == safeLocation) continue;
 
-            try {
-                auto villager = villagerManager.getVillager(character);
-                auto currentLocation = villager->getCurrentLocation();
-                if (!currentLocation) continue;
-
-                auto safeLocation = map.getLocation(safePlace);
-                if (!safeLocation) continue;
-
-                if (currentLocation == safeLocation) continue;
-
-                auto closerLocation = map.findCloserLocation(currentLocation, safeLocation);
-                if (closerLocation != nullptr && closerLocation != currentLocation) {
-                    villager->moveByMonster(closerLocation, perkDeck, hero1, hero2);
-                    movedVillagers.insert(character);
-                }
-            } catch (const exception& e) {
-                cerr << "Error moving villager " << character << ": " << e.what() << endl;
-                continue;
+        // Next hop comes from the map's precomputed route table
+        auto closerLocation = map.findCloserLocation(currentLocation, safeLocation);
+        if (closerLocation != nullptr && closerLocation != currentLocation) {
+            if (villager->tryMoveByMonster(closerLocation, perkDeck, hero1, hero2)) {
+                villagerManager.refreshVillager(character);
+            } else {
+                cerr << "Error moving villager " << character << ": not found in " << currentLocation->getName() << endl;
             }
         }
     }
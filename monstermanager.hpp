@@ -6,8 +6,8 @@
 #include "invisibleman.hpp"
 #include "hero.hpp"
 #include "frenzymarker.hpp"
-#include "archeologist.hpp"
-#include "mayor.hpp"
+#include "gameevents.hpp"
+#include "decision.hpp"
 #include <vector>
 #include <random>
 #include <chrono>
@@ -15,8 +15,6 @@
 using namespace std;
 
 class TerrorTracker;
-class Archeologist;
-class Mayor;
 class VillagerManager;
 class PerkDeck;
 class Hero;
@@ -27,19 +25,24 @@ private:
     std::mt19937 rng;
     MonsterCard currentCard;  
     bool hasCurrentCard;     
+    GameEventSink* eventSink = nullptr;
+
+    void publishEvent(GameEventType type, const string& actor, const string& target = "", const string& location = "", const string& detail = "");
+    void publishMove(Monster* monster, const shared_ptr<Location>& before);
 public:
     MonsterManager();
 
     void initializeDefaultCards();
+    void seed(unsigned int seedValue);
+    // Everything MonsterPhase does is also published here, in order (may be null)
+    void setEventSink(GameEventSink* sink);
     void shuffle();
     MonsterCard drawCard();
     bool isEmpty() const;
-    void MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula, InvisibleMan* invisibleMan, FrenzyMarker& frenzyMarker, Hero* currentHero, TerrorTracker& terrorTracker, Archeologist* archeologist, Mayor* mayor, Courier* courier, Scientist* scientist, VillagerManager& villagerManager, std::vector<std::string>& diceResults
-        , PerkDeck* perkDeck = nullptr, Hero* hero1 = nullptr, Hero* hero2 = nullptr
-        #ifndef TERMINAL
-                    , GameScreen* gameScreen = nullptr
-        #endif
-    );
+    // Suspends when an attacked hero has to choose how to defend. The references
+    // must outlive the task; the roster is copied in.
+    DecisionTask<void> MonsterPhase(Map& map, ItemBag& itemBag, Dracula* dracula, InvisibleMan* invisibleMan, FrenzyMarker& frenzyMarker, Hero* currentHero, TerrorTracker& terrorTracker, HeroRoster heroes, VillagerManager& villagerManager, std::vector<std::string>& diceResults
+        , PerkDeck* perkDeck = nullptr, Hero* hero1 = nullptr, Hero* hero2 = nullptr);
     void moveVillagersCloserToSafePlaces(Map& map, VillagerManager& villagerManager, PerkDeck* perkDeck = nullptr, Hero* hero1 = nullptr, Hero* hero2 = nullptr);
     
     const vector<MonsterCard>& getCards() const;
@@ -0,0 +1,180 @@
+// Builds the packed asset archive read by AssetArchive.
+//
+// Build (links raylib for image decoding, no window is opened):
+//   g++ -std=c++20 -O2 packassets.cpp assetarchive.cpp -lraylib -o packassets
+//
+// Usage:
+//   ./packassets [--root=DIR] [--out=FILE]
+//
+// Images under Horrified_Assets/, fonts/ and images/ are decoded to RGBA8 once
+// here so the game never decodes PNG/JPEG at startup. Fonts are stored as-is
+// and loaded with LoadFontFromMemory, since their atlas size depends on the window.
+
+#include "assetarchive.hpp"
+#include <raylib.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+namespace fs = std::filesystem;
+
+struct PackOptions {
+    string root = ".";
+    string outFile = AssetArchive::DEFAULT_FILE;
+};
+
+struct PackedAsset {
+    AssetArchive::Entry entry;
+    vector<unsigned char> bytes;
+};
+
+static bool hasExtension(const fs::path& path, const vector<string>& extensions) {
+    string extension = path.extension().string();
+    transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return find(extensions.begin(), extensions.end(), extension) != extensions.end();
+}
+
+static bool packImage(const fs::path& file, PackedAsset& asset) {
+    Image image = LoadImage(file.string().c_str());
+    if (image.data == nullptr) return false;
+
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    size_t size = (size_t)GetPixelDataSize(image.width, image.height, image.format);
+    const unsigned char* pixels = static_cast<const unsigned char*>(image.data);
+    asset.bytes.assign(pixels, pixels + size);
+    asset.entry.kind = AssetArchive::IMAGE_ENTRY;
+    asset.entry.width = image.width;
+    asset.entry.height = image.height;
+    asset.entry.format = image.format;
+    UnloadImage(image);
+    return true;
+}
+
+static bool packFile(const fs::path& file, PackedAsset& asset) {
+    ifstream in(file, ios::binary);
+    if (!in) return false;
+
+    asset.bytes.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    asset.entry.kind = AssetArchive::FILE_ENTRY;
+    return true;
+}
+
+static vector<PackedAsset> collectAssets(const fs::path& root) {
+    vector<PackedAsset> assets;
+    for (const string folder : {"Horrified_Assets", "fonts", "images"}) {
+        fs::path directory = root / folder;
+        if (!fs::is_directory(directory)) {
+            cout << "Skipping missing folder: " << directory.string() << endl;
+            continue;
+        }
+
+        vector<fs::path> files;
+        for (const auto& item : fs::recursive_directory_iterator(directory)) {
+            if (item.is_regular_file()) files.push_back(item.path());
+        }
+        sort(files.begin(), files.end());  // stable archive contents between runs
+
+        for (const auto& file : files) {
+            // Entries are named by the same relative path the game asks for
+            string name = fs::relative(file, root).generic_string();
+            if (name.size() >= AssetArchive::NAME_SIZE) {
+                cout << "Skipping (name too long): " << name << endl;
+                continue;
+            }
+
+            PackedAsset asset{};
+            bool packed = false;
+            if (hasExtension(file, {".png", ".jpg", ".jpeg", ".bmp"})) {
+                packed = packImage(file, asset);
+            } else if (hasExtension(file, {".ttf", ".otf"})) {
+                packed = packFile(file, asset);
+            } else {
+                continue;
+            }
+
+            if (!packed) {
+                cout << "Failed to pack: " << name << endl;
+                continue;
+            }
+            strncpy(asset.entry.name, name.c_str(), AssetArchive::NAME_SIZE - 1);
+            asset.entry.size = asset.bytes.size();
+            assets.push_back(move(asset));
+        }
+    }
+    return assets;
+}
+
+static bool writeArchive(const string& outFile, vector<PackedAsset>& assets) {
+    auto align = [](uint64_t offset) {
+        return (offset + AssetArchive::DATA_ALIGNMENT - 1) / AssetArchive::DATA_ALIGNMENT * AssetArchive::DATA_ALIGNMENT;
+    };
+
+    AssetArchive::Header header{};
+    memcpy(header.magic, AssetArchive::MAGIC, sizeof(header.magic));
+    header.version = AssetArchive::VERSION;
+    header.entryCount = (uint32_t)assets.size();
+
+    uint64_t offset = align(sizeof(AssetArchive::Header) + assets.size() * sizeof(AssetArchive::Entry));
+    for (auto& asset : assets) {
+        asset.entry.offset = offset;
+        offset = align(offset + asset.entry.size);
+    }
+
+    ofstream out(outFile, ios::binary | ios::trunc);
+    if (!out) {
+        cerr << "Cannot write " << outFile << endl;
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& asset : assets) {
+        out.write(reinterpret_cast<const char*>(&asset.entry), sizeof(asset.entry));
+    }
+    const char padding[AssetArchive::DATA_ALIGNMENT] = {};
+    for (const auto& asset : assets) {
+        out.write(padding, asset.entry.offset - (uint64_t)out.tellp());
+        out.write(reinterpret_cast<const char*>(asset.bytes.data()), asset.bytes.size());
+    }
+    return (bool)out;
+}
+
+static bool parseOptions(int argc, char** argv, PackOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        auto value = [&](const string& prefix) { return arg.substr(prefix.size()); };
+        if (arg.rfind("--root=", 0) == 0) options.root = value("--root=");
+        else if (arg.rfind("--out=", 0) == 0) options.outFile = value("--out=");
+        else {
+            cerr << "Unknown option: " << arg << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    PackOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        cerr << "Usage: packassets [--root=DIR] [--out=FILE]" << endl;
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    vector<PackedAsset> assets = collectAssets(options.root);
+    if (assets.empty()) {
+        cerr << "No assets found under " << options.root << endl;
+        return 1;
+    }
+    if (!writeArchive(options.outFile, assets)) {
+        return 1;
+    }
+
+    uint64_t totalBytes = 0;
+    for (const auto& asset : assets) totalBytes += asset.entry.size;
+    cout << "Packed " << assets.size() << " assets (" << totalBytes / 1024 << " KiB) into " << options.outFile << endl;
+    return 0;
+}
@@ -1,5 +1,5 @@
 #include <iostream>
-#include "PerkCard.hpp"
+#include "perkcard.hpp"
 
 using namespace std;
 
@@ -36,7 +36,7 @@ string PerkCard::getDescription() const {
 
 string PerkCard::perkTypeToString(PerkType type) {
     switch (type) {
-        case PerkType::VisitFromDetective: return "Visit from the Detective";
+        case PerkType::VisitFromTheDetective: return "Visit from the Detective";
         case PerkType::BreakOfDawn: return "Break of Dawn";
         case PerkType::Overstock: return "Overstock";
         case PerkType::LateIntoTheNight: return "Late into the Night";
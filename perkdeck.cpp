@@ -1,4 +1,5 @@
 #include "perkdeck.hpp"
+#include "alloctracker.hpp"
 #include <algorithm>
 #include <iostream>
 
@@ -23,11 +24,19 @@ void PerkDeck::initializeDefaultCards() {
     }
 }
 
+void PerkDeck::seed(unsigned int seedValue) {
+    rng.seed(seedValue);
+    cards.clear();
+    initializeDefaultCards();
+    shuffle();
+}
+
 void PerkDeck::shuffle() {
     std::shuffle(cards.begin(), cards.end(), rng);
 }
 
 PerkCard PerkDeck::drawRandomCard() {
+    AllocPhaseScope allocScope(AllocPhase::Draw);
     if (isEmpty()) {
         throw runtime_error("No perk cards left!");
     }
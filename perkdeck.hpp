@@ -17,6 +17,7 @@ public:
     PerkDeck();
     
     void initializeDefaultCards();
+    void seed(unsigned int seedValue);
     void shuffle();
     PerkCard drawRandomCard();
     bool isEmpty() const;
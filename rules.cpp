@@ -0,0 +1,4 @@
+#include "rules.hpp"
+
+// The one definition every file's rule set check links against
+const int RULES_LINK_CHECK(RULESET) = 0;
@@ -0,0 +1,60 @@
+#ifndef RULES_HPP
+#define RULES_HPP
+
+// Numbers from the rule book. The engine reads them only through Rules, so
+// they fold into constants. A rule variant is another struct with the same
+// members, picked at build time with -DRULESET=VariantRules; each build is
+// then its own fully constant engine, with no runtime branching on rules.
+// RULESET must be the same for every file of a build: rules.cpp and every
+// file that includes this header agree on it at link time (see below).
+struct StandardRules {
+    // The monsters win when terror reaches this level
+    static constexpr int TERROR_LIMIT = 5;
+
+    static constexpr int COFFIN_STRENGTH = 6;
+    static constexpr int DRACULA_DEFEAT_STRENGTH = 6;
+    static constexpr int INVISIBLE_MAN_DEFEAT_STRENGTH = 9;
+
+    static constexpr int ARCHEOLOGIST_ACTIONS = 4;
+    static constexpr int MAYOR_ACTIONS = 5;
+    static constexpr int COURIER_ACTIONS = 4;
+    static constexpr int SCIENTIST_ACTIONS = 4;
+
+    // Items drawn onto the board when the bag is first filled
+    static constexpr int STARTING_ITEMS = 12;
+
+    // Monster dice have one power face, one strike face and the rest empty
+    static constexpr int DICE_SIDES = 6;
+};
+
+// A shorter, harsher game: less terror to lose and fewer items to start with
+struct HardRules : StandardRules {
+    static constexpr int TERROR_LIMIT = 4;
+    static constexpr int STARTING_ITEMS = 9;
+};
+
+#ifndef RULESET
+#define RULESET StandardRules
+#endif
+
+using Rules = RULESET;
+
+#define RULES_STRINGIFY_(name) #name
+#define RULES_STRINGIFY(name) RULES_STRINGIFY_(name)
+// Name of the rule set this build was compiled with, for reports
+inline constexpr const char* RULESET_NAME = RULES_STRINGIFY(RULESET);
+
+// Each file that includes this header refers to a symbol named after its
+// rule set, and only rules.cpp defines one. Files built with different
+// -DRULESET values then fail to link instead of mixing two rule books.
+#define RULES_LINK_CHECK_(name) rulesLinkCheck##name
+#define RULES_LINK_CHECK(name) RULES_LINK_CHECK_(name)
+extern const int RULES_LINK_CHECK(RULESET);
+namespace {
+[[maybe_unused, gnu::used]] const int* const rulesLinkCheck = &RULES_LINK_CHECK(RULESET);
+}
+
+static_assert(Rules::TERROR_LIMIT > 0, "Terror limit must be positive");
+static_assert(Rules::DICE_SIDES >= 2, "Dice need a power face and a strike face");
+
+#endif
@@ -7,8 +7,8 @@ class Scientist : public Hero {
 public:
     Scientist(const std::string& playerName, std::shared_ptr<Location> startingLocation);
 
-    void specialAction() override;
-    void ability(size_t index) override;
+    void specialAction();
+    void ability(size_t index);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef SMALLVECTOR_HPP
+#define SMALLVECTOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+// Vector with its storage inline and a fixed capacity, for short lists that
+// are rebuilt often. Never allocates; pushing past Capacity throws.
+template <typename T, std::size_t Capacity>
+class SmallVector {
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    void push_back(T value) {
+        if (count == Capacity) {
+            throw std::length_error("SmallVector capacity exceeded");
+        }
+        slots[count++] = std::move(value);
+    }
+
+    T& back() { return slots[count - 1]; }
+    T& operator[](std::size_t index) { return slots[index]; }
+    const T& operator[](std::size_t index) const { return slots[index]; }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    void clear() {
+        for (std::size_t i = 0; i < count; ++i) slots[i] = T();
+        count = 0;
+    }
+
+    iterator begin() { return slots.data(); }
+    iterator end() { return slots.data() + count; }
+    const_iterator begin() const { return slots.data(); }
+    const_iterator end() const { return slots.data() + count; }
+
+private:
+    std::array<T, Capacity> slots{};
+    std::size_t count = 0;
+};
+
+#endif
@@ -0,0 +1,107 @@
+#include "spriteatlas.hpp"
+#include <iostream>
+
+using namespace std;
+
+Sprite Sprite::fromTexture(const Texture2D& texture) {
+    Sprite sprite;
+    sprite.texture = texture;
+    sprite.source = {0, 0, (float)texture.width, (float)texture.height};
+    return sprite;
+}
+
+bool SpriteAtlas::add(const string& name, const string& imagePath) {
+    if (!FileExists(imagePath.c_str())) {
+        return false;
+    }
+    return addImage(name, LoadImage(imagePath.c_str()));
+}
+
+bool SpriteAtlas::addImage(const string& name, Image image) {
+    if (image.data == nullptr || image.width <= 0 || image.height <= 0) {
+        if (image.data != nullptr) UnloadImage(image);
+        return false;
+    }
+
+    // Shrink to fit one cell, keeping the aspect ratio
+    int maxSize = CELL_SIZE - 2 * CELL_PADDING;
+    if (image.width > maxSize || image.height > maxSize) {
+        float scale = (float)maxSize / (float)(image.width > image.height ? image.width : image.height);
+        int width = (int)(image.width * scale);
+        int height = (int)(image.height * scale);
+        ImageResize(&image, width > 0 ? width : 1, height > 0 ? height : 1);
+    }
+
+    pendingImages.push_back({name, image});
+    return true;
+}
+
+bool SpriteAtlas::build() {
+    if (texture.id != 0) {
+        UnloadTexture(texture);
+        texture = {};
+    }
+    regions.clear();
+    if (pendingImages.empty()) {
+        return false;
+    }
+
+    int rows = ((int)pendingImages.size() + COLUMNS - 1) / COLUMNS;
+    Image page = GenImageColor(COLUMNS * CELL_SIZE, rows * CELL_SIZE, BLANK);
+
+    for (size_t i = 0; i < pendingImages.size(); ++i) {
+        const Image& image = pendingImages[i].image;
+        float x = (float)((i % COLUMNS) * CELL_SIZE + CELL_PADDING);
+        float y = (float)((i / COLUMNS) * CELL_SIZE + CELL_PADDING);
+        Rectangle source = {0, 0, (float)image.width, (float)image.height};
+        Rectangle destination = {x, y, (float)image.width, (float)image.height};
+        ImageDraw(&page, image, source, destination, WHITE);
+        regions[pendingImages[i].name] = destination;
+        UnloadImage(image);
+    }
+    pendingImages.clear();
+
+    texture = LoadTextureFromImage(page);
+    UnloadImage(page);
+    if (texture.id == 0) {
+        regions.clear();
+        return false;
+    }
+    SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+    cout << "Built sprite atlas: " << regions.size() << " sprites in " << texture.width << "x" << texture.height << endl;
+    return true;
+}
+
+void SpriteAtlas::unload() {
+    for (auto& pending : pendingImages) {
+        UnloadImage(pending.image);
+    }
+    pendingImages.clear();
+    if (texture.id != 0) {
+        UnloadTexture(texture);
+    }
+    texture = {};
+    regions.clear();
+}
+
+bool SpriteAtlas::contains(const string& name) const {
+    return regions.find(name) != regions.end();
+}
+
+Sprite SpriteAtlas::getSprite(const string& name) const {
+    Sprite sprite;
+    auto it = regions.find(name);
+    if (it != regions.end()) {
+        sprite.texture = texture;
+        sprite.source = it->second;
+    }
+    return sprite;
+}
+
+const Texture2D& SpriteAtlas::getTexture() const {
+    return texture;
+}
+
+size_t SpriteAtlas::size() const {
+    return regions.size();
+}
@@ -0,0 +1,49 @@
+#ifndef SPRITEATLAS_HPP
+#define SPRITEATLAS_HPP
+
+#include <raylib.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A region of a texture. Atlas sprites all share the atlas texture.
+struct Sprite {
+    Texture2D texture = {};
+    Rectangle source = {0, 0, 0, 0};
+
+    bool isValid() const { return texture.id != 0; }
+    static Sprite fromTexture(const Texture2D& texture);
+};
+
+// Packs the small map sprites (heroes, monsters, villagers, items, coffins)
+// into one texture so the map layer is drawn without texture switches.
+class SpriteAtlas {
+public:
+    static const int CELL_SIZE = 256;
+    static const int CELL_PADDING = 2;
+    static const int COLUMNS = 8;
+
+    // Decodes the image on the CPU; nothing is uploaded until build()
+    bool add(const std::string& name, const std::string& imagePath);
+    // Takes ownership of an image that was already decoded (e.g. by AssetLoader)
+    bool addImage(const std::string& name, Image image);
+    bool build();
+    void unload();
+
+    bool contains(const std::string& name) const;
+    Sprite getSprite(const std::string& name) const;
+    const Texture2D& getTexture() const;
+    size_t size() const;
+
+private:
+    struct PendingImage {
+        std::string name;
+        Image image;
+    };
+
+    std::vector<PendingImage> pendingImages;
+    std::unordered_map<std::string, Rectangle> regions;
+    Texture2D texture = {};
+};
+
+#endif
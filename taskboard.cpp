@@ -1,52 +1,88 @@
 #include "taskboard.hpp"
+#include "rules.hpp"
 #include <iostream>
+#include <stdexcept>
 
 using namespace std;
 
-TaskBoard::TaskBoard() {
-    draculaCoffins["Cave"] = {};
-    draculaCoffins["Dungeon"] = {};
-    draculaCoffins["Crypt"] = {};
-    draculaCoffins["Graveyard"] = {};
+static const array<string, TaskBoard::COFFIN_COUNT> coffinLocations = {
+    "Cave", "Dungeon", "Crypt", "Graveyard"
+};
 
-    invisibleManCluesDelivered["Inn"] = false;
-    invisibleManCluesDelivered["Mansion"] = false;
-    invisibleManCluesDelivered["Barn"] = false;
-    invisibleManCluesDelivered["Laboratory"] = false;
-    invisibleManCluesDelivered["Institute"] = false;
+static const array<string, TaskBoard::CLUE_COUNT> clueLocations = {
+    "Inn", "Mansion", "Barn", "Laboratory", "Institute"
+};
+
+static const uint8_t ALL_COFFINS = (1u << TaskBoard::COFFIN_COUNT) - 1;
+static const uint8_t ALL_CLUES = (1u << TaskBoard::CLUE_COUNT) - 1;
+
+TaskBoard::TaskBoard() {}
+
+size_t TaskBoard::getCoffinId(const string& location) {
+    for (size_t id = 0; id < COFFIN_COUNT; ++id) {
+        if (coffinLocations[id] == location) return id;
+    }
+    return NO_TASK;
 }
 
-void TaskBoard::addStrengthToCoffin(const string& location, int strength) {
-    auto it = draculaCoffins.find(location);
-    if (it != draculaCoffins.end() && !it->second.completed) {
-        it->second.currentStrength += strength;
-        if (it->second.currentStrength >= 6) {
-            it->second.completed = true;
-        }
+size_t TaskBoard::getClueId(const string& location) {
+    for (size_t id = 0; id < CLUE_COUNT; ++id) {
+        if (clueLocations[id] == location) return id;
     }
+    return NO_TASK;
 }
 
-bool TaskBoard::isCoffinLocation(const string& location) const {
-    return draculaCoffins.count(location) > 0;
+const string& TaskBoard::getCoffinLocation(size_t coffinId) {
+    if (coffinId >= COFFIN_COUNT) {
+        throw out_of_range("Invalid coffin id");
+    }
+    return coffinLocations[coffinId];
 }
 
-bool TaskBoard::isCoffinDestroyed(const string& location) const {
-    auto it = draculaCoffins.find(location);
-    if (it == draculaCoffins.end()) return true;
-    return it->second.completed;
+const string& TaskBoard::getClueLocation(size_t clueId) {
+    if (clueId >= CLUE_COUNT) {
+        throw out_of_range("Invalid clue id");
+    }
+    return clueLocations[clueId];
 }
 
-bool TaskBoard::allCoffinsDestroyed() const {
-    for (const auto& [_, status] : draculaCoffins) {
-        if (!status.completed) return false;
+void TaskBoard::addStrengthToCoffin(size_t coffinId, int strength) {
+    if (coffinId >= COFFIN_COUNT || isCoffinDestroyed(coffinId)) return;
+    coffinStrengths[coffinId] += strength;
+    if (coffinStrengths[coffinId] >= Rules::COFFIN_STRENGTH) {
+        destroyedCoffins |= 1u << coffinId;
     }
-    return true;
+}
+
+bool TaskBoard::isCoffinDestroyed(size_t coffinId) const {
+    if (coffinId >= COFFIN_COUNT) return true;
+    return destroyedCoffins & (1u << coffinId);
+}
+
+int TaskBoard::getCoffinStrength(size_t coffinId) const {
+    return coffinId < COFFIN_COUNT ? coffinStrengths[coffinId] : 0;
+}
+
+bool TaskBoard::allCoffinsDestroyed() const {
+    return destroyedCoffins == ALL_COFFINS;
+}
+
+void TaskBoard::addStrengthToCoffin(const string& location, int strength) {
+    addStrengthToCoffin(getCoffinId(location), strength);
+}
+
+bool TaskBoard::isCoffinLocation(const string& location) const {
+    return getCoffinId(location) != NO_TASK;
+}
+
+bool TaskBoard::isCoffinDestroyed(const string& location) const {
+    return isCoffinDestroyed(getCoffinId(location));
 }
 
 void TaskBoard::addStrengthToDracula(int strength) {
     if (!draculaDefeat.completed) {
         draculaDefeat.currentStrength += strength;
-        if (draculaDefeat.currentStrength >= 6) {
+        if (draculaDefeat.currentStrength >= Rules::DRACULA_DEFEAT_STRENGTH) {
             draculaDefeat.completed = true;
         }
     }
@@ -62,37 +98,41 @@ bool TaskBoard::isDraculaDefeated() const {
 
 string TaskBoard::getDraculaTaskStatus() const {
     string status = "Dracula Coffins:\n";
-    for (const auto& [loc, task_status] : draculaCoffins) {
-        status += "- " + loc + ": " + to_string(task_status.currentStrength) + "/6 Strength " 
-                  + (task_status.completed ? "(Destroyed)" : "(Active)") + "\n";
+    for (size_t id = 0; id < COFFIN_COUNT; ++id) {
+        status += "- " + coffinLocations[id] + ": " + to_string(coffinStrengths[id]) + "/" + to_string(Rules::COFFIN_STRENGTH) + " Strength " 
+                  + (isCoffinDestroyed(id) ? "(Destroyed)" : "(Active)") + "\n";
     }
-    status += "Defeat Dracula: " + to_string(draculaDefeat.currentStrength) + "/6 Strength "
+    status += "Defeat Dracula: " + to_string(draculaDefeat.currentStrength) + "/" + to_string(Rules::DRACULA_DEFEAT_STRENGTH) + " Strength "
               + (draculaDefeat.completed ? "(Defeated)" : "") + "\n";
     return status;
 }
 
+bool TaskBoard::isClueDelivered(size_t clueId) const {
+    return clueId < CLUE_COUNT && (deliveredClues & (1u << clueId));
+}
+
+void TaskBoard::deliverClue(size_t clueId) {
+    if (clueId < CLUE_COUNT) {
+        deliveredClues |= 1u << clueId;
+    }
+}
+
 bool TaskBoard::isClueDelivered(const string& location) const {
-    auto it = invisibleManCluesDelivered.find(location);
-    return it != invisibleManCluesDelivered.end() && it->second;
+    return isClueDelivered(getClueId(location));
 }
 
 void TaskBoard::deliverClue(const string& location) {
-    if (invisibleManCluesDelivered.count(location)) {
-        invisibleManCluesDelivered[location] = true;
-    }
+    deliverClue(getClueId(location));
 }
 
 bool TaskBoard::allCluesDelivered() const {
-    for (const auto& [_, delivered] : invisibleManCluesDelivered) {
-        if (!delivered) return false;
-    }
-    return true;
+    return deliveredClues == ALL_CLUES;
 }
 
 void TaskBoard::addStrengthToInvisibleMan(int strength) {
     if (!invisibleManDefeated) {
         invisibleManDefeat.currentStrength += strength;
-        if (invisibleManDefeat.currentStrength >= 9) {
+        if (invisibleManDefeat.currentStrength >= Rules::INVISIBLE_MAN_DEFEAT_STRENGTH) {
             invisibleManDefeat.completed = true;
             invisibleManDefeated = true;
         }
@@ -114,20 +154,28 @@ bool TaskBoard::isInvisibleManDefeated() const {
 
 std::string TaskBoard::getInvisibleManClueStatus() const {
     std::string status = "Invisible Man Evidences Delivered:\n";
-    for (const auto& [loc, delivered] : invisibleManCluesDelivered) {
-        status += "- " + loc + ": " + (delivered ? "Delivered" : "Missing") + "\n";
+    for (size_t id = 0; id < CLUE_COUNT; ++id) {
+        status += "- " + clueLocations[id] + ": " + (isClueDelivered(id) ? "Delivered" : "Missing") + "\n";
     }
-    status += "Defeat Invisible Man: " + std::to_string(invisibleManDefeat.currentStrength) + "/9 Red Strength "
+    status += "Defeat Invisible Man: " + std::to_string(invisibleManDefeat.currentStrength) + "/" + std::to_string(Rules::INVISIBLE_MAN_DEFEAT_STRENGTH) + " Red Strength "
               + (invisibleManDefeated ? "(Defeated)" : "") + "\n";
     return status;
 }
 
-const unordered_map<string, TaskStatus>& TaskBoard::getDraculaCoffins() const {
-    return draculaCoffins;
+unordered_map<string, TaskStatus> TaskBoard::getDraculaCoffins() const {
+    unordered_map<string, TaskStatus> coffins;
+    for (size_t id = 0; id < COFFIN_COUNT; ++id) {
+        coffins[coffinLocations[id]] = {coffinStrengths[id], isCoffinDestroyed(id)};
+    }
+    return coffins;
 }
 
-const unordered_map<string, bool>& TaskBoard::getInvisibleManCluesDelivered() const {
-    return invisibleManCluesDelivered;
+unordered_map<string, bool> TaskBoard::getInvisibleManCluesDelivered() const {
+    unordered_map<string, bool> clues;
+    for (size_t id = 0; id < CLUE_COUNT; ++id) {
+        clues[clueLocations[id]] = isClueDelivered(id);
+    }
+    return clues;
 }
 
 const TaskStatus& TaskBoard::getDraculaDefeat() const {
@@ -143,11 +191,22 @@ bool TaskBoard::getInvisibleManDefeated() const {
 }
 
 void TaskBoard::setDraculaCoffins(const std::unordered_map<std::string, TaskStatus>& coffins) {
-    draculaCoffins = coffins;
+    coffinStrengths.fill(0);
+    destroyedCoffins = 0;
+    for (const auto& [location, status] : coffins) {
+        size_t id = getCoffinId(location);
+        if (id == NO_TASK) continue;
+        coffinStrengths[id] = status.currentStrength;
+        if (status.completed) destroyedCoffins |= 1u << id;
+    }
 }
 
 void TaskBoard::setInvisibleManCluesDelivered(const std::unordered_map<std::string, bool>& clues) {
-    invisibleManCluesDelivered = clues;
+    deliveredClues = 0;
+    for (const auto& [location, delivered] : clues) {
+        size_t id = getClueId(location);
+        if (id != NO_TASK && delivered) deliveredClues |= 1u << id;
+    }
 }
 
 void TaskBoard::setDraculaDefeat(const TaskStatus& defeat) {
@@ -1,6 +1,9 @@
 #ifndef TASKBOARD_HPP
 #define TASKBOARD_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 
@@ -10,9 +13,16 @@ struct TaskStatus {
 };
 
 class TaskBoard {
+public:
+    static const std::size_t COFFIN_COUNT = 4;
+    static const std::size_t CLUE_COUNT = 5;
+    static const std::size_t NO_TASK = static_cast<std::size_t>(-1);
+
 private:
-    std::unordered_map<std::string, TaskStatus> draculaCoffins;  
-    std::unordered_map<std::string, bool> invisibleManCluesDelivered;
+    // Coffins and clues are indexed by their task id; a set bit means done
+    std::array<int, COFFIN_COUNT> coffinStrengths{};
+    std::uint8_t destroyedCoffins = 0;
+    std::uint8_t deliveredClues = 0;
     TaskStatus draculaDefeat;
     TaskStatus invisibleManDefeat;
     bool invisibleManDefeated = false;
@@ -20,15 +30,30 @@ private:
 public:
     TaskBoard();
 
+    // Coffin ids: Cave, Dungeon, Crypt, Graveyard
+    // Clue ids: Inn, Mansion, Barn, Laboratory, Institute
+    // Both lookups return NO_TASK for other locations
+    static std::size_t getCoffinId(const std::string& location);
+    static std::size_t getClueId(const std::string& location);
+    static const std::string& getCoffinLocation(std::size_t coffinId);
+    static const std::string& getClueLocation(std::size_t clueId);
+
+    void addStrengthToCoffin(std::size_t coffinId, int strength);
+    bool isCoffinDestroyed(std::size_t coffinId) const;
+    int getCoffinStrength(std::size_t coffinId) const;
+    bool allCoffinsDestroyed() const;
+
+    // Location name adapters for the id based calls
     void addStrengthToCoffin(const std::string& location, int strength);
     bool isCoffinLocation(const std::string& location) const;
     bool isCoffinDestroyed(const std::string& location) const;
-    bool allCoffinsDestroyed() const;
 
     void addStrengthToDracula(int strength);
     int getDraculaDefeatStrength() const;
     bool isDraculaDefeated() const;
 
+    bool isClueDelivered(std::size_t clueId) const;
+    void deliverClue(std::size_t clueId);
     bool isClueDelivered(const std::string& location) const;
     void deliverClue(const std::string& location);
     bool allCluesDelivered() const;
@@ -40,8 +65,9 @@ public:
     std::string getDraculaTaskStatus() const;
     std::string getInvisibleManClueStatus() const;
     
-    const std::unordered_map<std::string, TaskStatus>& getDraculaCoffins() const;
-    const std::unordered_map<std::string, bool>& getInvisibleManCluesDelivered() const;
+    // Keyed by location name, built on demand for saving
+    std::unordered_map<std::string, TaskStatus> getDraculaCoffins() const;
+    std::unordered_map<std::string, bool> getInvisibleManCluesDelivered() const;
     const TaskStatus& getDraculaDefeat() const;
     const TaskStatus& getInvisibleManDefeat() const;
     bool getInvisibleManDefeated() const;
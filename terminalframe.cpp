@@ -0,0 +1,229 @@
+#include "terminalframe.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <iostream>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+static const char CLEAR_AND_HOME[] = "\x1b[H\x1b[2J";
+static const char HOME[] = "\x1b[H";
+static const char CLEAR_LINE_END[] = "\x1b[K";
+static const char CLEAR_BELOW[] = "\x1b[J";
+
+TerminalFrame::TerminalFrame() : buffer(current), stream(&buffer), outputCounter(*this), inputCounter(*this) {
+    current.reserve(RESERVED_BYTES);
+    previous.reserve(RESERVED_BYTES);
+    output.reserve(RESERVED_BYTES);
+#ifdef _WIN32
+    // Windows consoles only interpret ANSI escapes once asked to
+    HANDLE console = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD mode = 0;
+    if (GetConsoleMode(console, &mode)) {
+        SetConsoleMode(console, mode | 0x0004);  // ENABLE_VIRTUAL_TERMINAL_PROCESSING
+    }
+#endif
+}
+
+TerminalFrame::~TerminalFrame() {
+    outputCounter.detach(cout);
+    inputCounter.detach(cin);
+}
+
+TerminalFrame::FrameBuffer::int_type TerminalFrame::FrameBuffer::overflow(int_type ch) {
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        target->push_back(traits_type::to_char_type(ch));
+    }
+    return traits_type::not_eof(ch);
+}
+
+streamsize TerminalFrame::FrameBuffer::xsputn(const char* data, streamsize count) {
+    target->append(data, (size_t)count);
+    return count;
+}
+
+void TerminalFrame::RowCounter::attach(ios& stream) {
+    if (stream.rdbuf() == this) return;
+    source = stream.rdbuf(this);
+}
+
+void TerminalFrame::RowCounter::detach(ios& stream) {
+    if (stream.rdbuf() == this) stream.rdbuf(source);
+}
+
+TerminalFrame::RowCounter::int_type TerminalFrame::RowCounter::overflow(int_type ch) {
+    if (traits_type::eq_int_type(ch, traits_type::eof())) return traits_type::not_eof(ch);
+    frame->countOutside(traits_type::to_char_type(ch));
+    return source->sputc(traits_type::to_char_type(ch));
+}
+
+streamsize TerminalFrame::RowCounter::xsputn(const char* data, streamsize count) {
+    for (streamsize i = 0; i < count; ++i) frame->countOutside(data[i]);
+    return source->sputn(data, count);
+}
+
+// Hands input on one character at a time; a terminal echoes each one below the frame
+TerminalFrame::RowCounter::int_type TerminalFrame::RowCounter::underflow() {
+    int_type ch = source->sbumpc();
+    if (traits_type::eq_int_type(ch, traits_type::eof())) return ch;
+    held = traits_type::to_char_type(ch);
+    frame->countOutside(held);
+    setg(&held, &held, &held + 1);
+    return ch;
+}
+
+int TerminalFrame::RowCounter::sync() {
+    return source->pubsync();
+}
+
+ostream& TerminalFrame::begin() {
+    current.clear();
+    buffer.retarget(current);
+    stream.clear();
+    return stream;
+}
+
+void TerminalFrame::present() {
+    output.clear();
+    if (!isTerminal()) {
+        // Redirected output gets plain text, no escapes
+        output.append(current);
+        previousOnScreen = false;
+    } else {
+        // The previous frame is still at the top while nothing below it reached the last row
+        size_t rows = (size_t)max(terminalRows(), 0);
+        size_t lines = (size_t)count(current.begin(), current.end(), '\n');
+        if (previousOnScreen && previousRows + rowsOutside < rows && lines < rows) {
+            appendChangedLines();
+        } else {
+            appendFullFrame();
+        }
+        previousOnScreen = true;
+        previousRows = lines;
+        outputCounter.attach(cout);
+        inputCounter.attach(cin);
+    }
+
+    // Anything still buffered in cout belongs before the frame
+    cout.flush();
+    writeOut(output);
+    rowsOutside = 0;
+    column = 0;
+    columns = terminalColumns();
+    current.swap(previous);
+    buffer.retarget(current);
+}
+
+void TerminalFrame::invalidate() {
+    previousOnScreen = false;
+}
+
+void TerminalFrame::countOutside(char ch) {
+    // A line wider than the terminal wraps onto another row
+    if (ch == '\n' || ++column == columns) {
+        ++rowsOutside;
+        column = 0;
+    }
+}
+
+void TerminalFrame::clearScreen() {
+    if (!isTerminal()) return;
+    cout.flush();
+    writeOut(CLEAR_AND_HOME);
+}
+
+void TerminalFrame::appendFullFrame() {
+    output.append(CLEAR_AND_HOME);
+    output.append(current);
+}
+
+void TerminalFrame::appendChangedLines() {
+    output.append(HOME);
+    size_t start = 0, previousStart = 0;
+    while (start < current.size()) {
+        size_t end = current.find('\n', start);
+        if (end == string::npos) end = current.size();
+
+        bool unchanged = false;
+        if (previousStart < previous.size()) {
+            size_t previousEnd = previous.find('\n', previousStart);
+            if (previousEnd == string::npos) previousEnd = previous.size();
+            unchanged = previous.compare(previousStart, previousEnd - previousStart,
+                                         current, start, end - start) == 0;
+            previousStart = previousEnd + 1;
+        }
+
+        // An unchanged line costs one byte: just step over it
+        if (!unchanged) {
+            output.append(current, start, end - start);
+            output.append(CLEAR_LINE_END);
+        }
+        if (end < current.size()) output.push_back('\n');
+        start = end + 1;
+    }
+    // Drops the previous frame's prompts and any lines it had beyond this one
+    output.append(CLEAR_BELOW);
+}
+
+void TerminalFrame::writeOut(const string& bytes) {
+#ifdef _WIN32
+    fwrite(bytes.data(), 1, bytes.size(), stdout);
+    fflush(stdout);
+#else
+    const char* data = bytes.data();
+    size_t remaining = bytes.size();
+    while (remaining > 0) {
+        ssize_t written = ::write(STDOUT_FILENO, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        data += written;
+        remaining -= (size_t)written;
+    }
+#endif
+}
+
+bool TerminalFrame::isTerminal() {
+#ifdef _WIN32
+    return _isatty(_fileno(stdout)) != 0;
+#else
+    return isatty(STDOUT_FILENO) != 0;
+#endif
+}
+
+int TerminalFrame::terminalRows() {
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO info;
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) {
+        return info.srWindow.Bottom - info.srWindow.Top + 1;
+    }
+    return 0;
+#else
+    winsize size{};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0) return size.ws_row;
+    return 0;
+#endif
+}
+
+int TerminalFrame::terminalColumns() {
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO info;
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) {
+        return info.srWindow.Right - info.srWindow.Left + 1;
+    }
+    return 0;
+#else
+    winsize size{};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0) return size.ws_col;
+    return 0;
+#endif
+}
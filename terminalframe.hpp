@@ -0,0 +1,85 @@
+#ifndef TERMINALFRAME_HPP
+#define TERMINALFRAME_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+// Composes a whole terminal screen in memory and sends it with a single write.
+// Clearing and cursor movement use ANSI escapes, so no shell is started.
+// When the previous frame is still on screen only the changed lines are rewritten.
+// Once a frame is shown, cout and cin pass through it so it can count the rows
+// that prompts, logs and typed answers take below it; if they could have
+// scrolled the frame away, the next one is drawn in full.
+class TerminalFrame {
+public:
+    static const std::size_t RESERVED_BYTES = 32 * 1024;
+
+    TerminalFrame();
+    ~TerminalFrame();
+    TerminalFrame(const TerminalFrame&) = delete;
+    TerminalFrame& operator=(const TerminalFrame&) = delete;
+
+    // Starts a new frame; everything written to the returned stream is part of it
+    std::ostream& begin();
+    // Sends the frame to stdout, rewriting only changed lines when that is safe
+    void present();
+    // The next frame is drawn in full, e.g. after something else cleared the screen
+    void invalidate();
+
+    // Clears the screen and homes the cursor
+    static void clearScreen();
+
+private:
+    class FrameBuffer : public std::streambuf {
+    public:
+        explicit FrameBuffer(std::string& target) : target(&target) {}
+        void retarget(std::string& buffer) { target = &buffer; }
+
+    protected:
+        int_type overflow(int_type ch) override;
+        std::streamsize xsputn(const char* data, std::streamsize count) override;
+
+    private:
+        std::string* target;
+    };
+
+    // Forwards to cout's or cin's own buffer, counting what goes through it
+    class RowCounter : public std::streambuf {
+    public:
+        explicit RowCounter(TerminalFrame& frame) : frame(&frame) {}
+        void attach(std::ios& stream);
+        void detach(std::ios& stream);
+
+    protected:
+        int_type overflow(int_type ch) override;
+        std::streamsize xsputn(const char* data, std::streamsize count) override;
+        int_type underflow() override;
+        int sync() override;
+
+    private:
+        TerminalFrame* frame;
+        std::streambuf* source = nullptr;
+        char held = 0;
+    };
+
+    void countOutside(char ch);
+    void appendFullFrame();
+    void appendChangedLines();
+    static void writeOut(const std::string& bytes);
+    static bool isTerminal();
+    static int terminalRows();
+    static int terminalColumns();
+
+    std::string current, previous, output;
+    FrameBuffer buffer;
+    std::ostream stream;
+    RowCounter outputCounter, inputCounter;
+    bool previousOnScreen = false;
+    std::size_t previousRows = 0;   // rows the frame on screen takes
+    std::size_t rowsOutside = 0;    // rows written below it since
+    int column = 0, columns = 0;
+};
+
+#endif
@@ -1,11 +1,12 @@
 #include "terrorteracker.hpp"
+#include "rules.hpp"
 
 using namespace std;
 
 TerrorTracker::TerrorTracker() : level(0) {}
 
 void TerrorTracker::increase() {
-    if (level < 5) level++;
+    if (level < Rules::TERROR_LIMIT) level++;
 }
 
 int TerrorTracker::getLevel() const {
@@ -13,7 +14,7 @@ int TerrorTracker::getLevel() const {
 }
 
 void TerrorTracker::setLevel(int newLevel) {
-    if (newLevel >= 0 && newLevel <= 5) {
+    if (newLevel >= 0 && newLevel <= Rules::TERROR_LIMIT) {
         level = newLevel;
     }
 }
@@ -0,0 +1,100 @@
+#include "textlayoutcache.hpp"
+
+using namespace std;
+
+Vector2 TextLayoutCache::measure(const Font& font, string_view text, float fontSize, float spacing) {
+    return getLayout(font, text, fontSize, spacing).size;
+}
+
+void TextLayoutCache::draw(const Font& font, string_view text, Vector2 position, float fontSize, float spacing, Color tint) {
+    const Layout& layout = getLayout(font, text, fontSize, spacing);
+    if (layout.multiline) {
+        // Line spacing is raylib's business, let it lay out multi-line text itself
+        DrawTextEx(font, string(text).c_str(), position, fontSize, spacing, tint);
+        return;
+    }
+    for (const auto& glyph : layout.glyphs) {
+        Rectangle destination = {position.x + glyph.destination.x, position.y + glyph.destination.y,
+                                 glyph.destination.width, glyph.destination.height};
+        DrawTexturePro(font.texture, glyph.source, destination, Vector2{0, 0}, 0.0f, tint);
+    }
+}
+
+void TextLayoutCache::clear() {
+    buckets.clear();
+    entryCount = 0;
+}
+
+size_t TextLayoutCache::size() const {
+    return entryCount;
+}
+
+const TextLayoutCache::Layout& TextLayoutCache::getLayout(const Font& font, string_view text, float fontSize, float spacing) {
+    FontBucket* bucket = nullptr;
+    for (auto& candidate : buckets) {
+        if (candidate.textureId == font.texture.id && candidate.fontSize == fontSize && candidate.spacing == spacing) {
+            bucket = &candidate;
+            break;
+        }
+    }
+    if (bucket) {
+        auto it = bucket->layouts.find(text);
+        if (it != bucket->layouts.end()) {
+            return it->second;
+        }
+    }
+
+    if (entryCount >= MAX_ENTRIES) {
+        clear();
+        bucket = nullptr;
+    }
+    if (!bucket) {
+        buckets.push_back({font.texture.id, fontSize, spacing, {}});
+        bucket = &buckets.back();
+    }
+
+    string key(text);
+    Layout layout = buildLayout(font, key, fontSize, spacing);
+    ++entryCount;
+    return bucket->layouts.emplace(move(key), move(layout)).first->second;
+}
+
+// Same placement as raylib's DrawTextEx/DrawTextCodepoint, done once per string
+TextLayoutCache::Layout TextLayoutCache::buildLayout(const Font& font, const string& text, float fontSize, float spacing) {
+    Layout layout;
+    layout.size = MeasureTextEx(font, text.c_str(), fontSize, spacing);
+    layout.multiline = text.find('\n') != string::npos;
+    if (layout.multiline || font.glyphs == nullptr || font.recs == nullptr || font.baseSize == 0) {
+        layout.multiline = true;
+        return layout;
+    }
+
+    float scaleFactor = fontSize / font.baseSize;
+    float padding = (float)font.glyphPadding;
+    float offsetX = 0.0f;
+    layout.glyphs.reserve(text.size());
+
+    for (size_t i = 0; i < text.size();) {
+        int byteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &byteCount);
+        int index = GetGlyphIndex(font, codepoint);
+        const Rectangle& rec = font.recs[index];
+        const GlyphInfo& info = font.glyphs[index];
+
+        if (codepoint != ' ' && codepoint != '\t') {
+            Glyph glyph;
+            glyph.source = {rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding};
+            glyph.destination = {offsetX + info.offsetX * scaleFactor - padding * scaleFactor,
+                                 info.offsetY * scaleFactor - padding * scaleFactor,
+                                 (rec.width + 2.0f * padding) * scaleFactor,
+                                 (rec.height + 2.0f * padding) * scaleFactor};
+            layout.glyphs.push_back(glyph);
+        }
+
+        if (info.advanceX == 0) offsetX += rec.width * scaleFactor + spacing;
+        else offsetX += info.advanceX * scaleFactor + spacing;
+
+        i += byteCount > 0 ? byteCount : 1;
+    }
+    return layout;
+}
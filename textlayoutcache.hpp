@@ -0,0 +1,55 @@
+#ifndef TEXTLAYOUTCACHE_HPP
+#define TEXTLAYOUTCACHE_HPP
+
+#include <raylib.h>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Caches the measured size and glyph quads of strings per (font, size, spacing),
+// so static labels are not re-measured and re-decoded every frame.
+class TextLayoutCache {
+public:
+    // Dynamic strings (timers, counters) would grow the cache forever, so it starts over past this
+    static const std::size_t MAX_ENTRIES = 2048;
+
+    Vector2 measure(const Font& font, std::string_view text, float fontSize, float spacing);
+    void draw(const Font& font, std::string_view text, Vector2 position, float fontSize, float spacing, Color tint);
+    void clear();
+    std::size_t size() const;
+
+private:
+    struct Glyph {
+        Rectangle source;
+        Rectangle destination;  // relative to the text position
+    };
+
+    struct Layout {
+        Vector2 size;
+        bool multiline;
+        std::vector<Glyph> glyphs;
+    };
+
+    struct StringHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view text) const { return std::hash<std::string_view>()(text); }
+    };
+
+    struct FontBucket {
+        unsigned int textureId;
+        float fontSize;
+        float spacing;
+        std::unordered_map<std::string, Layout, StringHash, std::equal_to<>> layouts;
+    };
+
+    std::vector<FontBucket> buckets;
+    std::size_t entryCount = 0;
+
+    const Layout& getLayout(const Font& font, std::string_view text, float fontSize, float spacing);
+    static Layout buildLayout(const Font& font, const std::string& text, float fontSize, float spacing);
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "villager.hpp"
+#include "villagermanager.hpp"
 #include "hero.hpp"
 #include "perkcard.hpp"
 #include "perkdeck.hpp"
@@ -31,65 +32,26 @@ void Villager::setCurrentLocation(shared_ptr<Location> currentLocation) {
 }
 
 void Villager::checkSafePlace(PerkDeck* perkDeck, Hero* hero1, Hero* hero2) {
-    int reachedSafePlace = 0;
-    if (villagerName == "Dr.Cranley" && currentLocation->getName() == "Precinct") {
-        currentLocation->removeCharacter(villagerName);
-        setCurrentLocation(nullptr);  
-        cout << villagerName << " has reached their safe place and left the game!\n";
-        reachedSafePlace++;
-    }
-    else if (villagerName == "Dr.Reed" && currentLocation->getName() == "Camp") {
-        currentLocation->removeCharacter(villagerName);
-        setCurrentLocation(nullptr);  
-        cout << villagerName << " has reached their safe place and left the game!\n";
-        reachedSafePlace++;
-    }
-    else if (villagerName == "Prof.Pearson" && currentLocation->getName() == "Museum") {
-        currentLocation->removeCharacter(villagerName);
-        setCurrentLocation(nullptr);  
-        cout << villagerName << " has reached their safe place and left the game!\n";
-        reachedSafePlace++;
-    }
-    else if (villagerName == "Maleva" && currentLocation->getName() == "Shop") {
-        currentLocation->removeCharacter(villagerName);
-        setCurrentLocation(nullptr);  
-        cout << villagerName << " has reached their safe place and left the game!\n";
-        reachedSafePlace++;
-    }
-    else if (villagerName == "Fritz" && currentLocation->getName() == "Institute") {
-        currentLocation->removeCharacter(villagerName);
-        setCurrentLocation(nullptr); 
-        cout << villagerName << " has reached their safe place and left the game!\n";
-        reachedSafePlace++;
-    }
-    else if (villagerName == "Wilbur And Chick" && currentLocation->getName() == "Dungeon") {
-        currentLocation->removeCharacter(villagerName);
-        setCurrentLocation(nullptr);
-        cout << villagerName << " has reached their safe place and left the game!\n";
-        reachedSafePlace++;
-    }
-    else if (villagerName == "Maria" && currentLocation->getName() == "Camp") {
-        currentLocation->removeCharacter(villagerName);
-        setCurrentLocation(nullptr);
-        cout << villagerName << " has reached their safe place and left the game!\n";
-        reachedSafePlace++;
-    }
-
-    for (size_t i = 0; i < reachedSafePlace; ++i) {
-        if (perkDeck != nullptr && (hero1 != nullptr || hero2 != nullptr)) {
-            try {
-                PerkCard perk = perkDeck->drawRandomCard();
-                Hero* randomHero = (hero1 != nullptr && hero2 != nullptr) ? 
-                    (rand() % 2 == 0 ? hero1 : hero2) : 
-                    (hero1 != nullptr ? hero1 : hero2);
-                
-                randomHero->addPerkCard(perk);
-                cout << randomHero->getPlayerName() << " (" << randomHero->getHeroName() 
-                     << ") received perk card: " << PerkCard::perkTypeToString(perk.getType()) 
-                     << " for " << villagerName << " reaching their safe place!\n";
-            } catch (const exception& e) {
-                cout << e.what() << endl;
-            }
+    bool reachedSafePlace = currentLocation && VillagerManager::isSafePlace(villagerName, currentLocation->getName());
+    if (!reachedSafePlace) return;
+
+    currentLocation->removeCharacter(villagerName);
+    setCurrentLocation(nullptr);
+    cout << villagerName << " has reached their safe place and left the game!\n";
+
+    if (perkDeck != nullptr && (hero1 != nullptr || hero2 != nullptr)) {
+        try {
+            PerkCard perk = perkDeck->drawRandomCard();
+            Hero* randomHero = (hero1 != nullptr && hero2 != nullptr) ? 
+                (rand() % 2 == 0 ? hero1 : hero2) : 
+                (hero1 != nullptr ? hero1 : hero2);
+            
+            randomHero->addPerkCard(perk);
+            cout << randomHero->getPlayerName() << " (" << randomHero->getHeroName() 
+                 << ") received perk card: " << PerkCard::perkTypeToString(perk.getType()) 
+                 << " for " << villagerName << " reaching their safe place!\n";
+        } catch (const exception& e) {
+            cout << e.what() << endl;
         }
     }
 }
@@ -122,28 +84,7 @@ void Villager::move(shared_ptr<Location> newLocation, Hero* guidingHero, PerkDec
         setCurrentLocation(newLocation);
         cout << villagerName << " moved to " << newLocation->getName() << ".\n";
 
-        bool reachedSafePlace = false;
-        if (villagerName == "Dr.Cranley" && newLocation->getName() == "Precinct") {
-            reachedSafePlace = true;
-        }
-        else if (villagerName == "Dr.Reed" && newLocation->getName() == "Camp") {
-            reachedSafePlace = true;
-        }
-        else if (villagerName == "Prof.Pearson" && newLocation->getName() == "Museum") {
-            reachedSafePlace = true;
-        }
-        else if (villagerName == "Maleva" && newLocation->getName() == "Shop") {
-            reachedSafePlace = true;
-        }
-        else if (villagerName == "Fritz" && newLocation->getName() == "Institute") {
-            reachedSafePlace = true;
-        }
-        else if (villagerName == "Wilbur And Chick" && newLocation->getName() == "Dungeon") {
-            reachedSafePlace = true;
-        }
-        else if (villagerName == "Maria" && newLocation->getName() == "Camp") {
-            reachedSafePlace = true;
-        }
+        bool reachedSafePlace = VillagerManager::isSafePlace(villagerName, newLocation->getName());
 
         if (reachedSafePlace) {
             newLocation->removeCharacter(villagerName);
@@ -175,14 +116,21 @@ void Villager::moveByMonster(shared_ptr<Location> newLocation, PerkDeck* perkDec
         throw invalid_argument("There is no location called " + newLocation->getName());
     }
 
-    try {
-        currentLocation->removeCharacter(villagerName);
-        newLocation->addCharacter(villagerName);
-        setCurrentLocation(newLocation);
-        cout << villagerName << " moved to " << newLocation->getName() << ".\n";
+    if (!tryMoveByMonster(newLocation, perkDeck, hero1, hero2)) {
+        throw runtime_error("Failed to move villager: " + villagerName + " could not be moved to " + newLocation->getName() + ".");
+    }
+}
 
-        checkSafePlace(perkDeck, hero1, hero2);
-    } catch (const exception& e) {
-        throw runtime_error("Failed to move villager: " + string(e.what()));
+bool Villager::tryMoveByMonster(shared_ptr<Location> newLocation, PerkDeck* perkDeck, Hero* hero1, Hero* hero2) {
+    if (!currentLocation || !newLocation || currentLocation == newLocation) return false;
+    if (!currentLocation->tryRemoveCharacter(villagerName)) return false;
+    if (!newLocation->tryAddCharacter(villagerName)) {
+        currentLocation->tryAddCharacter(villagerName);
+        return false;
     }
+    setCurrentLocation(newLocation);
+    cout << villagerName << " moved to " << newLocation->getName() << ".\n";
+
+    checkSafePlace(perkDeck, hero1, hero2);
+    return true;
 }
\ No newline at end of file
@@ -20,6 +20,9 @@ public:
 
     void move(std::shared_ptr<Location> newLocation, Hero* guidingHero = nullptr, PerkDeck* perkDeck = nullptr);
     void moveByMonster(std::shared_ptr<Location> newLocation, PerkDeck* perkDeck = nullptr, Hero* hero1 = nullptr, Hero* hero2 = nullptr);
+    // moveByMonster for the monster phase: returns false and leaves the board
+    // unchanged when the villager can't be moved, instead of throwing
+    bool tryMoveByMonster(std::shared_ptr<Location> newLocation, PerkDeck* perkDeck = nullptr, Hero* hero1 = nullptr, Hero* hero2 = nullptr);
     void checkSafePlace(PerkDeck* perkDeck = nullptr, Hero* hero1 = nullptr, Hero* hero2 = nullptr);
 private:
     std::string villagerName;
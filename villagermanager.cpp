@@ -3,25 +3,161 @@
 
 using namespace std;
 
+static const array<string, VillagerManager::VILLAGER_COUNT> villagerNames = {
+    "Dr.Cranley", "Dr.Reed", "Prof.Pearson", "Maleva", "Fritz", "Wilbur And Chick", "Maria"
+};
+
+// Where each villager leaves the board, indexed by villager id
+static const array<string, VillagerManager::VILLAGER_COUNT> safePlaces = {
+    "Precinct", "Camp", "Museum", "Shop", "Institute", "Dungeon", "Camp"
+};
+
+VillagerManager::VillagerManager() : memoryResource(pmr::get_default_resource()) {}
+
+VillagerManager::VillagerManager(pmr::memory_resource* resource) : memoryResource(resource) {}
+
+size_t VillagerManager::getVillagerId(const string& villagerName) {
+    size_t id;
+    if (!findVillagerId(villagerName, id)) {
+        throw invalid_argument(villagerName + " doesn't exists");
+    }
+    return id;
+}
+
+bool VillagerManager::findVillagerId(const string& villagerName, size_t& villagerId) {
+    for (size_t id = 0; id < VILLAGER_COUNT; ++id) {
+        if (villagerNames[id] == villagerName) {
+            villagerId = id;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool VillagerManager::isVillagerName(const string& name) {
+    size_t id;
+    return findVillagerId(name, id);
+}
+
+const string& VillagerManager::getVillagerName(size_t villagerId) {
+    if (villagerId >= VILLAGER_COUNT) {
+        throw out_of_range("Invalid villager id");
+    }
+    return villagerNames[villagerId];
+}
+
+const string& VillagerManager::getSafePlace(size_t villagerId) {
+    if (villagerId >= VILLAGER_COUNT) {
+        throw out_of_range("Invalid villager id");
+    }
+    return safePlaces[villagerId];
+}
+
+bool VillagerManager::isSafePlace(const string& villagerName, const string& locationName) {
+    for (size_t id = 0; id < VILLAGER_COUNT; ++id) {
+        if (villagerNames[id] == villagerName) return safePlaces[id] == locationName;
+    }
+    return false;
+}
+
 void VillagerManager::addVillager(const string& villagerName, shared_ptr<Location> location) {
-    villagerMap[villagerName] = make_shared<Villager>(villagerName, location);
+    size_t id = getVillagerId(villagerName);
+    if (!block) {
+        block = allocate_shared<VillagerBlock>(pmr::polymorphic_allocator<VillagerBlock>(memoryResource));
+    }
+    // Shares ownership of the block, so the villager lives as long as any pointer to it
+    block->slots[id].emplace(villagerName, location);
+    villagers[id] = shared_ptr<Villager>(block, &*block->slots[id]);
+    // Only a villager the location actually shows is on the board
+    onBoard.set(id, location && location->hasCharacter(villagerName));
+    alive.set(id);
+    rescued.reset(id);
 }
 
 shared_ptr<Villager> VillagerManager::getVillager(const string& villagerName) const {
-    auto it = villagerMap.find(villagerName);
-    if (it != villagerMap.end()) {
-        return it->second;
+    auto villager = villagers[getVillagerId(villagerName)];
+    if (!villager) {
+        throw invalid_argument(villagerName + " doesn't exists");
+    }
+    return villager;
+}
+
+shared_ptr<Villager> VillagerManager::getVillager(size_t villagerId) const {
+    if (villagerId >= VILLAGER_COUNT || !villagers[villagerId]) {
+        throw invalid_argument("Villager doesn't exists");
     }
-    throw invalid_argument(villagerName + " doesn't exists");
+    return villagers[villagerId];
+}
+
+shared_ptr<Villager> VillagerManager::findVillager(const string& villagerName) const {
+    size_t id;
+    if (!findVillagerId(villagerName, id)) return nullptr;
+    return villagers[id];
 }
 
-const unordered_map<string, shared_ptr<Villager>>& VillagerManager::getAllVillagers() const {
-    return villagerMap;
+const VillagerManager::VillagerArray& VillagerManager::getAllVillagers() const {
+    return villagers;
 }
 
 void VillagerManager::moveVillager(const string& villagerName, shared_ptr<Location> location) {
-    auto it = villagerMap.find(villagerName);
-    if (it != villagerMap.end()) {
-        it->second->setCurrentLocation(location);
+    size_t id;
+    if (!findVillagerId(villagerName, id)) return;
+    if (villagers[id]) {
+        villagers[id]->setCurrentLocation(location);
+        onBoard.set(id, location && location->hasCharacter(villagerName));
+    }
+}
+
+void VillagerManager::killVillager(const string& villagerName, const string& killedBy) {
+    size_t id = getVillagerId(villagerName);
+    if (villagers[id]) {
+        if (eventSink && alive.test(id)) {
+            auto location = villagers[id]->getCurrentLocation();
+            eventSink->publish({GameEventType::VillagerKilled, killedBy, villagerName,
+                                location ? location->getName() : "", ""});
+        }
+        villagers[id]->setCurrentLocation(nullptr);
     }
-}
\ No newline at end of file
+    onBoard.reset(id);
+    alive.reset(id);
+}
+
+void VillagerManager::refreshVillager(const string& villagerName) {
+    size_t id = getVillagerId(villagerName);
+    if (!villagers[id] || !onBoard.test(id)) return;
+    if (!villagers[id]->getCurrentLocation()) {
+        onBoard.reset(id);
+        rescued.set(id);
+        if (eventSink) {
+            eventSink->publish({GameEventType::VillagerRescued, "", villagerName, safePlaces[id], ""});
+        }
+    }
+}
+
+bool VillagerManager::isOnBoard(size_t villagerId) const {
+    return villagerId < VILLAGER_COUNT && onBoard.test(villagerId);
+}
+
+bool VillagerManager::isAlive(size_t villagerId) const {
+    return villagerId < VILLAGER_COUNT && alive.test(villagerId);
+}
+
+bool VillagerManager::isRescued(size_t villagerId) const {
+    return villagerId < VILLAGER_COUNT && rescued.test(villagerId);
+}
+
+const VillagerManager::VillagerBits& VillagerManager::getOnBoard() const {
+    return onBoard;
+}
+
+const VillagerManager::VillagerBits& VillagerManager::getRescued() const {
+    return rescued;
+}
+
+void VillagerManager::setEventSink(GameEventSink* sink) {
+    eventSink = sink;
+}
+
+GameEventSink* VillagerManager::getEventSink() const {
+    return eventSink;
+}
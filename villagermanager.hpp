@@ -1,22 +1,74 @@
 #ifndef VILLAGERMANAGER_HPP
 #define VILLAGERMANAGER_HPP
 
-#include <unordered_map>
+#include <array>
+#include <bitset>
+#include <cstddef>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <string>
 #include "villager.hpp"
+#include "gameevents.hpp"
 #include <vector>
 
 class VillagerManager {
 public:
+    static const std::size_t VILLAGER_COUNT = 7;
+    // Pointers into the manager's one block of villagers, indexed by id
+    using VillagerArray = std::array<std::shared_ptr<Villager>, VILLAGER_COUNT>;
+    using VillagerBits = std::bitset<VILLAGER_COUNT>;
+
+    VillagerManager();
+    explicit VillagerManager(std::pmr::memory_resource* resource);
+
+    // Villager ids are fixed: Dr.Cranley, Dr.Reed, Prof.Pearson, Maleva, Fritz, Wilbur And Chick, Maria
+    static std::size_t getVillagerId(const std::string& villagerName);
+    // Returns false for names that are not villagers
+    static bool findVillagerId(const std::string& villagerName, std::size_t& villagerId);
+    static bool isVillagerName(const std::string& name);
+    static const std::string& getVillagerName(std::size_t villagerId);
+    static const std::string& getSafePlace(std::size_t villagerId);
+    static bool isSafePlace(const std::string& villagerName, const std::string& locationName);
+
+    // The villager counts as on the board only once location lists it as a character
     void addVillager(const std::string& villagerName, std::shared_ptr<Location> location);
     std::shared_ptr<Villager> getVillager(const std::string& villagerName) const;
-    const std::unordered_map<std::string, std::shared_ptr<Villager>>& getAllVillagers() const;
+    std::shared_ptr<Villager> getVillager(std::size_t villagerId) const;
+    // Null instead of throwing for unknown names and villagers not added yet
+    std::shared_ptr<Villager> findVillager(const std::string& villagerName) const;
+    // Indexed by villager id, slots of villagers not added yet are null
+    const VillagerArray& getAllVillagers() const;
     
     void moveVillager(const std::string& villagerName, std::shared_ptr<Location> location);
+    // killedBy is the monster named in the VillagerKilled event
+    void killVillager(const std::string& villagerName, const std::string& killedBy = "");
+    // Call after a move that may have taken the villager to their safe place
+    void refreshVillager(const std::string& villagerName);
+
+    bool isOnBoard(std::size_t villagerId) const;
+    bool isAlive(std::size_t villagerId) const;
+    bool isRescued(std::size_t villagerId) const;
+    const VillagerBits& getOnBoard() const;
+    const VillagerBits& getRescued() const;
+
+    // Rescues and deaths are published here as they happen; null disables publishing
+    void setEventSink(GameEventSink* sink);
+    GameEventSink* getEventSink() const;
 
 private:
-    std::unordered_map<std::string, std::shared_ptr<Villager>> villagerMap;
+    // All villagers side by side in one allocation, each in its id's slot
+    struct VillagerBlock {
+        std::array<std::optional<Villager>, VILLAGER_COUNT> slots;
+    };
+
+    std::shared_ptr<VillagerBlock> block;
+    VillagerArray villagers;
+    VillagerBits onBoard;
+    VillagerBits alive;
+    VillagerBits rescued;
+    std::pmr::memory_resource* memoryResource;
+    GameEventSink* eventSink = nullptr;
 };
 
-#endif
\ No newline at end of file
+#endif